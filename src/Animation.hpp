@@ -94,6 +94,9 @@ namespace BloodSword::Animation
 
         int ClipH = 0;
 
+        // on-screen location before the last step (rendering is interpolated from here)
+        Point Before = Point(0, 0);
+
         Base(Animation::Frames frames,
              Animation::Types mode,
              Points path,
@@ -236,6 +239,27 @@ namespace BloodSword::Animation
         {
             return this->Scale != Point(1, 1);
         }
+
+        // skip to the end of the animation
+        void Finish()
+        {
+            if (!this->Path.empty())
+            {
+                this->Current = this->Path.back();
+
+                this->Offset = Point(0, 0);
+
+                this->Move = SafeCast(this->Path.size()) - 1;
+            }
+
+            this->Cycle = this->Cycles;
+        }
+
+        // on-screen location of the object
+        Point Location()
+        {
+            return this->Origin + this->Current * this->Scale + this->Offset;
+        }
     };
 
     // show a frame of the animation on screen and cycle (if possible)
@@ -312,8 +336,8 @@ namespace BloodSword::Animation
         return done;
     }
 
-    // update the animation on screen (MOVE, FRAME, both)
-    bool Step(Scene::Base &scene, Animation::Base &animation, bool update, bool trail = false)
+    // advance the animation (MOVE, FRAME, both) without rendering it
+    bool Update(Scene::Base &scene, Animation::Base &animation, bool update)
     {
         auto done = false;
 
@@ -333,6 +357,12 @@ namespace BloodSword::Animation
             done = Animation::Show(scene, animation, update);
         }
 
+        return done;
+    }
+
+    // add the animation to the scene at the given location
+    void Render(Scene::Base &scene, Animation::Base &animation, Point location, bool trail = false)
+    {
         if (animation.Frame >= 0 && animation.Frame < SafeCast(animation.Frames.size()))
         {
             // add trail to movement
@@ -346,9 +376,6 @@ namespace BloodSword::Animation
                 }
             }
 
-            // add sprite to scene
-            auto location = animation.Origin + animation.Current * animation.Scale + animation.Offset;
-
             if (trail)
             {
                 auto dst = animation.Origin + animation.Path.back() * animation.Scale;
@@ -363,6 +390,29 @@ namespace BloodSword::Animation
                 scene.Add(Scene::Element(location + (2 * animation.TrailSize), animation.FrameW - (4 * animation.TrailSize), animation.FrameW - (4 * animation.TrailSize), Color::Transparent, Color::Inactive, animation.TrailSize));
             }
         }
+    }
+
+    // location between the last two steps (blend: 0.0 at the previous step, 1.0 at the current one)
+    Point Interpolate(Animation::Base &animation, double blend)
+    {
+        auto location = animation.Location();
+
+        if (!animation.Is(Type::MOVE) || blend >= 1.0)
+        {
+            return location;
+        }
+
+        auto delta = location - animation.Before;
+
+        return animation.Before + Point(int(delta.X * blend), int(delta.Y * blend));
+    }
+
+    // update the animation on screen (MOVE, FRAME, both)
+    bool Step(Scene::Base &scene, Animation::Base &animation, bool update, bool trail = false)
+    {
+        auto done = Animation::Update(scene, animation, update);
+
+        Animation::Render(scene, animation, animation.Location(), trail);
 
         return done;
     }
@@ -372,6 +422,9 @@ namespace BloodSword::Animations
 {
     typedef std::vector<Animation::Base> List;
 
+    // maximum number of steps taken in one frame (the rest is dropped after a stall)
+    const int CatchUp = 8;
+
     // collection of objects to animate on screen
     class Base
     {
@@ -379,11 +432,14 @@ namespace BloodSword::Animations
         // objects to animate
         Animations::List List = {};
 
-        // global delay (speed)
+        // global delay (speed): time between steps, in milliseconds (0: one step per frame)
         Uint64 Delay = 0;
 
-        // global timestamp
-        Uint64 TimeStamp = 0;
+        // performance counter when the animations were last processed (0 if not started)
+        Uint64 Clock = 0;
+
+        // time (in milliseconds) not yet accounted for by steps
+        double Pending = 0.0;
 
         // set objects to animate
         void Set(Animations::List list)
@@ -441,6 +497,16 @@ namespace BloodSword::Animations
             this->List.clear();
 
             this->Delay = 0;
+
+            this->Stop();
+        }
+
+        // restart the clock
+        void Stop()
+        {
+            this->Clock = 0;
+
+            this->Pending = 0.0;
         }
 
         // add animation to queue
@@ -450,7 +516,56 @@ namespace BloodSword::Animations
         }
     };
 
-    // process all animations in the list
+    // number of steps due since the animations were last processed (fixed timestep)
+    int Due(Animations::Base &animations)
+    {
+        auto now = SDL_GetPerformanceCounter();
+
+        if (animations.Clock == 0)
+        {
+            animations.Clock = now;
+
+            animations.Pending = 0.0;
+
+            for (auto &animation : animations.List)
+            {
+                animation.Before = animation.Location();
+            }
+
+            return 0;
+        }
+
+        animations.Pending += double(now - animations.Clock) * BloodSword::OneSecond / double(SDL_GetPerformanceFrequency());
+
+        animations.Clock = now;
+
+        if (animations.Delay == 0)
+        {
+            animations.Pending = 0.0;
+
+            return 1;
+        }
+
+        auto steps = int(animations.Pending / double(animations.Delay));
+
+        animations.Pending -= double(steps) * double(animations.Delay);
+
+        return std::min(steps, Animations::CatchUp);
+    }
+
+    // progress towards the next step (0.0 to 1.0)
+    double Blend(Animations::Base &animations)
+    {
+        return animations.Delay > 0 ? std::min(1.0, animations.Pending / double(animations.Delay)) : 1.0;
+    }
+
+    // time (in milliseconds) until the next step is due
+    Uint32 Remaining(Animations::Base &animations)
+    {
+        return animations.Delay > 0 ? Uint32(std::max(0.0, double(animations.Delay) - animations.Pending)) : 0;
+    }
+
+    // process all animations in the list (steps are taken at fixed intervals, locations in between are interpolated)
     bool Step(Scene::Base &scene, Animations::Base &animations, bool trail = false)
     {
         auto clip = Point(-1, -1);
@@ -471,27 +586,35 @@ namespace BloodSword::Animations
 
             auto frames = 0;
 
-            if (animations.TimeStamp == 0)
-            {
-                animations.TimeStamp = SDL_GetTicks64();
-            }
+            auto steps = Animations::Due(animations);
 
-            // check if frame / sprite needs to be updated / moved
-            auto update = (SDL_GetTicks64() - animations.TimeStamp > animations.Delay);
+            auto blend = Animations::Blend(animations);
 
             for (auto &animation : animations.List)
             {
+                // arrivals are processed even if no step is due
+                auto finished = (steps == 0) ? Animation::Update(scene, animation, false) : false;
+
+                for (auto step = 0; step < steps; step++)
+                {
+                    animation.Before = animation.Location();
+
+                    finished = Animation::Update(scene, animation, true);
+                }
+
+                Animation::Render(scene, animation, finished ? animation.Location() : Animation::Interpolate(animation, blend), trail);
+
                 if (animation.Is(Animation::Type::MOVE))
                 {
                     moves++;
 
-                    movement &= Animation::Step(scene, animation, update, trail);
+                    movement &= finished;
                 }
                 else
                 {
                     frames++;
 
-                    frame &= Animation::Step(scene, animation, update, trail);
+                    frame &= finished;
                 }
 
                 if (!animation.Clip.IsNone())
@@ -515,12 +638,6 @@ namespace BloodSword::Animations
             {
                 done = frame;
             }
-
-            // reset animation delay
-            if (update)
-            {
-                animations.TimeStamp = SDL_GetTicks64();
-            }
         }
 
         if (!clip.IsNone())
@@ -534,8 +651,8 @@ namespace BloodSword::Animations
 
         if (done)
         {
-            // reset time stamp
-            animations.TimeStamp = 0;
+            // restart the clock
+            animations.Stop();
         }
 
         return done;
@@ -1,7 +1,14 @@
 #ifndef __ASSET_HPP__
 #define __ASSET_HPP__
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <fstream>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
 
 #ifndef SDL_MAIN_HANDLED
 #define SDL_MAIN_HANDLED
@@ -40,6 +47,26 @@ namespace BloodSword::Asset
         return texture;
     }
 
+    // create texture from a (decoded) surface
+    SDL_Texture *Create(SDL_Renderer *renderer, SDL_Surface *surface)
+    {
+        SDL_Texture *texture = nullptr;
+
+        if (surface)
+        {
+            texture = BloodSword::CreateTexture(renderer, surface);
+
+            if (texture)
+            {
+                SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+
+                SDL_SetTextureColorMod(texture, Color::R(Color::Active), Color::G(Color::Active), Color::B(Color::Active));
+            }
+        }
+
+        return texture;
+    }
+
     // create texture from a file in zip archive
     SDL_Texture *Create(SDL_Renderer *renderer, const char *path, const char *zip_file)
     {
@@ -55,6 +82,724 @@ namespace BloodSword::Asset
         return texture;
     }
 
+    // maximum time (in ms) spent uploading decoded images each frame
+    double UploadBudget = 4.0;
+
+    // number of decoded images (e.g. section illustrations) kept until used
+    int CacheLimit = 8;
+
+    // decode image into a 32-bit RGBA surface (safe to call from worker threads)
+    SDL_Surface *Decode(std::string &path, std::string &zip_file)
+    {
+        auto original = !zip_file.empty() ? BloodSword::Surface(path.c_str(), zip_file.c_str()) : BloodSword::Surface(path.c_str());
+
+        SDL_Surface *surface = nullptr;
+
+        if (original)
+        {
+            surface = SDL_ConvertSurfaceFormat(original, SDL_PIXELFORMAT_RGBA32, 0);
+
+            BloodSword::Free(&original);
+        }
+
+        return surface;
+    }
+
+    // read image dimensions from a PNG header (false if not a PNG)
+    bool Dimensions(std::string &path, std::string &zip_file, int &w, int &h)
+    {
+        auto header = std::string();
+
+        if (!zip_file.empty())
+        {
+            header = ZipFile::Peek(zip_file.c_str(), path.c_str(), 24);
+        }
+        else
+        {
+            std::ifstream file(path, std::ios::binary);
+
+            if (file.good())
+            {
+                header.resize(24);
+
+                file.read(header.data(), 24);
+
+                header.resize(file.gcount());
+
+                file.close();
+            }
+        }
+
+        auto result = false;
+
+        // signature followed by the IHDR chunk (width and height are big-endian)
+        if (header.size() == 24 && header.compare(0, 8, "\x89PNG\r\n\x1a\n") == 0 && header.compare(12, 4, "IHDR") == 0)
+        {
+            auto bytes = reinterpret_cast<const unsigned char *>(header.data());
+
+            w = (bytes[16] << 24) | (bytes[17] << 16) | (bytes[18] << 8) | bytes[19];
+
+            h = (bytes[20] << 24) | (bytes[21] << 16) | (bytes[22] << 8) | bytes[23];
+
+            result = (w > 0 && h > 0);
+        }
+
+        return result;
+    }
+
+    // image to be decoded on a worker thread
+    class Job
+    {
+    public:
+        // image file
+        std::string Path = std::string();
+
+        // zip archive (empty if not zipped)
+        std::string Zip = std::string();
+
+        // texture filled in once decoded (nullptr if the image is only cached)
+        SDL_Texture *Texture = nullptr;
+
+        // decoded image
+        SDL_Surface *Surface = nullptr;
+
+        // textures requested before the last unload are discarded
+        Uint64 Generation = 0;
+
+        // asset the image belongs to (NONE if not an asset)
+        Asset::Type Id = Asset::NONE;
+
+        Job() {}
+
+        Job(std::string path, std::string zip, SDL_Texture *texture, Uint64 generation) : Path(path), Zip(zip), Texture(texture), Generation(generation) {}
+
+        // key of the image in the cache
+        std::string Key()
+        {
+            return this->Zip + "/" + this->Path;
+        }
+    };
+
+    // decodes images on worker threads. textures are only touched on the main thread (see Upload)
+    class Loader
+    {
+    private:
+        std::vector<std::thread> Threads = {};
+
+        bool Stopping = false;
+
+        // wakes up workers when there are requests
+        std::condition_variable Requested;
+
+        // wakes up the main thread when a cached image is ready
+        std::condition_variable Decoded;
+
+        // worker thread
+        void Work()
+        {
+            while (true)
+            {
+                auto job = Asset::Job();
+
+                {
+                    std::unique_lock<std::mutex> guard(this->Lock);
+
+                    this->Requested.wait(guard, [this]()
+                                         { return this->Stopping || !this->Requests.empty(); });
+
+                    if (this->Stopping)
+                    {
+                        break;
+                    }
+
+                    job = this->Requests.front();
+
+                    this->Requests.pop_front();
+                }
+
+                job.Surface = Asset::Decode(job.Path, job.Zip);
+
+                {
+                    std::lock_guard<std::mutex> guard(this->Lock);
+
+                    if (job.Texture)
+                    {
+                        this->Ready.push_back(job);
+
+                        this->Outstanding--;
+                    }
+                    else
+                    {
+                        this->Pending.erase(job.Key());
+
+                        if (job.Surface)
+                        {
+                            this->Cache.push_back({job.Key(), job.Surface});
+                        }
+
+                        // drop oldest images
+                        while (SafeCast(this->Cache.size()) > Asset::CacheLimit)
+                        {
+                            BloodSword::Free(&this->Cache.front().second);
+
+                            this->Cache.pop_front();
+                        }
+                    }
+                }
+
+                if (!job.Texture)
+                {
+                    this->Decoded.notify_all();
+                }
+            }
+        }
+
+    public:
+        std::mutex Lock;
+
+        // images waiting to be decoded
+        std::deque<Asset::Job> Requests = {};
+
+        // decoded images waiting to be uploaded into their textures
+        std::deque<Asset::Job> Ready = {};
+
+        // decoded images not bound to a texture (oldest first)
+        std::deque<std::pair<std::string, SDL_Surface *>> Cache = {};
+
+        // cached images currently being decoded
+        std::unordered_set<std::string> Pending = {};
+
+        // textures still waiting for their images to be decoded
+        int Outstanding = 0;
+
+        // incremented when assets are unloaded
+        Uint64 Generation = 0;
+
+        Loader() {}
+
+        ~Loader()
+        {
+            this->Stop();
+        }
+
+        // start worker threads (if not yet running)
+        void Start()
+        {
+            if (this->Threads.empty())
+            {
+                for (auto worker = 0; worker < BloodSword::Workers(); worker++)
+                {
+                    this->Threads.emplace_back([this]()
+                                               { this->Work(); });
+                }
+            }
+        }
+
+        // queue an image to be decoded
+        void Queue(Asset::Job job)
+        {
+            this->Start();
+
+            {
+                std::lock_guard<std::mutex> guard(this->Lock);
+
+                if (!job.Texture)
+                {
+                    auto key = job.Key();
+
+                    for (auto &cached : this->Cache)
+                    {
+                        if (cached.first == key)
+                        {
+                            return;
+                        }
+                    }
+
+                    if (this->Pending.count(key) > 0)
+                    {
+                        return;
+                    }
+
+                    this->Pending.insert(key);
+
+                    // images that are taken (waited for) later are decoded before textures
+                    this->Requests.push_front(job);
+                }
+                else
+                {
+                    this->Outstanding++;
+
+                    this->Requests.push_back(job);
+                }
+            }
+
+            this->Requested.notify_one();
+        }
+
+        // take a cached image (waits if it is still being decoded). must be de-allocated manually
+        SDL_Surface *Take(std::string key)
+        {
+            SDL_Surface *surface = nullptr;
+
+            std::unique_lock<std::mutex> guard(this->Lock);
+
+            // not started yet: decode it here instead of waiting for the workers
+            for (auto job = this->Requests.begin(); job != this->Requests.end(); job++)
+            {
+                if (!job->Texture && job->Key() == key)
+                {
+                    auto queued = *job;
+
+                    this->Requests.erase(job);
+
+                    guard.unlock();
+
+                    surface = Asset::Decode(queued.Path, queued.Zip);
+
+                    guard.lock();
+
+                    this->Pending.erase(key);
+
+                    guard.unlock();
+
+                    this->Decoded.notify_all();
+
+                    return surface;
+                }
+            }
+
+            this->Decoded.wait(guard, [&]()
+                               { return this->Pending.count(key) == 0; });
+
+            for (auto cached = this->Cache.begin(); cached != this->Cache.end(); cached++)
+            {
+                if (cached->first == key)
+                {
+                    surface = cached->second;
+
+                    this->Cache.erase(cached);
+
+                    break;
+                }
+            }
+
+            return surface;
+        }
+
+        // discard images of textures that are about to be destroyed
+        void Discard()
+        {
+            std::lock_guard<std::mutex> guard(this->Lock);
+
+            this->Generation++;
+
+            for (auto job = this->Requests.begin(); job != this->Requests.end();)
+            {
+                if (job->Texture)
+                {
+                    job = this->Requests.erase(job);
+
+                    this->Outstanding--;
+                }
+                else
+                {
+                    job++;
+                }
+            }
+
+            for (auto &job : this->Ready)
+            {
+                BloodSword::Free(&job.Surface);
+            }
+
+            this->Ready.clear();
+        }
+
+        // stop worker threads and release all decoded images
+        void Stop()
+        {
+            {
+                std::lock_guard<std::mutex> guard(this->Lock);
+
+                this->Stopping = true;
+            }
+
+            this->Requested.notify_all();
+
+            for (auto &thread : this->Threads)
+            {
+                thread.join();
+            }
+
+            this->Threads.clear();
+
+            for (auto &job : this->Ready)
+            {
+                BloodSword::Free(&job.Surface);
+            }
+
+            this->Ready.clear();
+
+            for (auto &cached : this->Cache)
+            {
+                BloodSword::Free(&cached.second);
+            }
+
+            this->Cache.clear();
+
+            this->Requests.clear();
+
+            this->Pending.clear();
+
+            this->Outstanding = 0;
+
+            this->Decoded.notify_all();
+        }
+    };
+
+    // background image decoder
+    Asset::Loader Background;
+
+    // pack small assets (tiles, icons) into shared textures so they can be drawn in batches
+    bool UseAtlas = true;
+
+    // largest asset (width or height) packed into an atlas
+    int AtlasTile = BloodSword::TileSize;
+
+    // largest atlas page (width and height)
+    int AtlasSize = 2048;
+
+    // empty pixels around each packed asset (avoids bleeding from neighbours)
+    int AtlasPadding = 1;
+
+    // location of an asset in an atlas page
+    class Region
+    {
+    public:
+        // atlas page
+        SDL_Texture *Atlas = nullptr;
+
+        // asset's location in the page
+        SDL_Rect Bounds = {0, 0, 0, 0};
+
+        // dimensions of the page
+        int W = 0;
+
+        int H = 0;
+    };
+
+    // atlas pages
+    std::vector<SDL_Texture *> Atlases = {};
+
+    // location of asset textures in the atlas pages
+    std::unordered_map<SDL_Texture *, Asset::Region> Regions = {};
+
+    // get location of texture in an atlas (nullptr if not packed)
+    Asset::Region *Find(SDL_Texture *texture)
+    {
+        Asset::Region *region = nullptr;
+
+        if (texture && !Asset::Regions.empty())
+        {
+            auto search = Asset::Regions.find(texture);
+
+            if (search != Asset::Regions.end())
+            {
+                region = &search->second;
+            }
+        }
+
+        return region;
+    }
+
+    // release atlas pages
+    void FreeAtlases()
+    {
+        for (auto &atlas : Asset::Atlases)
+        {
+            BloodSword::Free(&atlas);
+        }
+
+        Asset::Atlases.clear();
+
+        Asset::Regions.clear();
+    }
+
+    // create a blank atlas page
+    SDL_Texture *CreateAtlas(SDL_Renderer *renderer, int w, int h)
+    {
+        auto atlas = BloodSword::CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, w, h);
+
+        if (atlas)
+        {
+            auto blank = std::vector<Uint32>(w * h, 0);
+
+            SDL_UpdateTexture(atlas, nullptr, blank.data(), w * sizeof(Uint32));
+
+            SDL_SetTextureBlendMode(atlas, SDL_BLENDMODE_BLEND);
+        }
+
+        return atlas;
+    }
+
+    // lay out textures in rows (tallest first) over as many pages as needed. contents are copied as images are decoded
+    void Pack(SDL_Renderer *renderer, std::vector<SDL_Texture *> &textures)
+    {
+        auto page_size = Asset::AtlasSize;
+
+        SDL_RendererInfo info;
+
+        if (SDL_GetRendererInfo(renderer, &info) == 0 && info.max_texture_width > 0 && info.max_texture_height > 0)
+        {
+            page_size = std::min(page_size, std::min(info.max_texture_width, info.max_texture_height));
+        }
+
+        auto packed = std::vector<std::pair<SDL_Texture *, SDL_Rect>>();
+
+        for (auto &texture : textures)
+        {
+            SDL_Rect bounds = {0, 0, 0, 0};
+
+            BloodSword::Size(texture, &bounds.w, &bounds.h);
+
+            if (bounds.w > 0 && bounds.h > 0 && bounds.w <= Asset::AtlasTile && bounds.h <= Asset::AtlasTile)
+            {
+                packed.push_back({texture, bounds});
+            }
+        }
+
+        // fewer than two textures would not save any texture switches
+        if (SafeCast(packed.size()) < 2)
+        {
+            return;
+        }
+
+        std::stable_sort(packed.begin(), packed.end(), [](auto &a, auto &b)
+                         { return a.second.h > b.second.h; });
+
+        auto pages = std::vector<std::vector<std::pair<SDL_Texture *, SDL_Rect>>>(1);
+
+        auto x = Asset::AtlasPadding;
+
+        auto y = Asset::AtlasPadding;
+
+        auto row_h = 0;
+
+        for (auto &item : packed)
+        {
+            auto &bounds = item.second;
+
+            // next row
+            if (x + bounds.w + Asset::AtlasPadding > page_size)
+            {
+                x = Asset::AtlasPadding;
+
+                y += row_h + Asset::AtlasPadding;
+
+                row_h = 0;
+            }
+
+            // next page
+            if (y + bounds.h + Asset::AtlasPadding > page_size)
+            {
+                pages.push_back({});
+
+                x = Asset::AtlasPadding;
+
+                y = Asset::AtlasPadding;
+
+                row_h = 0;
+            }
+
+            bounds.x = x;
+
+            bounds.y = y;
+
+            pages.back().push_back(item);
+
+            x += bounds.w + Asset::AtlasPadding;
+
+            row_h = std::max(row_h, bounds.h);
+        }
+
+        for (auto &page : pages)
+        {
+            // shrink page to its contents
+            auto page_w = 0;
+
+            auto page_h = 0;
+
+            for (auto &item : page)
+            {
+                page_w = std::max(page_w, item.second.x + item.second.w + Asset::AtlasPadding);
+
+                page_h = std::max(page_h, item.second.y + item.second.h + Asset::AtlasPadding);
+            }
+
+            auto atlas = (page_w > 0 && page_h > 0) ? Asset::CreateAtlas(renderer, page_w, page_h) : nullptr;
+
+            if (atlas)
+            {
+                Asset::Atlases.push_back(atlas);
+
+                for (auto &item : page)
+                {
+                    auto region = Asset::Region();
+
+                    region.Atlas = atlas;
+
+                    region.Bounds = item.second;
+
+                    region.W = page_w;
+
+                    region.H = page_h;
+
+                    Asset::Regions[item.first] = region;
+                }
+            }
+        }
+
+        SDL_Log("[ATLAS] %d textures in %d pages", SafeCast(Asset::Regions.size()), SafeCast(Asset::Atlases.size()));
+    }
+
+    // decoded images of assets, kept so textures can be re-created without reading from disk (e.g. palette switches)
+    Asset::Mapping<SDL_Surface *> Sources = {};
+
+    // release decoded images of assets
+    void FreeSources()
+    {
+        for (auto &source : Asset::Sources)
+        {
+            BloodSword::Free(&source.second);
+        }
+
+        Asset::Sources.clear();
+    }
+
+    // copy decoded images into their textures until the time budget (in ms) runs out (main thread only)
+    void Upload(double budget)
+    {
+        auto stopwatch = BloodSword::Stopwatch();
+
+        while (true)
+        {
+            auto job = Asset::Job();
+
+            {
+                std::lock_guard<std::mutex> guard(Asset::Background.Lock);
+
+                if (Asset::Background.Ready.empty())
+                {
+                    break;
+                }
+
+                job = Asset::Background.Ready.front();
+
+                Asset::Background.Ready.pop_front();
+
+                if (job.Generation != Asset::Background.Generation)
+                {
+                    job.Texture = nullptr;
+                }
+            }
+
+            if (job.Texture && job.Surface)
+            {
+                auto texture_w = 0;
+
+                auto texture_h = 0;
+
+                BloodSword::Size(job.Texture, &texture_w, &texture_h);
+
+                SDL_Rect rect = {0, 0, std::min(texture_w, job.Surface->w), std::min(texture_h, job.Surface->h)};
+
+                SDL_UpdateTexture(job.Texture, &rect, job.Surface->pixels, job.Surface->pitch);
+
+                BloodSword::Touch(job.Texture);
+
+                // keep the atlas copy in sync
+                auto region = Asset::Find(job.Texture);
+
+                if (region)
+                {
+                    SDL_Rect bounds = {region->Bounds.x, region->Bounds.y, rect.w, rect.h};
+
+                    SDL_UpdateTexture(region->Atlas, &bounds, job.Surface->pixels, job.Surface->pitch);
+                }
+
+                // keep image in memory
+                if (job.Id != Asset::NONE)
+                {
+                    BloodSword::Free(&Asset::Sources[job.Id]);
+
+                    Asset::Sources[job.Id] = job.Surface;
+
+                    job.Surface = nullptr;
+                }
+            }
+            else if (job.Texture)
+            {
+                SDL_LogCritical(SDL_LOG_CATEGORY_APPLICATION, "Unable to decode image %s!", job.Path.c_str());
+            }
+
+            BloodSword::Free(&job.Surface);
+
+            if (budget >= 0.0 && stopwatch.Elapsed() >= budget)
+            {
+                break;
+            }
+        }
+    }
+
+    // copy decoded images into their textures using the per-frame budget
+    void Upload()
+    {
+        Asset::Upload(Asset::UploadBudget);
+    }
+
+    // decode an image ahead of time (e.g. illustration of a section that may be visited next)
+    void Preload(std::string path, std::string zip_file)
+    {
+        if (!path.empty())
+        {
+            Asset::Background.Queue(Asset::Job(path, zip_file, nullptr, 0));
+        }
+    }
+
+    // get an image decoded ahead of time (nullptr if not preloaded). must be de-allocated manually
+    SDL_Surface *Take(std::string path, std::string zip_file)
+    {
+        return Asset::Background.Take(Asset::Job(path, zip_file, nullptr, 0).Key());
+    }
+
+    // create a blank (transparent) texture with the image's dimensions (nullptr if dimensions are unknown)
+    SDL_Texture *Placeholder(SDL_Renderer *renderer, std::string &path, std::string &zip_file)
+    {
+        SDL_Texture *texture = nullptr;
+
+        auto w = 0;
+
+        auto h = 0;
+
+        if (Asset::Dimensions(path, zip_file, w, h))
+        {
+            texture = BloodSword::CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, w, h);
+
+            if (texture)
+            {
+                auto blank = std::vector<Uint32>(w * h, 0);
+
+                SDL_UpdateTexture(texture, nullptr, blank.data(), w * sizeof(Uint32));
+
+                SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+
+                SDL_SetTextureColorMod(texture, Color::R(Color::Active), Color::G(Color::Active), Color::B(Color::Active));
+            }
+        }
+
+        return texture;
+    }
+
     // re-create surface from asset and color adjust
     SDL_Surface *Surface(Asset::Type asset, Uint32 blur)
     {
@@ -62,7 +807,8 @@ namespace BloodSword::Asset
 
         if (asset != Asset::NONE)
         {
-            surface = BloodSword::Surface(Asset::Locations[asset].c_str());
+            // use image kept in memory if available
+            surface = BloodSword::Has(Asset::Sources, asset) ? SDL_DuplicateSurface(Asset::Sources[asset]) : BloodSword::Surface(Asset::Locations[asset].c_str());
 
             if (surface)
             {
@@ -95,9 +841,77 @@ namespace BloodSword::Asset
         return Asset::Surface(asset_type);
     }
 
+    // decoded surfaces (key: asset type and color modulation)
+    std::unordered_map<Uint64, SDL_Surface *> Surfaces = {};
+
+    // release decoded surfaces
+    void FreeSurfaces()
+    {
+        for (auto &surface : Asset::Surfaces)
+        {
+            BloodSword::Free(&surface.second);
+        }
+
+        Asset::Surfaces.clear();
+    }
+
+    // get asset as a surface with color modulation, decoded only once. owned by the cache: do not de-allocate
+    SDL_Surface *Cached(Asset::Type asset, Uint32 blur)
+    {
+        SDL_Surface *surface = nullptr;
+
+        if (asset != Asset::NONE)
+        {
+            auto key = (Uint64(Uint32(asset)) << 32) | Uint64(blur);
+
+            auto search = Asset::Surfaces.find(key);
+
+            if (search != Asset::Surfaces.end())
+            {
+                surface = search->second;
+            }
+            else
+            {
+                surface = Asset::Surface(asset, blur);
+
+                // missing assets are not retried
+                Asset::Surfaces[key] = surface;
+            }
+        }
+
+        return surface;
+    }
+
+    // get asset as a surface with color modulation, decoded only once. owned by the cache: do not de-allocate
+    SDL_Surface *Cached(std::string asset, Uint32 blur)
+    {
+        return Asset::Cached(Asset::Map(asset), blur);
+    }
+
+    // get asset as a surface in the current palette, decoded only once. owned by the cache: do not de-allocate
+    SDL_Surface *Cached(Asset::Type asset)
+    {
+        return Asset::Cached(asset, Color::Active);
+    }
+
+    // get asset as a surface in the current palette, decoded only once. owned by the cache: do not de-allocate
+    SDL_Surface *Cached(std::string asset)
+    {
+        return Asset::Cached(Asset::Map(asset));
+    }
+
     // unload all assets
     void Unload()
     {
+        // images still being decoded must not be copied into destroyed textures
+        Asset::Background.Discard();
+
+        Asset::FreeAtlases();
+
+        Asset::FreeSurfaces();
+
+        Asset::FreeSources();
+
         if (SafeCast(Asset::Textures.size()) > 0)
         {
             for (auto &texture : Asset::Textures)
@@ -128,7 +942,9 @@ namespace BloodSword::Asset
 
         if (!data["assets"].is_null() && data["assets"].is_array() && SafeCast(data["assets"].size()) > 0)
         {
-            auto asset_type = 0;
+            auto objects = std::vector<std::string>();
+
+            auto paths = std::vector<std::string>();
 
             for (auto i = 0; i < SafeCast(data["assets"].size()); i++)
             {
@@ -138,19 +954,63 @@ namespace BloodSword::Asset
 
                 if (!path.empty() && !object.empty())
                 {
-                    auto texture = is_zip ? Asset::Create(renderer, path.c_str(), zip_file) : Asset::Create(renderer, path.c_str());
+                    objects.push_back(object);
 
-                    if (texture)
-                    {
-                        Asset::Locations[asset_type] = path;
+                    paths.push_back(path);
+                }
+            }
 
-                        Asset::Textures[asset_type] = texture;
+            auto zip = is_zip ? std::string(zip_file) : std::string();
 
-                        // update type mapping
-                        Asset::TypeMapping[asset_type] = object;
-                    }
+            auto generation = Asset::Background.Generation;
+
+            auto placeholders = std::vector<SDL_Texture *>();
+
+            auto decode = std::vector<bool>(paths.size(), false);
+
+            for (auto asset_type = 0; asset_type < SafeCast(paths.size()); asset_type++)
+            {
+                auto texture = Asset::Placeholder(renderer, paths[asset_type], zip);
 
-                    asset_type++;
+                if (texture)
+                {
+                    placeholders.push_back(texture);
+
+                    decode[asset_type] = true;
+                }
+                else
+                {
+                    // not a PNG: decode now
+                    texture = is_zip ? Asset::Create(renderer, paths[asset_type].c_str(), zip_file) : Asset::Create(renderer, paths[asset_type].c_str());
+                }
+
+                if (texture)
+                {
+                    Asset::Locations[asset_type] = paths[asset_type];
+
+                    Asset::Textures[asset_type] = texture;
+
+                    // update type mapping
+                    Asset::TypeMapping.Set(asset_type, objects[asset_type]);
+                }
+            }
+
+            // pack before any image is decoded so that atlas copies are filled in at upload
+            if (Asset::UseAtlas)
+            {
+                Asset::Pack(renderer, placeholders);
+            }
+
+            // decode on worker threads, contents are uploaded in the next frames
+            for (auto asset_type = 0; asset_type < SafeCast(paths.size()); asset_type++)
+            {
+                if (decode[asset_type])
+                {
+                    auto job = Asset::Job(paths[asset_type], zip, Asset::Textures[asset_type], generation);
+
+                    job.Id = asset_type;
+
+                    Asset::Background.Queue(job);
                 }
             }
         }
@@ -242,7 +1102,7 @@ namespace BloodSword::Asset
                     if (!path.empty() && !object.empty())
                     {
                         // update type mapping
-                        Asset::TypeMapping[asset_type] = object;
+                        Asset::TypeMapping.Set(asset_type, object);
 
                         // update location
                         Asset::Locations[asset_type] = path;
@@ -311,12 +1171,29 @@ namespace BloodSword::Asset
         return texture;
     }
 
+    // apply color modulation to all asset textures (e.g. after a palette switch)
+    void Tint(Uint32 color)
+    {
+        for (auto &texture : Asset::Textures)
+        {
+            if (texture.second)
+            {
+                SDL_SetTextureColorMod(texture.second, Color::R(color), Color::G(color), Color::B(color));
+            }
+        }
+    }
+
     // create a copy of the asset. must be de-allocated manually
     SDL_Texture *Copy(SDL_Renderer *renderer, Asset::Type asset)
     {
         SDL_Texture *texture = nullptr;
 
-        if (BloodSword::Has(Asset::Locations, asset))
+        if (BloodSword::Has(Asset::Sources, asset))
+        {
+            // image kept in memory
+            texture = Asset::Create(renderer, Asset::Sources[asset]);
+        }
+        else if (BloodSword::Has(Asset::Locations, asset))
         {
             texture = Asset::Create(renderer, Asset::Locations[asset].c_str());
         }
@@ -36,7 +36,7 @@ namespace BloodSword::Asset
     typedef std::vector<Asset::Type> List;
 
     // asset type to string mapping
-    Asset::Mapping<std::string> TypeMapping = {};
+    BloodSword::StringMap<Asset::Type> TypeMapping = {};
 
     // get asset type id
     Asset::Type Map(std::string asset)
@@ -47,12 +47,12 @@ namespace BloodSword::Asset
     // get asset type id
     Asset::Type Map(const char *asset)
     {
-        return Asset::Map(std::string(asset));
+        return BloodSword::Find(Asset::TypeMapping, asset, Asset::NONE);
     }
 
     // generate T -> asset type id mapping
-    template <typename T>
-    void MapTypes(Asset::Lookup<T> &types, BloodSword::ConstStrings<T> &assets)
+    template <typename T, typename R, std::size_t N>
+    void MapTypes(Asset::Lookup<T> &types, const BloodSword::Table<T, R, N> &assets)
     {
         types.clear();
 
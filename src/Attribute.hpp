@@ -35,34 +35,34 @@ namespace BloodSword::Attribute
     Asset::Lookup<Attribute::Type> Assets = {};
 
     // attribute type to asset name mapping
-    BloodSword::ConstStrings<Attribute::Type> AssetNames = {
+    constexpr auto AssetNames = BloodSword::Tabulate<Attribute::Type>({
         {Attribute::Type::NONE, "NONE"},
         {Attribute::Type::FIGHTING_PROWESS, "FIGHT"},
         {Attribute::Type::AWARENESS, "AWARENESS"},
         {Attribute::Type::PSYCHIC_ABILITY, "PSYCHIC ABILITY"},
         {Attribute::Type::ENDURANCE, "ENDURANCE"},
         {Attribute::Type::DAMAGE, "DAMAGE"},
-        {Attribute::Type::ARMOUR, "ARMOUR"}};
+        {Attribute::Type::ARMOUR, "ARMOUR"}});
 
     // attribute type to string mapping
-    BloodSword::StringMap<Attribute::Type> TypeMapping = {
+    constexpr auto TypeMapping = BloodSword::Tabulate<Attribute::Type, std::string>({
         {Attribute::Type::NONE, "NONE"},
         {Attribute::Type::FIGHTING_PROWESS, "FIGHTING PROWESS"},
         {Attribute::Type::AWARENESS, "AWARENESS"},
         {Attribute::Type::PSYCHIC_ABILITY, "PSYCHIC ABILITY"},
         {Attribute::Type::ENDURANCE, "ENDURANCE"},
         {Attribute::Type::DAMAGE, "DAMAGE"},
-        {Attribute::Type::ARMOUR, "ARMOUR"}};
+        {Attribute::Type::ARMOUR, "ARMOUR"}});
 
     // attribute string abbreviations
-    BloodSword::StringMap<Attribute::Type> Abbreviations = {
+    constexpr auto Abbreviations = BloodSword::Tabulate<Attribute::Type, std::string>({
         {Attribute::Type::NONE, "---"},
         {Attribute::Type::FIGHTING_PROWESS, "FPR"},
         {Attribute::Type::AWARENESS, "AWR"},
         {Attribute::Type::PSYCHIC_ABILITY, "PSY"},
         {Attribute::Type::ENDURANCE, "END"},
         {Attribute::Type::DAMAGE, "DMG"},
-        {Attribute::Type::ARMOUR, "ARM"}};
+        {Attribute::Type::ARMOUR, "ARM"}});
 
     // map attribute types to asset type ids
     void MapAssets()
@@ -43,7 +43,7 @@ namespace BloodSword::Battle
     const int Unlimited = -1;
 
     // battle condition to string mapping
-    BloodSword::ConstStrings<Battle::Condition> ConditionMapping = {
+    constexpr auto ConditionMapping = BloodSword::Tabulate<Battle::Condition>({
         {Battle::Condition::NONE, "NONE"},
         {Battle::Condition::NO_COMBAT, "NO COMBAT"},
         {Battle::Condition::AMBUSH_PLAYER, "AMBUSH PLAYER"},
@@ -68,7 +68,7 @@ namespace BloodSword::Battle
         {Battle::Condition::CLONE_ENCHANTER, "CLONE ENCHANTER"},
         {Battle::Condition::SLOW_MURDER, "SLOW MURDER"},
         {Battle::Condition::MISSION, "MISSION"},
-        {Battle::Condition::EXCLUDE_OTHERS, "EXCLUDE OTHERS"}};
+        {Battle::Condition::EXCLUDE_OTHERS, "EXCLUDE OTHERS"}});
 
     // map string to battle condition
     Battle::Condition MapCondition(const char *condition)
@@ -402,15 +402,15 @@ namespace BloodSword::Battle
         }
         else
         {
-            auto ifs = ZipFile::Read(zip_file, filename);
+            auto ifs = ZipFile::Open(zip_file, filename);
 
-            if (!ifs.empty())
+            if (!ifs.IsEmpty())
             {
-                auto data = nlohmann::json::parse(ifs);
+                auto data = nlohmann::json::parse(ifs.View());
 
                 Battle::Load(battle, data, zip_file);
 
-                ifs.clear();
+                ifs.Clear();
             }
         }
 
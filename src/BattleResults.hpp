@@ -17,13 +17,13 @@ namespace BloodSword::Battle
     };
 
     // battle result to string mapping
-    BloodSword::StringMap<Battle::Result> ResultMapping = {
+    constexpr auto ResultMapping = BloodSword::Tabulate<Battle::Result, std::string>({
         {Battle::Result::NONE, "NONE"},
         {Battle::Result::DETERMINE, "DETERMINE"},
         {Battle::Result::DEFEAT, "DEFEAT"},
         {Battle::Result::VICTORY, "VICTORY"},
         {Battle::Result::FLEE, "FLEE"},
-        {Battle::Result::ENTHRALLED, "ENTHRALLED"}};
+        {Battle::Result::ENTHRALLED, "ENTHRALLED"}});
 
     // map string to battle result
     Battle::Result MapResult(std::string result)
@@ -39,6 +39,11 @@ namespace BloodSword::BattlepitsRenderer
             // fill entire map
             SDL_FillRect(surface, nullptr, SDL_MapRGBA(surface->format, 255, 255, 255, 255));
 
+            // tile used for empty spaces
+            auto empty_space = Graphics::CreateSurface(BloodSword::TileSize, BloodSword::TileSize);
+
+            SDL_FillRect(empty_space, nullptr, SDL_MapRGBA(surface->format, 0, 0, 0, 255));
+
             for (auto y = 0; y < map.Height; y++)
             {
                 for (auto x = 0; x < map.Width; x++)
@@ -49,28 +54,28 @@ namespace BloodSword::BattlepitsRenderer
 
                     if (tile.Type == Map::Object::EXIT)
                     {
-                        surface_asset = Asset::Surface("SELECT");
+                        surface_asset = Asset::Cached("SELECT");
                     }
                     else if (tile.Asset != Asset::NONE)
                     {
-                        surface_asset = Asset::Surface(tile.Asset);
+                        surface_asset = Asset::Cached(tile.Asset);
                     }
                     else
                     {
                         // fill empty space
-                        surface_asset = Graphics::CreateSurface(BloodSword::TileSize, BloodSword::TileSize);
-
-                        SDL_FillRect(surface_asset, nullptr, SDL_MapRGBA(surface->format, 0, 0, 0, 255));
+                        surface_asset = empty_space;
                     }
 
                     rect.x = x * BloodSword::TileSize + offset;
 
                     rect.y = y * BloodSword::TileSize + offset;
 
-                    Graphics::RenderAssetThenFree(surface, surface_asset, rect);
+                    Graphics::RenderAsset(surface, surface_asset, rect);
                 }
             }
 
+            BloodSword::Free(&empty_space);
+
             IMG_SavePNG(surface, image_file);
 
             SDL_FreeSurface(surface);
@@ -108,10 +108,10 @@ namespace BloodSword::Battlepits
     };
 
     // connection type to string mapping
-    BloodSword::StringMap<Battlepits::Connection> ConnectionMapping = {
+    constexpr auto ConnectionMapping = BloodSword::Tabulate<Battlepits::Connection, std::string>({
         {Connection::NONE, "NONE"},
         {Connection::TUNNELS, "TUNNELS"},
-        {Connection::WALLS, "WALLS"}};
+        {Connection::WALLS, "WALLS"}});
 
     // map string to connection type
     Battlepits::Connection Map(const char *connection)
@@ -192,6 +192,9 @@ namespace BloodSword::Game
             // disable logger
             Logger::Disable();
 
+            // frame time and draw call statistics (--metrics)
+            Metrics::Options(argc, argv);
+
             auto session_name = "BloodSword " + BloodSword::Version();
 
             system.Initialize(session_name.c_str(), "default");
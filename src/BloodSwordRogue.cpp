@@ -5,7 +5,7 @@
 namespace BloodSword::BloodSwordRogue
 {
     // main loop
-    int Main()
+    int Main(int argc, char **argv)
     {
         auto return_code = 0;
 
@@ -16,6 +16,9 @@ namespace BloodSword::BloodSwordRogue
             // disable logger
             Logger::Disable();
 
+            // frame time and draw call statistics (--metrics)
+            Metrics::Options(argc, argv);
+
             system.Initialize("BloodSword: Rogue", "default");
 
             Rogue::Game(system.graphics);
@@ -35,5 +38,5 @@ namespace BloodSword::BloodSwordRogue
 
 int main(int argc, char **argv)
 {
-    return BloodSword::BloodSwordRogue::Main();
+    return BloodSword::BloodSwordRogue::Main(argc, argv);
 }
@@ -1842,6 +1842,9 @@ namespace BloodSword::Test
 
         try
         {
+            // frame time and draw call statistics (--metrics)
+            Metrics::Options(argc, argv);
+
             system.Initialize("BloodSword: Test Suite", "default");
 
             Test::Menu(system.graphics);
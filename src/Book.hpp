@@ -27,22 +27,22 @@ namespace BloodSword::Book
     typedef std::vector<Book::Location> Locations;
 
     // book titles
-    BloodSword::StringMap<Book::Number> Title = {
+    constexpr auto Title = BloodSword::Tabulate<Book::Number, std::string>({
         {Book::Number::NONE, "Blood Sword"},
         {Book::Number::BOOK1, "The Battlepits of Krarth"},
         {Book::Number::BOOK2, "The Kingdom of Wyrd"},
         {Book::Number::BOOK3, "The Demon's Claw"},
         {Book::Number::BOOK4, "Doomwalk"},
-        {Book::Number::BOOK5, "The Walls of Spyte"}};
+        {Book::Number::BOOK5, "The Walls of Spyte"}});
 
     // book number to string mapping
-    BloodSword::StringMap<Book::Number> Mapping = {
+    constexpr auto Mapping = BloodSword::Tabulate<Book::Number, std::string>({
         {Book::Number::NONE, "NONE"},
         {Book::Number::BOOK1, "BOOK1"},
         {Book::Number::BOOK2, "BOOK2"},
         {Book::Number::BOOK3, "BOOK3"},
         {Book::Number::BOOK4, "BOOK4"},
-        {Book::Number::BOOK5, "BOOK5"}};
+        {Book::Number::BOOK5, "BOOK5"}});
 
     // book ranks (max rank per number of players in the party)
     BloodSword::UnorderedMap<Book::Number, std::vector<int>> Ranks = {
@@ -98,6 +98,12 @@ namespace BloodSword::Book
         return ((current.first == next.first) && (current.second == next.second));
     }
 
+    // unique key for book location (used for indexing)
+    long long Key(Book::Location &location)
+    {
+        return (static_cast<long long>(location.first) << 32) | static_cast<unsigned int>(location.second);
+    }
+
     // generate json data for book location
     nlohmann::json Data(Book::Location &location)
     {
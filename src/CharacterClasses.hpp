@@ -15,10 +15,10 @@ namespace BloodSword::Character
     };
 
     // control type to string mapping
-    BloodSword::ConstStrings<Character::ControlType> ControlTypeMapping = {
+    constexpr auto ControlTypeMapping = BloodSword::Tabulate<Character::ControlType>({
         {Character::ControlType::NONE, "NONE"},
         {Character::ControlType::PLAYER, "PLAYER"},
-        {Character::ControlType::NPC, "NPC"}};
+        {Character::ControlType::NPC, "NPC"}});
 
     // map string to control type
     Character::ControlType MapControlType(const char *control_type)
@@ -47,13 +47,13 @@ namespace BloodSword::Character
     typedef std::vector<Character::Class> Classes;
 
     // character class to string mapping
-    BloodSword::StringMap<Character::Class> ClassMapping = {
+    constexpr auto ClassMapping = BloodSword::Tabulate<Character::Class, std::string>({
         {Character::Class::NONE, "NONE"},
         {Character::Class::WARRIOR, "WARRIOR"},
         {Character::Class::TRICKSTER, "TRICKSTER"},
         {Character::Class::SAGE, "SAGE"},
         {Character::Class::ENCHANTER, "ENCHANTER"},
-        {Character::Class::IMRAGARN, "IMRAGARN"}};
+        {Character::Class::IMRAGARN, "IMRAGARN"}});
 
     // all normal character classes
     Character::Classes All = {
@@ -48,7 +48,7 @@ namespace BloodSword::Character
     };
 
     // character status to string mapping
-    BloodSword::StringMap<Character::Status> StatusMapping = {
+    constexpr auto StatusMapping = BloodSword::Tabulate<Character::Status, std::string>({
         {Character::Status::NONE, "NONE"},
         {Character::Status::DEFENDING, "DEFENDING"},
         {Character::Status::DEFENDED, "DEFENDED"},
@@ -85,7 +85,7 @@ namespace BloodSword::Character
         {Character::Status::OSTEAL_WEAKNESS, "OSTEAL WEAKNESS"},
         {Character::Status::SERENITY, "SERENITY"},
         {Character::Status::MELEE, "MELEE"},
-        {Character::Status::RANGED, "RANGED"}};
+        {Character::Status::RANGED, "RANGED"}});
 
     // character status durations
     BloodSword::IntegerMap<Character::Status> Duration = {
@@ -141,7 +141,7 @@ namespace BloodSword::Conditions
     };
 
     // condition type mapping
-    BloodSword::ConstStrings<Conditions::Type> TypeMapping = {
+    constexpr auto TypeMapping = BloodSword::Tabulate<Conditions::Type>({
         {Conditions::Type::NONE, "NONE"},
         {Conditions::Type::NORMAL, "NORMAL"},
         {Conditions::Type::IN_PARTY, "IN PARTY"},
@@ -271,7 +271,7 @@ namespace BloodSword::Conditions
         {Conditions::Type::MUST_GET_ITEM, "MUST GET ITEM"},
         {Conditions::Type::MUST_TAKE_ITEM, "MUST TAKE ITEM"},
         {Conditions::Type::KILL_OTHERS, "KILL OTHERS"},
-        {Conditions::Type::GAIN_DELAYED_EFFECT, "GAIN DELAYED EFFECT"}};
+        {Conditions::Type::GAIN_DELAYED_EFFECT, "GAIN DELAYED EFFECT"}});
 
     // map string to condition type
     Conditions::Type Map(const char *Conditions)
@@ -4,8 +4,12 @@
 #include <algorithm>
 
 #include "nlohmann/json.hpp"
+#include "Attribute.hpp"
 #include "Book.hpp"
+#include "CharacterClasses.hpp"
 #include "ConditionTypes.hpp"
+#include "ItemTypes.hpp"
+#include "Variables.hpp"
 
 namespace BloodSword::Conditions
 {
@@ -22,6 +26,18 @@ namespace BloodSword::Conditions
         // internal variables used to validate "condition"
         std::vector<std::string> Variables = {};
 
+        // internal variables resolved into symbols / literals
+        Variables::Operands Operands = {};
+
+        // internal variables pre-parsed as character classes (NONE if not applicable)
+        std::vector<Character::Class> Characters = {};
+
+        // internal variables pre-parsed as item types (NONE if not applicable)
+        std::vector<Item::Type> Items = {};
+
+        // internal variables pre-parsed as attributes (NONE if not applicable)
+        std::vector<Attribute::Type> Attributes = {};
+
         // flag to indicate that the result (or condition) is inverted
         bool Invert = false;
 
@@ -38,12 +54,18 @@ namespace BloodSword::Conditions
              std::vector<std::string> variables,
              bool invert) : Type(type),
                             Variables(variables),
-                            Invert(invert) {}
+                            Invert(invert)
+        {
+            this->Compile();
+        }
 
         Base(Conditions::Type type,
              Book::Location location,
              std::vector<std::string> variables) : Type(type),
-                                                   Variables(variables) {}
+                                                   Variables(variables)
+        {
+            this->Compile();
+        }
 
         Base(const char *type, Book::Location location, std::vector<std::string> variables, bool invert = false)
         {
@@ -52,6 +74,29 @@ namespace BloodSword::Conditions
             this->Variables = variables;
 
             this->Invert = invert;
+
+            this->Compile();
+        }
+
+        // pre-parse variables so that evaluation does not need to
+        void Compile()
+        {
+            this->Operands = Variables::Resolve(this->Variables);
+
+            this->Characters.clear();
+
+            this->Items.clear();
+
+            this->Attributes.clear();
+
+            for (auto &variable : this->Variables)
+            {
+                this->Characters.push_back(Character::Map(variable));
+
+                this->Items.push_back(Item::Map(variable));
+
+                this->Attributes.push_back(Attribute::Map(variable));
+            }
         }
     };
 
@@ -98,6 +143,15 @@ namespace BloodSword::Conditions
                 condition.Variables = variables;
             }
 
+            // pre-parse variables
+            condition.Compile();
+
+            // unknown types are reported here rather than mid-story
+            if (condition.Type == Conditions::Type::NONE && !data["type"].is_null())
+            {
+                SDL_Log("[CONDITION] UNKNOWN TYPE: %s", std::string(data["type"]).c_str());
+            }
+
             // set invert condition
             condition.Invert = (!data["invert"].is_null() && data["invert"].is_boolean()) ? data["invert"].get<bool>() : false;
         }
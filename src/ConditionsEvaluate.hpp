@@ -41,344 +41,574 @@ namespace BloodSword::Conditions
         Interface::InternalError(graphics, background, message);
     }
 
-    // routine to validate "condition"
-    Conditions::Evaluation Process(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition)
+    // intermediate results while evaluating a condition
+    class State
     {
-        auto result = false;
+    public:
+        bool Result = false;
 
-        auto failed = false;
+        bool Failed = false;
+
+        bool InternalError = false;
 
-        auto internal_error = false;
+        // text (usually on failure)
+        std::string Text = std::string();
+    };
 
-        auto text = std::string();
+    // condition handler
+    typedef void (*Handler)(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state);
+}
 
-        if (condition.Type == Conditions::Type::NORMAL)
-        {
-            result = true;
+// handlers for each condition type
+namespace BloodSword::Conditions::Handlers
+{
+    // NORMAL
+    void Normal(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
 
-            // variables
-            // 0 - text to display (when used in an event)
-            if (SafeCast(condition.Variables.size()) > 0 && !condition.Variables[0].empty())
-            {
-                text = condition.Variables[0];
-            }
+        auto &text = state.Text;
+
+        result = true;
+
+        // variables
+        // 0 - text to display (when used in an event)
+        if (SafeCast(condition.Variables.size()) > 0 && !condition.Variables[0].empty())
+        {
+            text = condition.Variables[0];
         }
-        else if (condition.Type == Conditions::Type::IN_PARTY)
+    }
+
+    // IN PARTY
+    void InParty(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables
+        // 0 - player
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
         {
-            internal_error = true;
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
 
-            // variables
-            // 0 - player
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
+            if (character != Character::Class::NONE)
             {
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+                result = party.Has(character);
 
-                if (character != Character::Class::NONE)
+                if (!result)
                 {
-                    result = party.Has(character);
-
-                    if (!result)
-                    {
-                        text = Engine::NotInParty(character);
-                    }
-                    else if (!Engine::IsAlive(party[character]))
-                    {
-                        text = Engine::IsDead(party[character]);
-
-                        result = false;
-                    }
+                    text = Engine::NotInParty(character);
+                }
+                else if (!Engine::IsAlive(party[character]))
+                {
+                    text = Engine::IsDead(party[character]);
 
-                    internal_error = false;
+                    result = false;
                 }
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::ADD_CHARACTER)
+    }
+
+    // ADD CHARACTER
+    void AddCharacter(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        internal_error = true;
+
+        // variables
+        // 0 - player
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
         {
-            internal_error = true;
+            auto character = condition.Characters[0];
 
-            // variables
-            // 0 - player
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
+            if (character != Character::Class::NONE)
             {
-                auto character = Character::Map(condition.Variables[0]);
+                result = Party::Characters.Has(character);
 
-                if (character != Character::Class::NONE)
+                if (result)
                 {
-                    result = Party::Characters.Has(character);
-
-                    if (result)
+                    if (!party.Has(character) && Character::OtherClass(character))
                     {
-                        if (!party.Has(character) && Character::OtherClass(character))
-                        {
-                            party.Add(Party::Characters[character]);
-                        }
-
-                        internal_error = false;
+                        party.Add(Party::Characters[character]);
                     }
+
+                    internal_error = false;
                 }
             }
         }
-        else if (condition.Type == Conditions::Type::IS_DEAD)
+    }
+
+    // IS DEAD
+    void IsDead(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables
+        // 0 - player
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
         {
-            internal_error = true;
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
 
-            // variables
-            // 0 - player
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
+            if (character != Character::Class::NONE)
             {
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
-
-                if (character != Character::Class::NONE)
+                if (party.Has(character))
                 {
-                    if (party.Has(character))
+                    if (!Engine::IsAlive(party[character]))
                     {
-                        if (!Engine::IsAlive(party[character]))
-                        {
-                            result = true;
-                        }
-                        else
-                        {
-                            text = party[character].Name + " IS NOT DEAD";
-                        }
+                        result = true;
                     }
-                    else if (!Engine::IsAlive(party[character]))
+                    else
                     {
-                        text = Engine::NotInParty(character);
+                        text = party[character].Name + " IS NOT DEAD";
                     }
-
-                    internal_error = false;
                 }
+                else if (!Engine::IsAlive(party[character]))
+                {
+                    text = Engine::NotInParty(character);
+                }
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::CHOSEN_PLAYER)
+    }
+
+    // CHOSEN PLAYER
+    void ChosenPlayer(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables
+        // 0 - player to check if they were chosen
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
         {
-            internal_error = true;
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+
+            result = (party.ChosenCharacter == character);
 
-            // variables
-            // 0 - player to check if they were chosen
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
+            if (!result)
             {
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+                text = std::string("YOU HAVE CHOSEN A DIFFERENT PLAYER!");
+            }
 
-                result = (party.ChosenCharacter == character);
+            internal_error = false;
+        }
+    }
+
+    // CHOSEN NUMBER
+    void ChosenNumber(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables
+        // 0 - number
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
+        {
+            auto number = party.Number(condition.Operands[0]);
+
+            result = (party.ChosenNumber == number);
+
+            if (!result)
+            {
+                text = std::string("YOU HAVE CHOSEN A DIFFERENT NUMBER!");
+            }
+
+            internal_error = false;
+        }
+    }
+
+    // PARTY HAS ITEM
+    void PartyHasItem(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables
+        // 0 - item
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
+        {
+            auto item = condition.Items[0];
+
+            if (item != Item::Type::NONE)
+            {
+                result = party.Has(item);
 
                 if (!result)
                 {
-                    text = std::string("YOU HAVE CHOSEN A DIFFERENT PLAYER!");
+                    text = Engine::NoItem(item);
                 }
 
                 internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::CHOSEN_NUMBER)
+    }
+
+    // ITEM IN ENVIRONMENT / ITEM IN SECTION
+    void ItemInEnvironment(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables
+        // 0 - item
+        // 1 - message if found
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 1)
         {
-            internal_error = true;
+            auto current = Story::CurrentBook.Find(party.Location);
 
-            // variables
-            // 0 - number
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
+            auto item = condition.Items[0];
+
+            if (item != Item::Type::NONE && current >= 0 && current < SafeCast(Story::CurrentBook.Sections.size()))
             {
-                auto number = party.Number(condition.Variables[0]);
+                auto &section = Story::CurrentBook[current];
 
-                result = (party.ChosenNumber == number);
+                result = (SafeCast(section.Items.size()) > 0 && Items::Find(section.Items, item) != section.Items.end());
 
-                if (!result)
+                if (result)
                 {
-                    text = std::string("YOU HAVE CHOSEN A DIFFERENT NUMBER!");
+                    text = condition.Variables[1];
                 }
 
                 internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::PARTY_HAS_ITEM)
+    }
+
+    // DROP ITEM
+    void DropItem(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables
+        // 0 - player / ALL
+        // 1 - item
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 1)
         {
-            internal_error = true;
+            auto is_party = (Engine::ToUpper(condition.Variables[0]) == "ALL");
 
-            // variables
-            // 0 - item
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
-            {
-                auto item = Item::Map(condition.Variables[0]);
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
 
-                if (item != Item::Type::NONE)
+            auto item = condition.Items[1];
+
+            if (item != Item::Type::NONE && (is_party || character != Character::Class::NONE))
+            {
+                if (is_party || (party.Has(character) && Engine::IsAlive(party[character])))
                 {
-                    result = party.Has(item);
+                    result = is_party ? party.Has(item) : party[character].Has(item);
 
                     if (!result)
                     {
                         text = Engine::NoItem(item);
                     }
-
-                    internal_error = false;
+                    else
+                    {
+                        if (is_party)
+                        {
+                            party.Remove(item);
+                        }
+                        else
+                        {
+                            party[character].Remove(item);
+                        }
+                    }
+                }
+                else if (!party.Has(character))
+                {
+                    text = Engine::NotInParty(character);
+                }
+                else if (!Engine::IsAlive(party[character]))
+                {
+                    text = Engine::IsDead(party[character]);
                 }
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::ITEM_IN_ENVIRONMENT || condition.Type == Conditions::Type::ITEM_IN_SECTION)
+    }
+
+    // HAS ITEM
+    void HasItem(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables
+        // 0 - player / ALL
+        // 1 - item
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 1)
         {
-            internal_error = true;
+            auto is_party = (Engine::ToUpper(condition.Variables[0]) == "ALL");
 
-            // variables
-            // 0 - item
-            // 1 - message if found
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 1)
-            {
-                auto current = Story::CurrentBook.Find(party.Location);
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0], Interface::Mode::ITEMS);
 
-                auto item = Item::Map(condition.Variables[0]);
+            auto item = condition.Items[1];
 
-                if (item != Item::Type::NONE && current >= 0 && current < SafeCast(Story::CurrentBook.Sections.size()))
+            if (item != Item::Type::NONE && (is_party || character != Character::Class::NONE))
+            {
+                if (is_party || (party.Has(character) && Engine::IsAlive(party[character])))
                 {
-                    auto &section = Story::CurrentBook.Sections[current];
+                    result = is_party ? party.Has(item) : party[character].Has(item);
 
-                    result = (SafeCast(section.Items.size()) > 0 && Items::Find(section.Items, item) != section.Items.end());
-
-                    if (result)
+                    if (!result)
                     {
-                        text = condition.Variables[1];
+                        text = Engine::NoItem(item);
                     }
-
-                    internal_error = false;
                 }
+                else if (!party.Has(character))
+                {
+                    text = Engine::NotInParty(character);
+                }
+                else if (party.Has(character) && !Engine::IsAlive(party[character]))
+                {
+                    text = Engine::IsDead(party[character]);
+                }
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::DROP_ITEM)
+    }
+
+    // HAS ALL ITEMS
+    void HasAllItems(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables
+        // 0 - player / ALL
+        // 1 - N items
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 1)
         {
-            internal_error = true;
+            auto is_party = (Engine::ToUpper(condition.Variables[0]) == "ALL");
 
-            // variables
-            // 0 - player / ALL
-            // 1 - item
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 1)
-            {
-                auto is_party = (Engine::ToUpper(condition.Variables[0]) == "ALL");
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
 
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+            auto items = Items::List();
 
-                auto item = Item::Map(condition.Variables[1]);
+            for (auto i = 1; i < SafeCast(condition.Variables.size()); i++)
+            {
+                auto item = condition.Items[i];
+
+                if (item != Item::Type::NONE)
+                {
+                    items.push_back(item);
+                }
+            }
 
-                if (item != Item::Type::NONE && (is_party || character != Character::Class::NONE))
+            if ((SafeCast(items.size()) > 0 && SafeCast(items.size()) == (SafeCast(condition.Variables.size()) - 1)) && (is_party || character != Character::Class::NONE))
+            {
+                if (is_party || (party.Has(character) && Engine::IsAlive(party[character])))
                 {
-                    if (is_party || (party.Has(character) && Engine::IsAlive(party[character])))
+                    result = is_party ? party.HasAll(items) : party[character].HasAll(items);
+
+                    if (!result)
                     {
-                        result = is_party ? party.Has(item) : party[character].Has(item);
+                        auto item_string = std::string();
 
-                        if (!result)
-                        {
-                            text = Engine::NoItem(item);
-                        }
-                        else
+                        for (auto &item : items)
                         {
-                            if (is_party)
-                            {
-                                party.Remove(item);
-                            }
-                            else
+                            if (!item_string.empty())
                             {
-                                party[character].Remove(item);
+                                item_string += ", ";
                             }
+
+                            item_string += Item::TypeMapping[item];
                         }
-                    }
-                    else if (!party.Has(character))
-                    {
-                        text = Engine::NotInParty(character);
-                    }
-                    else if (!Engine::IsAlive(party[character]))
-                    {
-                        text = Engine::IsDead(party[character]);
-                    }
 
-                    internal_error = false;
+                        text = "YOU DO NOT HAVE ALL OF THE " + item_string;
+                    }
                 }
+                else if (!party.Has(character))
+                {
+                    text = Engine::NotInParty(character);
+                }
+                else if (!Engine::IsAlive(party[character]))
+                {
+                    text = Engine::IsDead(party[character]);
+                }
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::HAS_ITEM)
+    }
+
+    // COUNT ITEMS
+    void CountItems(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables
+        // 0 - player / ALL
+        // 1 - item
+        // 2 - number required
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 2)
         {
-            internal_error = true;
+            auto is_party = (Engine::ToUpper(condition.Variables[0]) == "ALL");
 
-            // variables
-            // 0 - player / ALL
-            // 1 - item
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 1)
-            {
-                auto is_party = (Engine::ToUpper(condition.Variables[0]) == "ALL");
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
 
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0], Interface::Mode::ITEMS);
+            auto item = condition.Items[1];
 
-                auto item = Item::Map(condition.Variables[1]);
+            auto required = party.Number(condition.Operands[2]);
 
-                if (item != Item::Type::NONE && (is_party || character != Character::Class::NONE))
-                {
-                    if (is_party || (party.Has(character) && Engine::IsAlive(party[character])))
-                    {
-                        result = is_party ? party.Has(item) : party[character].Has(item);
+            if (item != Item::Type::NONE && (is_party || character != Character::Class::NONE) && required > 0)
+            {
+                auto count = (is_party ? Engine::Count(party, item) : party[character].Count(item));
 
-                        if (!result)
-                        {
-                            text = Engine::NoItem(item);
-                        }
-                    }
-                    else if (!party.Has(character))
+                result = count >= required;
+
+                if (!result)
+                {
+                    if (count == 0)
                     {
-                        text = Engine::NotInParty(character);
+                        text = Engine::NoItem(item);
                     }
-                    else if (party.Has(character) && !Engine::IsAlive(party[character]))
+                    else
                     {
-                        text = Engine::IsDead(party[character]);
+                        text = Engine::NotEnough(item);
                     }
-
-                    internal_error = false;
                 }
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::HAS_ALL_ITEMS)
-        {
-            internal_error = true;
+    }
 
-            // variables
-            // 0 - player / ALL
-            // 1 - N items
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 1)
-            {
-                auto is_party = (Engine::ToUpper(condition.Variables[0]) == "ALL");
+    // REVEAL ITEM
+    void RevealItem(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
 
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+        auto &internal_error = state.InternalError;
 
-                auto items = Items::List();
+        auto &text = state.Text;
 
-                for (auto i = 1; i < SafeCast(condition.Variables.size()); i++)
-                {
-                    auto item = Item::Map(condition.Variables[i]);
+        internal_error = true;
 
-                    if (item != Item::Type::NONE)
-                    {
-                        items.push_back(item);
-                    }
-                }
+        // variables
+        // 0 - item
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
+        {
+            auto item = condition.Items[0];
 
-                if ((SafeCast(items.size()) > 0 && SafeCast(items.size()) == (SafeCast(condition.Variables.size()) - 1)) && (is_party || character != Character::Class::NONE))
+            if (item != Item::Type::NONE)
+            {
+                result = party.Has(item);
+
+                if (!result)
+                {
+                    text = Engine::NoItem(item);
+                }
+                else
                 {
-                    if (is_party || (party.Has(character) && Engine::IsAlive(party[character])))
+                    for (auto i = 0; i < party.Count(); i++)
                     {
-                        result = is_party ? party.HasAll(items) : party[character].HasAll(items);
-
-                        if (!result)
+                        if (Engine::IsAlive(party[i]))
                         {
-                            auto item_string = std::string();
-
-                            for (auto &item : items)
+                            for (auto &this_item : party[i].Items)
                             {
-                                if (!item_string.empty())
+                                if (this_item.Is(item))
                                 {
-                                    item_string += ", ";
+                                    this_item.Reveal();
                                 }
-
-                                item_string += Item::TypeMapping[item];
                             }
-
-                            text = "YOU DO NOT HAVE ALL OF THE " + item_string;
                         }
                     }
-                    else if (!party.Has(character))
+
+                    result = true;
+                }
+
+                internal_error = false;
+            }
+        }
+    }
+
+    // IN PARTY WITH ITEM
+    void InPartyWithItem(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables
+        // 0 - player
+        // 1 - item
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 1)
+        {
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+
+            auto item = condition.Items[1];
+
+            if (character != Character::Class::NONE && item != Item::Type::NONE)
+            {
+                result = party.Has(character) && Engine::IsAlive(party[character]) && party.Has(item);
+
+                if (!result)
+                {
+                    if (!(party.Has(character)))
                     {
                         text = Engine::NotInParty(character);
                     }
@@ -386,166 +616,320 @@ namespace BloodSword::Conditions
                     {
                         text = Engine::IsDead(party[character]);
                     }
-
-                    internal_error = false;
+                    else
+                    {
+                        text = Engine::NoItem(item);
+                    }
                 }
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::COUNT_ITEMS)
+    }
+
+    // TEST ATTRIBUTE
+    void TestAttribute(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &failed = state.Failed;
+
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables
+        // 0 - player
+        // 1 - attribute
+        // 2 - failure message
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 2)
         {
-            internal_error = true;
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
 
-            // variables
-            // 0 - player / ALL
-            // 1 - item
-            // 2 - number required
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 2)
+            auto attribute = condition.Attributes[1];
+
+            if (character != Character::Class::NONE && attribute != Attribute::Type::NONE && !Book::IsUndefined(condition.Failure))
             {
-                auto is_party = (Engine::ToUpper(condition.Variables[0]) == "ALL");
+                if (!party.Has(character))
+                {
+                    text = Engine::NotInParty(character);
+                }
+                else if (!Engine::IsAlive(party[character]))
+                {
+                    text = Engine::IsDead(party[character]);
+                }
+                else
+                {
+                    auto test = Interface::Test(graphics, background, party[character], attribute);
 
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+                    if (!test)
+                    {
+                        failed = true;
+
+                        text = condition.Variables[2];
+                    }
+                    else
+                    {
+                        result = true;
+                    }
+                }
+
+                internal_error = false;
+            }
+        }
+    }
 
-                auto item = Item::Map(condition.Variables[1]);
+    // LOSE ALL
+    void LoseAll(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
 
-                auto required = party.Number(condition.Variables[2]);
+        auto &internal_error = state.InternalError;
 
-                if (item != Item::Type::NONE && (is_party || character != Character::Class::NONE) && required > 0)
-                {
-                    auto count = (is_party ? Engine::Count(party, item) : party[character].Count(item));
+        auto &text = state.Text;
 
-                    result = count >= required;
+        internal_error = true;
 
-                    if (!result)
+        // variables
+        // 0 - player
+        // 1 - item
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 1)
+        {
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+
+            auto item = condition.Items[1];
+
+            if (item != Item::Type::NONE && character != Character::Class::NONE)
+            {
+                if (!party.Has(character))
+                {
+                    text = Engine::NotInParty(character);
+                }
+                else if (party.Has(character))
+                {
+                    if (!Engine::IsAlive(party[character]))
                     {
-                        if (count == 0)
+                        if (party[character].Quantity(item) > 0)
                         {
-                            text = Engine::NoItem(item);
+                            result = true;
+
+                            party[character].Remove(item, party[character].Quantity(item));
+
+                            text = "YOU LOSE ALL " + Item::TypeMapping[item] + "!";
                         }
                         else
                         {
-                            text = Engine::NotEnough(item);
+                            text = "YOU DO NOT HAVE ANY " + Item::TypeMapping[item] + "!";
                         }
                     }
-
-                    internal_error = false;
+                    else
+                    {
+                        text = Engine::IsDead(party[character]);
+                    }
                 }
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::REVEAL_ITEM)
+    }
+
+    // BATTLE VICTORY
+    void BattleVictory(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &text = state.Text;
+
+        if (Engine::IsAlive(party))
         {
-            internal_error = true;
+            result = (party.LastBattle == Battle::Result::VICTORY);
 
-            // variables
-            // 0 - item
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
+            if (!result)
             {
-                auto item = Item::Map(condition.Variables[0]);
+                text = "YOU WERE NOT VICTORIOUS IN THE LAST BATTLE!";
+            }
+        }
+    }
 
-                if (item != Item::Type::NONE)
-                {
-                    result = party.Has(item);
+    // BATTLE FLEE
+    void BattleFlee(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
 
-                    if (!result)
-                    {
-                        text = Engine::NoItem(item);
-                    }
-                    else
-                    {
-                        for (auto i = 0; i < party.Count(); i++)
-                        {
-                            if (Engine::IsAlive(party[i]))
-                            {
-                                for (auto &this_item : party[i].Items)
-                                {
-                                    if (this_item.Is(item))
-                                    {
-                                        this_item.Reveal();
-                                    }
-                                }
-                            }
-                        }
+        auto &text = state.Text;
 
-                        result = true;
-                    }
+        if (Engine::IsAlive(party))
+        {
+            result = (party.LastBattle == Battle::Result::FLEE);
 
-                    internal_error = false;
+            if (!result)
+            {
+                text = "YOU DID NOT FLEE IN YOUR LAST BATTLE!";
+            }
+        }
+    }
+
+    // BATTLE ENTHRALMENT
+    void BattleEnthralment(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &text = state.Text;
+
+        if (Engine::IsAlive(party))
+        {
+            result = (party.LastBattle == Battle::Result::ENTHRALLED);
+
+            if (!result)
+            {
+                text = "YOU HAVE NOT SUBDUED YOUR OPPONENTS!";
+            }
+        }
+    }
+
+    // BATTLE VICTORY OR ENTHRALMENT
+    void BattleVictoryOrEnthralment(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &text = state.Text;
+
+        if (Engine::IsAlive(party))
+        {
+            result = (party.LastBattle == Battle::Result::ENTHRALLED || party.LastBattle == Battle::Result::VICTORY);
+
+            if (!result)
+            {
+                text = "YOU WERE NOT VICTORIOUS IN THE LAST BATTLE!";
+            }
+        }
+    }
+
+    // HAVE COLLEAGUES
+    void HaveColleagues(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &text = state.Text;
+
+        if (Engine::IsAlive(party))
+        {
+            result = (Engine::Count(party) > 1);
+
+            if (result)
+            {
+                // variables (when used in an event):
+                // 0 - text to display on success
+                if (SafeCast(condition.Variables.size()) > 0)
+                {
+                    text = condition.Variables[0];
                 }
             }
+            else
+            {
+                // when used in a choice
+                text = "YOU ARE ALONE!";
+            }
         }
-        else if (condition.Type == Conditions::Type::IN_PARTY_WITH_ITEM)
+    }
+
+    // SOLO
+    void Solo(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &text = state.Text;
+
+        if (Engine::IsAlive(party))
         {
-            internal_error = true;
+            result = (Engine::Count(party) == 1);
 
-            // variables
-            // 0 - player
-            // 1 - item
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 1)
+            if (result)
             {
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+                // variables (when used in an event):
+                // 0 - text to display on success
+                if (SafeCast(condition.Variables.size()) > 0)
+                {
+                    text = condition.Variables[0];
+                }
+            }
+            else
+            {
+                text = "YOU ARE NOT ALONE!";
+            }
+        }
+    }
+
+    // GAIN STATUS
+    void GainStatus(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
 
-                auto item = Item::Map(condition.Variables[1]);
+        auto &internal_error = state.InternalError;
 
-                if (character != Character::Class::NONE && item != Item::Type::NONE)
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables
+        // 0 - player (or ALL)
+        // 1 - status
+        // 2 - TRUE/FALSE hide message (optional)
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 1)
+        {
+            auto status = Character::MapStatus(condition.Variables[1]);
+
+            if (Engine::ToUpper(condition.Variables[0]) == "ALL")
+            {
+                if (status != Character::Status::NONE && Engine::IsAlive(party))
                 {
-                    result = party.Has(character) && Engine::IsAlive(party[character]) && party.Has(item);
+                    // entire party gains status
+                    party.Add(status);
 
-                    if (!result)
+                    result = true;
+
+                    if (SafeCast(condition.Variables.size()) < 2 || (SafeCast(condition.Variables.size()) > 2 && Engine::ToUpper(condition.Variables[2]) != "TRUE"))
                     {
-                        if (!(party.Has(character)))
-                        {
-                            text = Engine::NotInParty(character);
-                        }
-                        else if (!Engine::IsAlive(party[character]))
+                        if (Engine::Count(party) > 1)
                         {
-                            text = Engine::IsDead(party[character]);
+                            text = "EVERYONE GAINS [" + Character::StatusMapping[status] + "]";
                         }
                         else
                         {
-                            text = Engine::NoItem(item);
+                            text = "YOU GAIN [" + Character::StatusMapping[status] + "]";
                         }
                     }
 
                     internal_error = false;
                 }
             }
-        }
-        else if (condition.Type == Conditions::Type::TEST_ATTRIBUTE)
-        {
-            internal_error = true;
-
-            // variables
-            // 0 - player
-            // 1 - attribute
-            // 2 - failure message
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 2)
+            else
             {
                 auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
 
-                auto attribute = Attribute::Map(condition.Variables[1]);
-
-                if (character != Character::Class::NONE && attribute != Attribute::Type::NONE && !Book::IsUndefined(condition.Failure))
+                if (character != Character::Class::NONE && status != Character::Status::NONE)
                 {
-                    if (!party.Has(character))
+                    result = party.Has(character);
+
+                    if (!result)
                     {
                         text = Engine::NotInParty(character);
                     }
                     else if (!Engine::IsAlive(party[character]))
                     {
                         text = Engine::IsDead(party[character]);
+
+                        result = false;
                     }
                     else
                     {
-                        auto test = Interface::Test(graphics, background, party[character], attribute);
-
-                        if (!test)
-                        {
-                            failed = true;
+                        party[character].Add(status);
 
-                            text = condition.Variables[2];
-                        }
-                        else
+                        if (SafeCast(condition.Variables.size()) < 2 || (SafeCast(condition.Variables.size()) > 2 && Engine::ToUpper(condition.Variables[2]) != "TRUE"))
                         {
-                            result = true;
+                            text = party[character].Name + " GAINS [" + Character::StatusMapping[status] + "]";
                         }
                     }
 
@@ -553,277 +937,255 @@ namespace BloodSword::Conditions
                 }
             }
         }
-        else if (condition.Type == Conditions::Type::LOSE_ALL)
-        {
-            internal_error = true;
+    }
 
-            // variables
-            // 0 - player
-            // 1 - item
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 1)
-            {
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+    // LOSE STATUS
+    void LoseStatus(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
 
-                auto item = Item::Map(condition.Variables[1]);
+        // variables
+        // 0 - player (or ALL)
+        // 1 - status
+        // 2 - TRUE/FALSE hide message (optional)
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 1)
+        {
+            auto status = Character::MapStatus(condition.Variables[1]);
 
-                if (item != Item::Type::NONE && character != Character::Class::NONE)
+            if (Engine::ToUpper(condition.Variables[0]) == "ALL")
+            {
+                if (status != Character::Status::NONE && Engine::IsAlive(party))
                 {
-                    if (!party.Has(character))
-                    {
-                        text = Engine::NotInParty(character);
-                    }
-                    else if (party.Has(character))
+                    if (party.Has(status))
                     {
-                        if (!Engine::IsAlive(party[character]))
-                        {
-                            if (party[character].Quantity(item) > 0)
-                            {
-                                result = true;
+                        // remove status from entire party
+                        party.Remove(status);
 
-                                party[character].Remove(item, party[character].Quantity(item));
+                        result = true;
 
-                                text = "YOU LOSE ALL " + Item::TypeMapping[item] + "!";
+                        if (SafeCast(condition.Variables.size()) < 2 || (SafeCast(condition.Variables.size()) > 2 && Engine::ToUpper(condition.Variables[2]) != "TRUE"))
+                        {
+                            if (Engine::Count(party) > 1)
+                            {
+                                text = "EVERYONE LOSES [" + Character::StatusMapping[status] + "]";
                             }
                             else
                             {
-                                text = "YOU DO NOT HAVE ANY " + Item::TypeMapping[item] + "!";
+                                text = "YOU LOSE [" + Character::StatusMapping[status] + "]";
                             }
                         }
-                        else
-                        {
-                            text = Engine::IsDead(party[character]);
-                        }
                     }
 
                     internal_error = false;
                 }
             }
-        }
-        else if (condition.Type == Conditions::Type::BATTLE_VICTORY)
-        {
-            if (Engine::IsAlive(party))
-            {
-                result = (party.LastBattle == Battle::Result::VICTORY);
-
-                if (!result)
-                {
-                    text = "YOU WERE NOT VICTORIOUS IN THE LAST BATTLE!";
-                }
-            }
-        }
-        else if (condition.Type == Conditions::Type::BATTLE_FLEE)
-        {
-            if (Engine::IsAlive(party))
+            else
             {
-                result = (party.LastBattle == Battle::Result::FLEE);
+                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
 
-                if (!result)
+                if (character != Character::Class::NONE && status != Character::Status::NONE)
                 {
-                    text = "YOU DID NOT FLEE IN YOUR LAST BATTLE!";
-                }
-            }
-        }
-        else if (condition.Type == Conditions::Type::BATTLE_ENTHRALMENT)
-        {
-            if (Engine::IsAlive(party))
-            {
-                result = (party.LastBattle == Battle::Result::ENTHRALLED);
+                    result = party.Has(character);
 
-                if (!result)
-                {
-                    text = "YOU HAVE NOT SUBDUED YOUR OPPONENTS!";
-                }
-            }
-        }
-        else if (condition.Type == Conditions::Type::BATTLE_VICTORY_OR_ENTHRALMENT)
-        {
-            if (Engine::IsAlive(party))
-            {
-                result = (party.LastBattle == Battle::Result::ENTHRALLED || party.LastBattle == Battle::Result::VICTORY);
+                    if (!result)
+                    {
+                        text = Engine::NotInParty(character);
+                    }
+                    else if (!Engine::IsAlive(party[character]))
+                    {
+                        text = Engine::IsDead(party[character]);
 
-                if (!result)
-                {
-                    text = "YOU WERE NOT VICTORIOUS IN THE LAST BATTLE!";
+                        result = false;
+                    }
+                    else if (party[character].Has(status))
+                    {
+                        party[character].Remove(status);
+
+                        if (SafeCast(condition.Variables.size()) < 2 || (SafeCast(condition.Variables.size()) > 2 && Engine::ToUpper(condition.Variables[2]) != "TRUE"))
+                        {
+                            text = party[character].Name + " LOSES [" + Character::StatusMapping[status] + "]";
+                        }
+                    }
+
+                    internal_error = false;
                 }
             }
         }
-        else if (condition.Type == Conditions::Type::HAVE_COLLEAGUES)
+    }
+
+    // FIRST
+    void First(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
         {
-            if (Engine::IsAlive(party))
-            {
-                result = (Engine::Count(party) > 1);
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
 
-                if (result)
+            if (character != Character::Class::NONE)
+            {
+                if (!party.Has(character))
                 {
-                    // variables (when used in an event):
-                    // 0 - text to display on success
-                    if (SafeCast(condition.Variables.size()) > 0)
-                    {
-                        text = condition.Variables[0];
-                    }
+                    text = Engine::NotInParty(character);
                 }
                 else
                 {
-                    // when used in a choice
-                    text = "YOU ARE ALONE!";
-                }
-            }
-        }
-        else if (condition.Type == Conditions::Type::SOLO)
-        {
-            if (Engine::IsAlive(party))
-            {
-                result = (Engine::Count(party) == 1);
+                    for (auto i = 0; i < party.Count(); i++)
+                    {
+                        if (Engine::IsAlive(party[i]))
+                        {
+                            result = (party[i].Class == character);
 
-                if (result)
-                {
-                    // variables (when used in an event):
-                    // 0 - text to display on success
-                    if (SafeCast(condition.Variables.size()) > 0)
+                            break;
+                        }
+                    }
+
+                    if (!result)
                     {
-                        text = condition.Variables[0];
+                        text = Character::ClassMapping[character] + " NOT THE FIRST IN BATTLE ORDER!";
                     }
                 }
-                else
-                {
-                    text = "YOU ARE NOT ALONE!";
-                }
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::GAIN_STATUS)
-        {
-            internal_error = true;
+    }
 
-            // variables
-            // 0 - player (or ALL)
-            // 1 - status
-            // 2 - TRUE/FALSE hide message (optional)
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 1)
-            {
-                auto status = Character::MapStatus(condition.Variables[1]);
+    // LAST
+    void Last(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
 
-                if (Engine::ToUpper(condition.Variables[0]) == "ALL")
-                {
-                    if (status != Character::Status::NONE && Engine::IsAlive(party))
-                    {
-                        // entire party gains status
-                        party.Add(status);
+        auto &internal_error = state.InternalError;
 
-                        result = true;
+        auto &text = state.Text;
 
-                        if (SafeCast(condition.Variables.size()) < 2 || (SafeCast(condition.Variables.size()) > 2 && Engine::ToUpper(condition.Variables[2]) != "TRUE"))
-                        {
-                            if (Engine::Count(party) > 1)
-                            {
-                                text = "EVERYONE GAINS [" + Character::StatusMapping[status] + "]";
-                            }
-                            else
-                            {
-                                text = "YOU GAIN [" + Character::StatusMapping[status] + "]";
-                            }
-                        }
+        internal_error = true;
 
-                        internal_error = false;
-                    }
+        // variables
+        // 0 - player
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
+        {
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+
+            if (character != Character::Class::NONE)
+            {
+                if (!party.Has(character))
+                {
+                    text = Engine::NotInParty(character);
                 }
                 else
                 {
-                    auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
-
-                    if (character != Character::Class::NONE && status != Character::Status::NONE)
+                    for (auto i = (party.Count() - 1); i >= 0; i--)
                     {
-                        result = party.Has(character);
-
-                        if (!result)
-                        {
-                            text = Engine::NotInParty(character);
-                        }
-                        else if (!Engine::IsAlive(party[character]))
-                        {
-                            text = Engine::IsDead(party[character]);
-
-                            result = false;
-                        }
-                        else
+                        if (Engine::IsAlive(party[i]))
                         {
-                            party[character].Add(status);
+                            result = (party[i].Class == character);
 
-                            if (SafeCast(condition.Variables.size()) < 2 || (SafeCast(condition.Variables.size()) > 2 && Engine::ToUpper(condition.Variables[2]) != "TRUE"))
-                            {
-                                text = party[character].Name + " GAINS [" + Character::StatusMapping[status] + "]";
-                            }
+                            break;
                         }
+                    }
 
-                        internal_error = false;
+                    if (!result)
+                    {
+                        text = Character::ClassMapping[character] + " NOT THE LAST IN BATTLE ORDER!";
                     }
                 }
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::LOSE_STATUS)
+    }
+
+    // TEST GAIN STATUS
+    void TestGainStatus(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables
+        // 0 - player (or ALL)
+        // 1 - attribute
+        // 2 - status gain on success
+        // 3 - status gain on failure
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 3)
         {
-            internal_error = true;
+            auto attribute = condition.Attributes[1];
 
-            // variables
-            // 0 - player (or ALL)
-            // 1 - status
-            // 2 - TRUE/FALSE hide message (optional)
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 1)
-            {
-                auto status = Character::MapStatus(condition.Variables[1]);
+            auto status_success = Character::MapStatus(condition.Variables[2]);
+
+            auto status_fail = Character::MapStatus(condition.Variables[3]);
 
+            if (attribute != Attribute::Type::NONE && status_fail != Character::Status::NONE)
+            {
                 if (Engine::ToUpper(condition.Variables[0]) == "ALL")
                 {
-                    if (status != Character::Status::NONE && Engine::IsAlive(party))
+                    result = true;
+
+                    for (auto character = 0; character < party.Count(); character++)
                     {
-                        if (party.Has(status))
+                        if (Engine::IsAlive(party[character]))
                         {
-                            // remove status from entire party
-                            party.Remove(status);
-
-                            result = true;
-
-                            if (SafeCast(condition.Variables.size()) < 2 || (SafeCast(condition.Variables.size()) > 2 && Engine::ToUpper(condition.Variables[2]) != "TRUE"))
+                            if (Interface::Test(graphics, background, party[character], attribute))
                             {
-                                if (Engine::Count(party) > 1)
+                                if (status_success != Character::Status::NONE)
                                 {
-                                    text = "EVERYONE LOSES [" + Character::StatusMapping[status] + "]";
-                                }
-                                else
-                                {
-                                    text = "YOU LOSE [" + Character::StatusMapping[status] + "]";
+                                    party[character].Add(status_success);
                                 }
                             }
+                            else
+                            {
+                                party[character].Add(status_fail);
+                            }
                         }
-
-                        internal_error = false;
                     }
+
+                    internal_error = false;
                 }
                 else
                 {
                     auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
 
-                    if (character != Character::Class::NONE && status != Character::Status::NONE)
+                    if (character != Character::Class::NONE)
                     {
-                        result = party.Has(character);
+                        if (party.Has(character) && Engine::IsAlive(party[character]))
+                        {
+                            result = true;
 
-                        if (!result)
+                            if (Interface::Test(graphics, background, party[character], attribute))
+                            {
+                                party[character].Add(status_success);
+                            }
+                            else
+                            {
+                                party[character].Add(status_fail);
+                            }
+                        }
+                        else if (!party.Has(character))
                         {
                             text = Engine::NotInParty(character);
                         }
                         else if (!Engine::IsAlive(party[character]))
                         {
                             text = Engine::IsDead(party[character]);
-
-                            result = false;
-                        }
-                        else if (party[character].Has(status))
-                        {
-                            party[character].Remove(status);
-
-                            if (SafeCast(condition.Variables.size()) < 2 || (SafeCast(condition.Variables.size()) > 2 && Engine::ToUpper(condition.Variables[2]) != "TRUE"))
-                            {
-                                text = party[character].Name + " LOSES [" + Character::StatusMapping[status] + "]";
-                            }
                         }
 
                         internal_error = false;
@@ -831,3647 +1193,4032 @@ namespace BloodSword::Conditions
                 }
             }
         }
-        else if (condition.Type == Conditions::Type::FIRST)
-        {
-            internal_error = true;
-
-            // variables
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
-            {
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+    }
 
-                if (character != Character::Class::NONE)
-                {
-                    if (!party.Has(character))
-                    {
-                        text = Engine::NotInParty(character);
-                    }
-                    else
-                    {
-                        for (auto i = 0; i < party.Count(); i++)
-                        {
-                            if (Engine::IsAlive(party[i]))
-                            {
-                                result = (party[i].Class == character);
+    // COUNT STATUS
+    void CountStatus(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
 
-                                break;
-                            }
-                        }
+        auto &internal_error = state.InternalError;
 
-                        if (!result)
-                        {
-                            text = Character::ClassMapping[character] + " NOT THE FIRST IN BATTLE ORDER!";
-                        }
-                    }
+        internal_error = true;
 
-                    internal_error = false;
-                }
-            }
-        }
-        else if (condition.Type == Conditions::Type::LAST)
+        // variables
+        // 0 - status
+        // 1 - min threshold
+        // 2 - max threshold
+        if (SafeCast(condition.Variables.size()) > 2)
         {
-            internal_error = true;
+            auto status = Character::MapStatus(condition.Variables[0]);
 
-            // variables
-            // 0 - player
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
-            {
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+            auto min_count = party.Number(condition.Operands[1]);
 
-                if (character != Character::Class::NONE)
-                {
-                    if (!party.Has(character))
-                    {
-                        text = Engine::NotInParty(character);
-                    }
-                    else
-                    {
-                        for (auto i = (party.Count() - 1); i >= 0; i--)
-                        {
-                            if (Engine::IsAlive(party[i]))
-                            {
-                                result = (party[i].Class == character);
+            auto max_count = party.Number(condition.Operands[2]);
 
-                                break;
-                            }
-                        }
+            if (Engine::IsAlive(party) && status != Character::Status::NONE && min_count >= 0 && max_count >= 0 && min_count <= max_count)
+            {
+                auto count = Engine::Count(party, Character::ControlType::PLAYER, status);
 
-                        if (!result)
-                        {
-                            text = Character::ClassMapping[character] + " NOT THE LAST IN BATTLE ORDER!";
-                        }
-                    }
+                result = count >= min_count && count <= max_count;
 
-                    internal_error = false;
-                }
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::TEST_GAIN_STATUS)
-        {
-            internal_error = true;
-
-            // variables
-            // 0 - player (or ALL)
-            // 1 - attribute
-            // 2 - status gain on success
-            // 3 - status gain on failure
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 3)
-            {
-                auto attribute = Attribute::Map(condition.Variables[1]);
+    }
 
-                auto status_success = Character::MapStatus(condition.Variables[2]);
+    // SELECT MULTIPLE
+    void SelectMultiple(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
 
-                auto status_fail = Character::MapStatus(condition.Variables[3]);
+        auto &internal_error = state.InternalError;
 
-                if (attribute != Attribute::Type::NONE && status_fail != Character::Status::NONE)
-                {
-                    if (Engine::ToUpper(condition.Variables[0]) == "ALL")
-                    {
-                        result = true;
+        internal_error = true;
 
-                        for (auto character = 0; character < party.Count(); character++)
-                        {
-                            if (Engine::IsAlive(party[character]))
-                            {
-                                if (Interface::Test(graphics, background, party[character], attribute))
-                                {
-                                    if (status_success != Character::Status::NONE)
-                                    {
-                                        party[character].Add(status_success);
-                                    }
-                                }
-                                else
-                                {
-                                    party[character].Add(status_fail);
-                                }
-                            }
-                        }
+        // variables:
+        // 0 - criteria for preselection (status)
+        // 1 - status when selected
+        // 2 - status when not selected
+        // 3 - message to display
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 3)
+        {
+            auto preselect = Character::MapStatus(condition.Variables[0]);
 
-                        internal_error = false;
-                    }
-                    else
-                    {
-                        auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+            auto selected = Character::MapStatus(condition.Variables[1]);
 
-                        if (character != Character::Class::NONE)
-                        {
-                            if (party.Has(character) && Engine::IsAlive(party[character]))
-                            {
-                                result = true;
+            auto excluded = Character::MapStatus(condition.Variables[2]);
 
-                                if (Interface::Test(graphics, background, party[character], attribute))
-                                {
-                                    party[character].Add(status_success);
-                                }
-                                else
-                                {
-                                    party[character].Add(status_fail);
-                                }
-                            }
-                            else if (!party.Has(character))
-                            {
-                                text = Engine::NotInParty(character);
-                            }
-                            else if (!Engine::IsAlive(party[character]))
-                            {
-                                text = Engine::IsDead(party[character]);
-                            }
+            if (selected != Character::Status::NONE || excluded != Character::Status::NONE)
+            {
+                Interface::SelectMultiple(graphics, background, party, condition.Variables[3].c_str(), preselect, selected, excluded, true);
 
-                            internal_error = false;
-                        }
-                    }
-                }
+                result = true;
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::COUNT_STATUS)
-        {
-            internal_error = true;
-
-            // variables
-            // 0 - status
-            // 1 - min threshold
-            // 2 - max threshold
-            if (SafeCast(condition.Variables.size()) > 2)
-            {
-                auto status = Character::MapStatus(condition.Variables[0]);
+    }
 
-                auto min_count = party.Number(condition.Variables[1]);
+    // CALL TO MIND
+    void CallToMind(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
 
-                auto max_count = party.Number(condition.Variables[2]);
+        auto &internal_error = state.InternalError;
 
-                if (Engine::IsAlive(party) && status != Character::Status::NONE && min_count >= 0 && max_count >= 0 && min_count <= max_count)
-                {
-                    auto count = Engine::Count(party, Character::ControlType::PLAYER, status);
+        auto &text = state.Text;
 
-                    result = count >= min_count && count <= max_count;
+        internal_error = true;
 
-                    internal_error = false;
-                }
-            }
-        }
-        else if (condition.Type == Conditions::Type::SELECT_MULTIPLE)
+        // variables
+        // 0 - player
+        // 1 - spell
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 1)
         {
-            internal_error = true;
-
-            // variables:
-            // 0 - criteria for preselection (status)
-            // 1 - status when selected
-            // 2 - status when not selected
-            // 3 - message to display
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 3)
-            {
-                auto preselect = Character::MapStatus(condition.Variables[0]);
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
 
-                auto selected = Character::MapStatus(condition.Variables[1]);
+            auto spell = Spells::Map(condition.Variables[1]);
 
-                auto excluded = Character::MapStatus(condition.Variables[2]);
-
-                if (selected != Character::Status::NONE || excluded != Character::Status::NONE)
+            if (character != Character::Class::NONE && spell != Spells::Type::NONE)
+            {
+                if (!party.Has(character))
                 {
-                    Interface::SelectMultiple(graphics, background, party, condition.Variables[3].c_str(), preselect, selected, excluded, true);
+                    text = Engine::NotInParty(character);
+                }
+                else if (!Engine::IsAlive(party[character]))
+                {
+                    text = Engine::IsDead(party[character]);
+                }
+                else if (!party[character].HasCalledToMind(spell))
+                {
+                    party[character].CallToMind(spell);
+
+                    text = "[" + Spells::TypeMapping[spell] + "] CALLED TO MIND.";
 
                     result = true;
+                }
+                else
+                {
+                    text = "[" + Spells::TypeMapping[spell] + "] ALREADY CALLED TO MIND.";
 
-                    internal_error = false;
+                    result = true;
                 }
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::CALL_TO_MIND)
-        {
-            internal_error = true;
+    }
 
-            // variables
-            // 0 - player
-            // 1 - spell
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 1)
-            {
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+    // FORGET SPELL
+    void ForgetSpell(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
 
-                auto spell = Spells::Map(condition.Variables[1]);
+        auto &internal_error = state.InternalError;
 
-                if (character != Character::Class::NONE && spell != Spells::Type::NONE)
-                {
-                    if (!party.Has(character))
-                    {
-                        text = Engine::NotInParty(character);
-                    }
-                    else if (!Engine::IsAlive(party[character]))
-                    {
-                        text = Engine::IsDead(party[character]);
-                    }
-                    else if (!party[character].HasCalledToMind(spell))
-                    {
-                        party[character].CallToMind(spell);
+        auto &text = state.Text;
 
-                        text = "[" + Spells::TypeMapping[spell] + "] CALLED TO MIND.";
+        internal_error = true;
 
-                        result = true;
-                    }
-                    else
-                    {
-                        text = "[" + Spells::TypeMapping[spell] + "] ALREADY CALLED TO MIND.";
+        // variables
+        // 0 - player
+        // 1 - spell
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 1)
+        {
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
 
-                        result = true;
-                    }
+            auto spell = Spells::Map(condition.Variables[1]);
 
-                    internal_error = false;
+            if (character != Character::Class::NONE && spell != Spells::Type::NONE)
+            {
+                if (!party.Has(character))
+                {
+                    text = Engine::NotInParty(character);
+                }
+                else if (!Engine::IsAlive(party[character]))
+                {
+                    text = Engine::IsDead(party[character]);
+                }
+                else if (party[character].HasCalledToMind(spell))
+                {
+                    party[character].Forget(spell);
+
+                    text = "[" + Spells::TypeMapping[spell] + "] UN-CALLED FROM MIND.";
+
+                    result = true;
+                }
+                else
+                {
+                    text = "[" + Spells::TypeMapping[spell] + "] WAS NOT CALLED TO MIND.";
+
+                    result = true;
                 }
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::FORGET_SPELL)
+    }
+
+    // KALUGEN SELECT
+    void KalugenSelect(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        internal_error = true;
+
+        // variables
+        // 0 - message (to display)
+        // 1 - number of options
+        // 2 - minimum number of items to be selected
+        // 3 - maximum number of items to be selected
+        // 4 - hidden (true/false)
+        // 5 to 5+(1) - assets
+        // last - asset (hidden)
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 5)
         {
-            internal_error = true;
+            auto options = party.Number(condition.Operands[1]);
 
-            // variables
-            // 0 - player
-            // 1 - spell
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 1)
+            auto min_select = party.Number(condition.Operands[2]);
+
+            auto max_select = party.Number(condition.Operands[3]);
+
+            auto hidden = Engine::ToUpper(condition.Variables[4]) == "TRUE";
+
+            auto expected = 4 + options + (hidden ? 1 : 0);
+
+            if (options > 0 && min_select > 0 && min_select <= max_select && SafeCast(condition.Variables.size()) > expected)
             {
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+                // contains assets
+                auto assets = Asset::List();
+
+                // contains card ids
+                auto values = std::vector<int>();
 
-                auto spell = Spells::Map(condition.Variables[1]);
+                // set hidden asset
+                auto asset_hidden = hidden ? Asset::Map(condition.Variables[5 + options]) : Asset::NONE;
 
-                if (character != Character::Class::NONE && spell != Spells::Type::NONE)
+                // collect assets and set values
+                for (auto i = 0; i < options; i++)
                 {
-                    if (!party.Has(character))
-                    {
-                        text = Engine::NotInParty(character);
-                    }
-                    else if (!Engine::IsAlive(party[character]))
+                    auto asset = Asset::Map(condition.Variables[5 + i]);
+
+                    if (asset != Asset::NONE)
                     {
-                        text = Engine::IsDead(party[character]);
+                        assets.push_back(asset);
                     }
-                    else if (party[character].HasCalledToMind(spell))
-                    {
-                        party[character].Forget(spell);
 
-                        text = "[" + Spells::TypeMapping[spell] + "] UN-CALLED FROM MIND.";
+                    values.push_back(i);
+                }
 
-                        result = true;
-                    }
-                    else
+                if (SafeCast(assets.size()) == SafeCast(values.size()))
+                {
+                    // clear current selection
+                    party.Cards.clear();
+
+                    // select cards
+                    auto selection = Interface::SelectIcons(graphics, background, condition.Variables[0].c_str(), assets, values, {}, min_select, max_select, asset_hidden, hidden);
+
+                    for (auto i = 0; i < SafeCast(selection.size()); i++)
                     {
-                        text = "[" + Spells::TypeMapping[spell] + "] WAS NOT CALLED TO MIND.";
+                        if (i >= 0 && i < SafeCast(Items::KalugenDeck.size()))
+                        {
+                            party.Cards.push_back(Items::KalugenDeck[selection[i]]);
+                        }
+                    }
 
+                    if (SafeCast(party.Cards.size()) >= min_select && SafeCast(party.Cards.size()) <= max_select)
+                    {
                         result = true;
-                    }
 
-                    internal_error = false;
+                        internal_error = false;
+                    }
                 }
             }
         }
-        else if (condition.Type == Conditions::Type::KALUGEN_SELECT)
+    }
+
+    // KALUGEN LIST
+    void KalugenList(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &text = state.Text;
+
+        if (Engine::IsAlive(party))
         {
-            internal_error = true;
-
-            // variables
-            // 0 - message (to display)
-            // 1 - number of options
-            // 2 - minimum number of items to be selected
-            // 3 - maximum number of items to be selected
-            // 4 - hidden (true/false)
-            // 5 to 5+(1) - assets
-            // last - asset (hidden)
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 5)
+            if (SafeCast(party.Cards.size()) > 0)
             {
-                auto options = party.Number(condition.Variables[1]);
-
-                auto min_select = party.Number(condition.Variables[2]);
+                text = "You have chosen " + std::string(SafeCast(party.Cards.size()) > 1 ? "these cards" : "this card") + ": ";
 
-                auto max_select = party.Number(condition.Variables[3]);
+                for (auto i = 0; i < SafeCast(party.Cards.size()); i++)
+                {
+                    if (i > 0)
+                    {
+                        text += ", ";
+                    }
 
-                auto hidden = Engine::ToUpper(condition.Variables[4]) == "TRUE";
+                    text += Item::CardMapping[party.Cards[i]];
+                }
 
-                auto expected = 4 + options + (hidden ? 1 : 0);
+                text += ".";
 
-                if (options > 0 && min_select > 0 && min_select <= max_select && SafeCast(condition.Variables.size()) > expected)
-                {
-                    // contains assets
-                    auto assets = Asset::List();
+                result = true;
+            }
+            else
+            {
+                text = "YOU HAVE NOT SELECTED ANY CARDS!";
+            }
+        }
+    }
 
-                    // contains card ids
-                    auto values = std::vector<int>();
+    // KALUGEN SCORE
+    void KalugenScore(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
 
-                    // set hidden asset
-                    auto asset_hidden = hidden ? Asset::Map(condition.Variables[5 + options]) : Asset::NONE;
+        auto &text = state.Text;
 
-                    // collect assets and set values
-                    for (auto i = 0; i < options; i++)
-                    {
-                        auto asset = Asset::Map(condition.Variables[5 + i]);
+        if (Engine::IsAlive(party))
+        {
+            // show score
+            auto score = Engine::ScoreKalugenGame(party);
 
-                        if (asset != Asset::NONE)
-                        {
-                            assets.push_back(asset);
-                        }
+            text = "You scored: " + std::to_string(score) + ".";
 
-                        values.push_back(i);
-                    }
+            result = true;
+        }
+    }
 
-                    if (SafeCast(assets.size()) == SafeCast(values.size()))
-                    {
-                        // clear current selection
-                        party.Cards.clear();
+    // KALUGEN PLAY
+    void KalugenPlay(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
 
-                        // select cards
-                        auto selection = Interface::SelectIcons(graphics, background, condition.Variables[0].c_str(), assets, values, {}, min_select, max_select, asset_hidden, hidden);
+        auto &internal_error = state.InternalError;
 
-                        for (auto i = 0; i < SafeCast(selection.size()); i++)
-                        {
-                            if (i >= 0 && i < SafeCast(Items::KalugenDeck.size()))
-                            {
-                                party.Cards.push_back(Items::KalugenDeck[selection[i]]);
-                            }
-                        }
+        auto &text = state.Text;
 
-                        if (SafeCast(party.Cards.size()) >= min_select && SafeCast(party.Cards.size()) <= max_select)
-                        {
-                            result = true;
+        internal_error = true;
 
-                            internal_error = false;
-                        }
-                    }
-                }
-            }
-        }
-        else if (condition.Type == Conditions::Type::KALUGEN_LIST)
+        // variables
+        // 0 - score to beat
+        if (SafeCast(condition.Variables.size()) > 0)
         {
-            if (Engine::IsAlive(party))
-            {
-                if (SafeCast(party.Cards.size()) > 0)
-                {
-                    text = "You have chosen " + std::string(SafeCast(party.Cards.size()) > 1 ? "these cards" : "this card") + ": ";
-
-                    for (auto i = 0; i < SafeCast(party.Cards.size()); i++)
-                    {
-                        if (i > 0)
-                        {
-                            text += ", ";
-                        }
+            auto beat = party.Number(condition.Operands[0]);
 
-                        text += Item::CardMapping[party.Cards[i]];
-                    }
+            auto score = Engine::ScoreKalugenGame(party);
 
-                    text += ".";
+            if (beat > 0 && score >= 0)
+            {
+                result = (score >= beat);
 
-                    result = true;
+                if (result)
+                {
+                    text = "YOU HAVE " + std::string(score > beat ? "BEATEN" : "MATCHED");
                 }
                 else
                 {
-                    text = "YOU HAVE NOT SELECTED ANY CARDS!";
+                    text = "YOU HAVE LOST TO";
                 }
-            }
-        }
-        else if (condition.Type == Conditions::Type::KALUGEN_SCORE)
-        {
-            if (Engine::IsAlive(party))
-            {
-                // show score
-                auto score = Engine::ScoreKalugenGame(party);
 
-                text = "You scored: " + std::to_string(score) + ".";
+                text += " THE SCORE OF " + std::to_string(beat);
 
-                result = true;
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::KALUGEN_PLAY)
-        {
-            internal_error = true;
-
-            // variables
-            // 0 - score to beat
-            if (SafeCast(condition.Variables.size()) > 0)
-            {
-                auto beat = party.Number(condition.Variables[0]);
+    }
 
-                auto score = Engine::ScoreKalugenGame(party);
+    // DISCARD ITEMS
+    void DiscardItems(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
 
-                if (beat > 0 && score >= 0)
-                {
-                    result = (score >= beat);
+        auto &internal_error = state.InternalError;
 
-                    if (result)
-                    {
-                        text = "YOU HAVE " + std::string(score > beat ? "BEATEN" : "MATCHED");
-                    }
-                    else
-                    {
-                        text = "YOU HAVE LOST TO";
-                    }
+        auto &text = state.Text;
 
-                    text += " THE SCORE OF " + std::to_string(beat);
+        internal_error = true;
 
-                    internal_error = false;
-                }
-            }
-        }
-        else if (condition.Type == Conditions::Type::DISCARD_ITEMS)
+        // variables:
+        // 0 - player / ALL
+        // 1 .. N - items to discard (type)
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 1)
         {
-            internal_error = true;
-
-            // variables:
-            // 0 - player / ALL
-            // 1 .. N - items to discard (type)
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 1)
-            {
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
 
-                auto characters = Character::Classes();
+            auto characters = Character::Classes();
 
-                auto items = Items::List();
+            auto items = Items::List();
 
-                auto is_party = (Engine::ToUpper(condition.Variables[0]) == "ALL");
+            auto is_party = (Engine::ToUpper(condition.Variables[0]) == "ALL");
 
-                if (is_party || character != Character::Class::NONE)
+            if (is_party || character != Character::Class::NONE)
+            {
+                if ((is_party && Engine::IsAlive(party)) || (party.Has(character) && Engine::IsAlive(party[character])))
                 {
-                    if ((is_party && Engine::IsAlive(party)) || (party.Has(character) && Engine::IsAlive(party[character])))
+                    for (auto i = 1; i < SafeCast(condition.Variables.size()); i++)
                     {
-                        for (auto i = 1; i < SafeCast(condition.Variables.size()); i++)
-                        {
-                            auto item = Item::Map(condition.Variables[i]);
+                        auto item = condition.Items[i];
 
-                            if (item != Item::Type::NONE)
-                            {
-                                items.push_back(item);
-                            }
+                        if (item != Item::Type::NONE)
+                        {
+                            items.push_back(item);
                         }
+                    }
 
-                        if (SafeCast(items.size()) > 0)
+                    if (SafeCast(items.size()) > 0)
+                    {
+                        if (Engine::ToUpper(condition.Variables[0]) == "ALL")
                         {
-                            if (Engine::ToUpper(condition.Variables[0]) == "ALL")
+                            for (auto i = 0; i < party.Count(); i++)
                             {
-                                for (auto i = 0; i < party.Count(); i++)
+                                if (Engine::IsAlive(party[i]))
                                 {
-                                    if (Engine::IsAlive(party[i]))
-                                    {
-                                        characters.push_back(party[i].Class);
-                                    }
+                                    characters.push_back(party[i].Class);
                                 }
                             }
-                            else
-                            {
-                                characters.push_back(character);
-                            }
+                        }
+                        else
+                        {
+                            characters.push_back(character);
+                        }
 
-                            auto discarded = std::vector<std::string>();
+                        auto discarded = std::vector<std::string>();
 
-                            for (auto i = 0; i < SafeCast(items.size()); i++)
+                        for (auto i = 0; i < SafeCast(items.size()); i++)
+                        {
+                            auto item = items[i];
+
+                            if ((is_party && party.Has(item)) || (!is_party && party[character].Has(item)))
                             {
-                                auto item = items[i];
+                                discarded.push_back(Item::TypeMapping[item]);
 
-                                if ((is_party && party.Has(item)) || (!is_party && party[character].Has(item)))
+                                for (auto &player : characters)
                                 {
-                                    discarded.push_back(Item::TypeMapping[item]);
-
-                                    for (auto &player : characters)
-                                    {
-                                        party[player].Remove(item);
-                                    }
+                                    party[player].Remove(item);
                                 }
                             }
+                        }
 
-                            if (!discarded.empty())
-                            {
-                                text = (is_party ? "You" : party[character].Name) + " discard" + (is_party ? "" : "s") + " the ";
+                        if (!discarded.empty())
+                        {
+                            text = (is_party ? "You" : party[character].Name) + " discard" + (is_party ? "" : "s") + " the ";
 
-                                for (auto i = 0; i < SafeCast(discarded.size()); i++)
+                            for (auto i = 0; i < SafeCast(discarded.size()); i++)
+                            {
+                                if (i > 0 && SafeCast(discarded.size()) > 2)
                                 {
-                                    if (i > 0 && SafeCast(discarded.size()) > 2)
-                                    {
-                                        text += ", ";
-                                    }
-
-                                    if ((SafeCast(discarded.size()) > 1) && (i == SafeCast(discarded.size()) - 1))
-                                    {
-                                        text += " and the ";
-                                    }
-
-                                    text += discarded[i];
+                                    text += ", ";
                                 }
 
-                                text += ".";
+                                if ((SafeCast(discarded.size()) > 1) && (i == SafeCast(discarded.size()) - 1))
+                                {
+                                    text += " and the ";
+                                }
 
-                                result = true;
+                                text += discarded[i];
                             }
 
-                            internal_error = false;
+                            text += ".";
+
+                            result = true;
                         }
-                    }
-                    else if (!party.Has(character))
-                    {
-                        text = Engine::NotInParty(character);
 
                         internal_error = false;
                     }
-                    else
-                    {
-                        text = Engine::IsDead(party[character]);
+                }
+                else if (!party.Has(character))
+                {
+                    text = Engine::NotInParty(character);
 
-                        internal_error = false;
-                    }
+                    internal_error = false;
+                }
+                else
+                {
+                    text = Engine::IsDead(party[character]);
+
+                    internal_error = false;
                 }
             }
         }
-        else if (condition.Type == Conditions::Type::RECEIVE_ITEM)
+    }
+
+    // RECEIVE ITEM
+    void ReceiveItem(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables
+        // 0 - ALL/FIRST/LAST/SELECT/CHOSEN or player
+        // 1 - FALL-BACK recipient (NONE/FIRST/LAST/SELECT)
+        // 2 - item
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 2)
         {
-            internal_error = true;
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
 
-            // variables
-            // 0 - ALL/FIRST/LAST/SELECT/CHOSEN or player
-            // 1 - FALL-BACK recipient (NONE/FIRST/LAST/SELECT)
-            // 2 - item
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 2)
-            {
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+            auto is_character = (character != Character::Class::NONE);
 
-                auto is_character = (character != Character::Class::NONE);
+            auto is_party = (Engine::ToUpper(condition.Variables[0]) == "ALL");
 
-                auto is_party = (Engine::ToUpper(condition.Variables[0]) == "ALL");
+            auto is_first = (Engine::ToUpper(condition.Variables[0]) == "FIRST");
 
-                auto is_first = (Engine::ToUpper(condition.Variables[0]) == "FIRST");
+            auto is_last = (Engine::ToUpper(condition.Variables[0]) == "LAST");
 
-                auto is_last = (Engine::ToUpper(condition.Variables[0]) == "LAST");
+            auto first_or_last = (is_first || is_last);
 
-                auto first_or_last = (is_first || is_last);
+            auto selected = (Engine::ToUpper(condition.Variables[0]) == "SELECT");
 
-                auto selected = (Engine::ToUpper(condition.Variables[0]) == "SELECT");
+            auto next_first = (Engine::ToUpper(condition.Variables[1]) == "FIRST");
 
-                auto next_first = (Engine::ToUpper(condition.Variables[1]) == "FIRST");
+            auto next_last = (Engine::ToUpper(condition.Variables[1]) == "LAST");
 
-                auto next_last = (Engine::ToUpper(condition.Variables[1]) == "LAST");
+            auto next = is_character && (next_first || next_last);
 
-                auto next = is_character && (next_first || next_last);
+            auto select_next = is_character && (Engine::ToUpper(condition.Variables[1]) == "SELECT");
 
-                auto select_next = is_character && (Engine::ToUpper(condition.Variables[1]) == "SELECT");
+            auto item = condition.Items[2];
 
-                auto item = Item::Map(condition.Variables[2]);
+            if ((is_party || first_or_last || selected || is_character) && Engine::IsAlive(party) && item != Item::Type::NONE && Items::Found(item))
+            {
+                auto characters = Character::Classes();
 
-                if ((is_party || first_or_last || selected || is_character) && Engine::IsAlive(party) && item != Item::Type::NONE && Items::Found(item))
+                if (is_party)
                 {
-                    auto characters = Character::Classes();
-
-                    if (is_party)
+                    for (auto i = 0; i < party.Count(); i++)
                     {
-                        for (auto i = 0; i < party.Count(); i++)
+                        if (Engine::IsAlive(party[i]))
                         {
-                            if (Engine::IsAlive(party[i]))
-                            {
-                                characters.push_back(party[i].Class);
-                            }
+                            characters.push_back(party[i].Class);
                         }
                     }
-                    else if (first_or_last || (is_character && (!party.Has(character) || (party.Has(character) && !Engine::IsAlive(party[character]))) && next))
+                }
+                else if (first_or_last || (is_character && (!party.Has(character) || (party.Has(character) && !Engine::IsAlive(party[character]))) && next))
+                {
+                    if (!next)
                     {
-                        if (!next)
+                        if (is_first)
                         {
-                            if (is_first)
-                            {
-                                characters.push_back(Engine::FirstClass(party));
-                            }
-                            else if (is_last)
-                            {
-                                characters.push_back(Engine::LastClass(party));
-                            }
+                            characters.push_back(Engine::FirstClass(party));
                         }
-                        else
+                        else if (is_last)
                         {
-                            if (next_first)
-                            {
-                                characters.push_back(Engine::FirstClass(party));
-                            }
-                            else if (next_last)
-                            {
-                                characters.push_back(Engine::LastClass(party));
-                            }
+                            characters.push_back(Engine::LastClass(party));
                         }
                     }
-                    else if (selected || (is_character && (!party.Has(character) || (party.Has(character) && !Engine::IsAlive(party[character]))) && select_next))
-                    {
-                        auto message = "WHO RECEIVES THE " + Items::Defaults[item].Name + "?";
-
-                        character = Interface::SelectCharacter(graphics, background, party, message.c_str(), true, false, false, false, true);
-
-                        characters.push_back(character);
-                    }
-                    else if (is_character && party.Has(character) && Engine::IsAlive(party[character]))
-                    {
-                        characters.push_back(party[character].Class);
-                    }
-
-                    if (SafeCast(characters.size()) > 0)
+                    else
                     {
-                        for (auto i = 0; i < SafeCast(characters.size()); i++)
-                        {
-                            if (party.Has(characters[i]) && Engine::IsAlive(party[characters[i]]))
-                            {
-                                party[characters[i]].Add(Items::Defaults[item]);
-                            }
-                        }
-
-                        if (is_party)
+                        if (next_first)
                         {
-                            text = "You receive the " + Items::Defaults[item].Name + ".";
+                            characters.push_back(Engine::FirstClass(party));
                         }
-                        else if (party.Has(characters[0]) && Engine::IsAlive(party[characters[0]]))
+                        else if (next_last)
                         {
-                            text = party[characters[0]].Name + " receives the " + Items::Defaults[item].Name + ".";
+                            characters.push_back(Engine::LastClass(party));
                         }
-
-                        result = true;
                     }
-
-                    internal_error = false;
                 }
-            }
-        }
-        else if (condition.Type == Conditions::Type::LOSE_WEAPONS)
-        {
-            internal_error = true;
+                else if (selected || (is_character && (!party.Has(character) || (party.Has(character) && !Engine::IsAlive(party[character]))) && select_next))
+                {
+                    auto message = "WHO RECEIVES THE " + Items::Defaults[item].Name + "?";
 
-            // variables
-            // 0 - message to display
-            // 1 - N items to be excluded (optional)
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0 && !condition.Variables[0].empty())
-            {
-                auto excluded = Items::List();
+                    character = Interface::SelectCharacter(graphics, background, party, message.c_str(), true, false, false, false, true);
 
-                for (auto i = 1; i < SafeCast(condition.Variables.size()); i++)
+                    characters.push_back(character);
+                }
+                else if (is_character && party.Has(character) && Engine::IsAlive(party[character]))
                 {
-                    auto item = Item::Map(condition.Variables[i]);
-
-                    if (item != Item::Type::NONE)
-                    {
-                        excluded.push_back(item);
-                    }
+                    characters.push_back(party[character].Class);
                 }
 
-                for (auto i = 0; i < party.Count(); i++)
+                if (SafeCast(characters.size()) > 0)
                 {
-                    if (Engine::IsAlive(party[i]))
+                    for (auto i = 0; i < SafeCast(characters.size()); i++)
                     {
-                        auto inventory = Items::Inventory();
-
-                        for (auto item = 0; item < SafeCast(party[i].Items.size()); item++)
+                        if (party.Has(characters[i]) && Engine::IsAlive(party[characters[i]]))
                         {
-                            if (!party[i].Items[item].Is(Item::Property::WEAPON) || Items::Included(excluded, party[i].Items[item].Type))
-                            {
-                                inventory.push_back(party[i].Items[item]);
-                            }
+                            party[characters[i]].Add(Items::Defaults[item]);
                         }
-
-                        party[i].Items = inventory;
                     }
-                }
-
-                text = condition.Variables[0];
-
-                result = true;
+
+                    if (is_party)
+                    {
+                        text = "You receive the " + Items::Defaults[item].Name + ".";
+                    }
+                    else if (party.Has(characters[0]) && Engine::IsAlive(party[characters[0]]))
+                    {
+                        text = party[characters[0]].Name + " receives the " + Items::Defaults[item].Name + ".";
+                    }
+
+                    result = true;
+                }
 
                 internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::LOSE_ARMOUR)
+    }
+
+    // LOSE WEAPONS
+    void LoseWeapons(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables
+        // 0 - message to display
+        // 1 - N items to be excluded (optional)
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0 && !condition.Variables[0].empty())
         {
-            internal_error = true;
+            auto excluded = Items::List();
 
-            // variables
-            // 0 - message to display
-            // 1 - N items to be excluded (optional)
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0 && !condition.Variables[0].empty())
+            for (auto i = 1; i < SafeCast(condition.Variables.size()); i++)
             {
-                auto excluded = Items::List();
+                auto item = condition.Items[i];
 
-                for (auto i = 1; i < SafeCast(condition.Variables.size()); i++)
+                if (item != Item::Type::NONE)
                 {
-                    auto item = Item::Map(condition.Variables[i]);
-
-                    if (item != Item::Type::NONE)
-                    {
-                        excluded.push_back(item);
-                    }
+                    excluded.push_back(item);
                 }
+            }
 
-                for (auto i = 0; i < party.Count(); i++)
+            for (auto i = 0; i < party.Count(); i++)
+            {
+                if (Engine::IsAlive(party[i]))
                 {
-                    if (Engine::IsAlive(party[i]))
-                    {
-                        auto inventory = Items::Inventory();
+                    auto inventory = Items::Inventory();
 
-                        for (auto item = 0; item < SafeCast(party[i].Items.size()); item++)
+                    for (auto item = 0; item < SafeCast(party[i].Items.size()); item++)
+                    {
+                        if (!party[i].Items[item].Is(Item::Property::WEAPON) || Items::Included(excluded, party[i].Items[item].Type))
                         {
-                            if (!party[i].Items[item].Is(Item::Property::ARMOUR) || Items::Included(excluded, party[i].Items[item].Type))
-                            {
-                                inventory.push_back(party[i].Items[item]);
-                            }
+                            inventory.push_back(party[i].Items[item]);
                         }
-
-                        party[i].Items = inventory;
                     }
+
+                    party[i].Items = inventory;
                 }
+            }
 
-                text = condition.Variables[0];
+            text = condition.Variables[0];
 
-                result = true;
+            result = true;
 
-                internal_error = false;
-            }
+            internal_error = false;
         }
-        else if (condition.Type == Conditions::Type::SELECT_PLAYER || condition.Type == Conditions::Type::CHOOSE_PLAYER)
-        {
-            internal_error = true;
+    }
 
-            // variables:
-            // 0 - message to display
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
-            {
-                if (Engine::Count(party) > 1)
-                {
-                    auto message = SafeCast(condition.Variables[0].size()) > 0 ? condition.Variables[0] : std::string(Conditions::TypeMapping[condition.Type]);
+    // LOSE ARMOUR
+    void LoseArmour(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
 
-                    party.ChosenCharacter = Interface::SelectCharacter(graphics, background, party, message.c_str(), true, false, false, false, true);
-                }
-                else
-                {
-                    party.ChosenCharacter = Engine::FirstClass(party);
-                }
+        auto &internal_error = state.InternalError;
 
-                result = true;
+        auto &text = state.Text;
 
-                internal_error = false;
-            }
-        }
-        else if (condition.Type == Conditions::Type::PLAYER_PAYS || condition.Type == Conditions::Type::CHARACTER_PAYS)
+        internal_error = true;
+
+        // variables
+        // 0 - message to display
+        // 1 - N items to be excluded (optional)
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0 && !condition.Variables[0].empty())
         {
-            internal_error = true;
+            auto excluded = Items::List();
 
-            // variables:
-            // 0 - message to display
-            // 1 - currency (currency, e.g. GOLD)
-            // 2 - quantity (of the item above)
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 2)
+            for (auto i = 1; i < SafeCast(condition.Variables.size()); i++)
             {
-                auto chosen = Character::Class::NONE;
+                auto item = condition.Items[i];
 
-                auto currency = Item::Map(condition.Variables[1]);
-
-                auto quantity = party.Number(condition.Variables[2]);
-
-                if (currency != Item::Type::NONE && quantity > 0)
+                if (item != Item::Type::NONE)
                 {
-                    if (Engine::Count(party) > 1)
-                    {
-                        auto message = !condition.Variables[0].empty() ? condition.Variables[0] : ("WHO SHALL PAY " + std::to_string(quantity) + " " + Item::TypeMapping[currency] + "?");
+                    excluded.push_back(item);
+                }
+            }
 
-                        chosen = Interface::SelectCharacter(graphics, background, party, message.c_str(), true, false, false, false, true);
-                    }
-                    else
-                    {
-                        chosen = Engine::FirstClass(party);
-                    }
+            for (auto i = 0; i < party.Count(); i++)
+            {
+                if (Engine::IsAlive(party[i]))
+                {
+                    auto inventory = Items::Inventory();
 
-                    if (chosen != Character::Class::NONE)
+                    for (auto item = 0; item < SafeCast(party[i].Items.size()); item++)
                     {
-                        result = party[chosen].Quantity(currency) >= quantity;
-
-                        if (!result)
-                        {
-                            text = Engine::NotEnough(currency);
-                        }
-                        else
+                        if (!party[i].Items[item].Is(Item::Property::ARMOUR) || Items::Included(excluded, party[i].Items[item].Type))
                         {
-                            party[chosen].Add(currency, -quantity);
-
-                            party.ChosenCharacter = chosen;
+                            inventory.push_back(party[i].Items[item]);
                         }
-
-                        internal_error = false;
                     }
+
+                    party[i].Items = inventory;
                 }
             }
-        }
-        else if (condition.Type == Conditions::Type::PLAYER_BUYS_ITEM || condition.Type == Conditions::Type::CHARACTER_BUYS_ITEM)
-        {
-            internal_error = true;
-
-            // variables:
-            // 0 - message to display
-            // 1 - currency (currency, e.g. GOLD)
-            // 2 - quantity (of the item above)
-            // 3 - item to buy
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 3)
-            {
-                auto chosen = Character::Class::NONE;
 
-                auto currency = Item::Map(condition.Variables[1]);
+            text = condition.Variables[0];
 
-                auto quantity = party.Number(condition.Variables[2]);
+            result = true;
 
-                auto item = Item::Map(condition.Variables[3]);
+            internal_error = false;
+        }
+    }
 
-                if (currency != Item::Type::NONE && item != Item::Type::NONE && Items::Found(item) && quantity > 0)
-                {
-                    if (Engine::Count(party) > 1)
-                    {
-                        auto message = !condition.Variables[0].empty() ? condition.Variables[0] : ("WHO BUYS THE " + Item::TypeMapping[item] + " (" + std::to_string(quantity) + " " + Item::TypeMapping[currency] + ")?");
+    // SELECT PLAYER / CHOOSE PLAYER
+    void SelectPlayer(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
 
-                        chosen = Interface::SelectCharacter(graphics, background, party, message.c_str(), true, false, false, false, true);
-                    }
-                    else
-                    {
-                        chosen = Engine::FirstClass(party);
-                    }
+        auto &internal_error = state.InternalError;
 
-                    if (chosen != Character::Class::NONE)
-                    {
-                        auto buy = party[chosen].Quantity(currency) >= quantity;
+        internal_error = true;
 
-                        auto get = Interface::CanReceive(party[chosen]);
+        // variables:
+        // 0 - message to display
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
+        {
+            if (Engine::Count(party) > 1)
+            {
+                auto message = SafeCast(condition.Variables[0].size()) > 0 ? condition.Variables[0] : std::string(Conditions::TypeMapping[condition.Type]);
 
-                        result = buy && get;
+                party.ChosenCharacter = Interface::SelectCharacter(graphics, background, party, message.c_str(), true, false, false, false, true);
+            }
+            else
+            {
+                party.ChosenCharacter = Engine::FirstClass(party);
+            }
 
-                        if (!result)
-                        {
-                            if (!buy)
-                            {
-                                text = Engine::NotEnough(currency);
-                            }
-                            else if (!get)
-                            {
-                                text = party[chosen].Name + "'s inventory is full.";
-                            }
-                            else
-                            {
-                                text = "You cannot buy the " + Item::TypeMapping[item] + ".";
-                            }
-                        }
-                        else
-                        {
-                            party[chosen].Add(Items::Defaults[item]);
+            result = true;
 
-                            party[chosen].Add(currency, -quantity);
+            internal_error = false;
+        }
+    }
 
-                            party.ChosenCharacter = chosen;
+    // PLAYER PAYS / CHARACTER PAYS
+    void PlayerPays(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
 
-                            text = party[chosen].Name + " buys the " + Item::TypeMapping[item] + ".";
-                        }
+        auto &internal_error = state.InternalError;
 
-                        internal_error = false;
-                    }
-                }
-            }
-        }
-        else if (condition.Type == Conditions::Type::SET_CHOSEN)
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables:
+        // 0 - message to display
+        // 1 - currency (currency, e.g. GOLD)
+        // 2 - quantity (of the item above)
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 2)
         {
-            internal_error = true;
+            auto chosen = Character::Class::NONE;
+
+            auto currency = condition.Items[1];
 
-            // variables:
-            // 0 - player to set as CHOSEN
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
+            auto quantity = party.Number(condition.Operands[2]);
+
+            if (currency != Item::Type::NONE && quantity > 0)
             {
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+                if (Engine::Count(party) > 1)
+                {
+                    auto message = !condition.Variables[0].empty() ? condition.Variables[0] : ("WHO SHALL PAY " + std::to_string(quantity) + " " + Item::TypeMapping[currency] + "?");
 
-                if (character != Character::Class::NONE)
+                    chosen = Interface::SelectCharacter(graphics, background, party, message.c_str(), true, false, false, false, true);
+                }
+                else
                 {
-                    if (party.Has(character) && Engine::IsAlive(party[character]))
-                    {
-                        party.ChosenCharacter = character;
+                    chosen = Engine::FirstClass(party);
+                }
 
-                        result = true;
-                    }
-                    else if (!party.Has(character))
+                if (chosen != Character::Class::NONE)
+                {
+                    result = party[chosen].Quantity(currency) >= quantity;
+
+                    if (!result)
                     {
-                        text = Engine::NotInParty(character);
+                        text = Engine::NotEnough(currency);
                     }
-                    else if (!Engine::IsAlive(party[character]))
+                    else
                     {
-                        text = Engine::IsDead(party[character]);
+                        party[chosen].Add(currency, -quantity);
+
+                        party.ChosenCharacter = chosen;
                     }
 
                     internal_error = false;
                 }
             }
         }
-        else if (condition.Type == Conditions::Type::STAKE)
-        {
-            internal_error = true;
+    }
 
-            // variables
-            // 0 - item to stake
-            // 1 - asset (to item in #0)
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 1)
-            {
-                auto item = Item::Map(condition.Variables[0]);
+    // PLAYER BUYS ITEM / CHARACTER BUYS ITEM
+    void PlayerBuysItem(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
 
-                auto asset = Asset::Map(condition.Variables[1]);
+        auto &internal_error = state.InternalError;
 
-                result = Interface::StakeQuantity(graphics, background, party, item, asset);
+        auto &text = state.Text;
 
-                internal_error = false;
-            }
-        }
-        else if (condition.Type == Conditions::Type::COPY || condition.Type == Conditions::Type::SET)
+        internal_error = true;
+
+        // variables:
+        // 0 - message to display
+        // 1 - currency (currency, e.g. GOLD)
+        // 2 - quantity (of the item above)
+        // 3 - item to buy
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 3)
         {
-            internal_error = true;
+            auto chosen = Character::Class::NONE;
+
+            auto currency = condition.Items[1];
 
-            // variables
-            // 0 - destination variable
-            // 1 - source variable / value
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 1)
+            auto quantity = party.Number(condition.Operands[2]);
+
+            auto item = condition.Items[3];
+
+            if (currency != Item::Type::NONE && item != Item::Type::NONE && Items::Found(item) && quantity > 0)
             {
-                auto dst = Engine::MapTokens(party, condition.Variables[0]);
+                if (Engine::Count(party) > 1)
+                {
+                    auto message = !condition.Variables[0].empty() ? condition.Variables[0] : ("WHO BUYS THE " + Item::TypeMapping[item] + " (" + std::to_string(quantity) + " " + Item::TypeMapping[currency] + ")?");
 
-                auto src = Engine::MapTokens(party, condition.Variables[1]);
+                    chosen = Interface::SelectCharacter(graphics, background, party, message.c_str(), true, false, false, false, true);
+                }
+                else
+                {
+                    chosen = Engine::FirstClass(party);
+                }
 
-                if (!dst.empty() && !src.empty())
+                if (chosen != Character::Class::NONE)
                 {
-                    if (party.IsPresent(src))
+                    auto buy = party[chosen].Quantity(currency) >= quantity;
+
+                    auto get = Interface::CanReceive(party[chosen]);
+
+                    result = buy && get;
+
+                    if (!result)
                     {
-                        party.Set(dst, party.Get(src));
+                        if (!buy)
+                        {
+                            text = Engine::NotEnough(currency);
+                        }
+                        else if (!get)
+                        {
+                            text = party[chosen].Name + "'s inventory is full.";
+                        }
+                        else
+                        {
+                            text = "You cannot buy the " + Item::TypeMapping[item] + ".";
+                        }
                     }
                     else
                     {
-                        party.Set(dst, src);
-                    }
+                        party[chosen].Add(Items::Defaults[item]);
 
-                    result = true;
+                        party[chosen].Add(currency, -quantity);
+
+                        party.ChosenCharacter = chosen;
+
+                        text = party[chosen].Name + " buys the " + Item::TypeMapping[item] + ".";
+                    }
 
                     internal_error = false;
                 }
             }
         }
-        else if (condition.Type == Conditions::Type::MATH)
-        {
-            internal_error = true;
-
-            // variables
-            // 0 - operation (+, -, *)
-            // 1 - first variable (destination)
-            // 2 - second variable / value (source)
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 2)
-            {
-                auto ops = condition.Variables[0];
+    }
 
-                auto dst = Engine::MapTokens(party, condition.Variables[1]);
+    // SET CHOSEN
+    void SetChosen(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
 
-                auto src = Engine::MapTokens(party, condition.Variables[2]);
+        auto &internal_error = state.InternalError;
 
-                if (!ops.empty() && !dst.empty() && !src.empty())
-                {
-                    party.Math(ops, dst, src);
+        auto &text = state.Text;
 
-                    result = true;
+        internal_error = true;
 
-                    internal_error = false;
-                }
-            }
-        }
-        else if (condition.Type == Conditions::Type::CHOOSE_NUMBER)
+        // variables:
+        // 0 - player to set as CHOSEN
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
         {
-            internal_error = true;
-
-            // variables
-            // 0 - CHOOSE/VALUE
-            // 1 - message to display if CHOOSE in #0
-            // 2 - min if CHOOSE in #0
-            // 3 - max if CHOOSE in #0
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
-            {
-                auto number = (Engine::ToUpper(condition.Variables[0]) != "CHOOSE");
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
 
-                if (number)
+            if (character != Character::Class::NONE)
+            {
+                if (party.Has(character) && Engine::IsAlive(party[character]))
                 {
-                    party.ChosenNumber = party.Number(condition.Variables[0]);
+                    party.ChosenCharacter = character;
 
                     result = true;
                 }
-                else if (SafeCast(condition.Variables.size()) > 3)
+                else if (!party.Has(character))
                 {
-                    auto min_number = party.Number(condition.Variables[2]);
-
-                    auto max_number = party.Number(condition.Variables[3]);
-
-                    party.ChosenNumber = Interface::GetNumber(graphics, background, condition.Variables[1].c_str(), min_number, max_number, Asset::Map("DICE GAME"), Asset::Map("UP"), Asset::Map("DOWN"), false);
-
-                    result = true;
+                    text = Engine::NotInParty(character);
+                }
+                else if (!Engine::IsAlive(party[character]))
+                {
+                    text = Engine::IsDead(party[character]);
                 }
 
                 internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::ROLL)
-        {
-            internal_error = true;
-
-            // variables
-            // 0 - number of dice to roll
-            // 1 - modifiers
-            // 2 - variable to save results to
-            // 3 - asset (CHOSEN / asset name)
-            // 4 - asset (action)
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 4)
-            {
-                auto roll = party.Number(condition.Variables[0]);
-
-                auto mods = party.Number(condition.Variables[1]);
+    }
 
-                auto variable = condition.Variables[2];
+    // STAKE
+    void Stake(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
 
-                auto is_character = (Engine::ToUpper(condition.Variables[3]) == "CHOSEN");
+        auto &internal_error = state.InternalError;
 
-                if (!is_character || (is_character && party.ChosenCharacter != Character::Class::NONE && party.Has(party.ChosenCharacter) && Engine::IsAlive(party[party.ChosenCharacter])))
-                {
-                    auto asset = is_character ? party[party.ChosenCharacter].Asset : Asset::Map(condition.Variables[3]);
+        internal_error = true;
 
-                    auto action = Asset::Map(condition.Variables[4]);
+        // variables
+        // 0 - item to stake
+        // 1 - asset (to item in #0)
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 1)
+        {
+            auto item = condition.Items[0];
 
-                    if (asset != Asset::NONE && action != Asset::NONE && !variable.empty())
-                    {
-                        party.Set(variable, Interface::Roll(graphics, background, asset, action, roll, mods).Sum);
+            auto asset = Asset::Map(condition.Variables[1]);
 
-                        result = true;
+            result = Interface::StakeQuantity(graphics, background, party, item, asset);
 
-                        internal_error = false;
-                    }
-                }
-            }
+            internal_error = false;
         }
-        else if (condition.Type == Conditions::Type::IF)
-        {
-            internal_error = true;
-
-            // variables
-            // 0 - operation (=, !=, <>, >, <, >=. <=)
-            // 1 - first variable / value
-            // 2 - second variable / value
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 2)
-            {
-                auto ops = condition.Variables[0];
+    }
 
-                auto first = condition.Variables[1];
+    // COPY / SET
+    void Copy(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
 
-                auto second = condition.Variables[2];
+        auto &internal_error = state.InternalError;
 
-                if (!ops.empty() && !first.empty() && !second.empty())
-                {
-                    result = party.If(ops, first, second);
+        internal_error = true;
 
-                    internal_error = false;
-                }
-            }
-        }
-        else if (condition.Type == Conditions::Type::IF_MATH)
+        // variables
+        // 0 - destination variable
+        // 1 - source variable / value
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 1)
         {
-            internal_error = true;
-
-            // variables
-            // 0 - logical operation (=, !=, <>, >, <, >=. <=)
-            // 1 - first variable
-            // 2 - second variable
-            // 3 - math operation (*, +, -)
-            // 4 - first variable (destination)
-            // 5 - second variable / value (source)
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 4)
-            {
-                auto ops = condition.Variables[0];
+            auto dst = Engine::MapTokens(party, condition.Operands[0]);
 
-                auto first = Engine::MapTokens(party, condition.Variables[1]);
+            auto src = Engine::MapTokens(party, condition.Operands[1]);
 
-                auto second = Engine::MapTokens(party, condition.Variables[2]);
-
-                if (!ops.empty() && !first.empty() && !second.empty())
+            if (!dst.IsEmpty() && !src.IsEmpty())
+            {
+                if (party.IsPresent(src))
                 {
-                    result = party.If(ops, first, second);
-
-                    if (result)
-                    {
-                        auto ops = condition.Variables[3];
-
-                        auto first = Engine::MapTokens(party, condition.Variables[4]);
-
-                        auto second = Engine::MapTokens(party, condition.Variables[5]);
+                    party.Set(dst, party.Get(src));
+                }
+                else
+                {
+                    party.Set(dst, src.Text);
+                }
 
-                        party.Math(ops, first, second);
-                    }
+                result = true;
 
-                    internal_error = false;
-                }
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::IF_TRUE_RETURN || condition.Type == Conditions::Type::IF_FALSE_RETURN)
-        {
-            internal_error = true;
-
-            // variables
-            // 0 - operation (=, !=, <>, >, <, >=. <=)
-            // 1 - first variable / value
-            // 2 - second variable / value
-            // 3 - message on return
-            // 4 - border
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 4)
-            {
-                auto ops = condition.Variables[0];
+    }
 
-                auto first = Engine::MapTokens(party, condition.Variables[1]);
+    // MATH
+    void Math(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
 
-                auto second = Engine::MapTokens(party, condition.Variables[2]);
+        auto &internal_error = state.InternalError;
 
-                if (!ops.empty() && !first.empty() && !second.empty())
-                {
-                    auto check = party.If(ops, first, second);
+        internal_error = true;
 
-                    if ((condition.Type == Conditions::Type::IF_TRUE_RETURN && check) || (condition.Type == Conditions::Type::IF_FALSE_RETURN && !check))
-                    {
-                        condition.Location = party.PreviousLocation;
+        // variables
+        // 0 - operation (+, -, *)
+        // 1 - first variable (destination)
+        // 2 - second variable / value (source)
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 2)
+        {
+            auto &ops = condition.Operands[0];
 
-                        // do not trigger previous events
-                        party.Add(Character::Status::SKIP_EVENTS);
+            auto dst = Engine::MapTokens(party, condition.Operands[1]);
 
-                        // get border
-                        auto border = Engine::Color(condition.Variables[4]);
+            auto src = Engine::MapTokens(party, condition.Operands[2]);
 
-                        // show message
-                        Interface::TextBox(graphics, background, condition.Variables[3], border, BloodSword::Wrap, true);
+            if (!ops.IsEmpty() && !dst.IsEmpty() && !src.IsEmpty())
+            {
+                party.Math(ops, dst, src);
 
-                        result = true;
-                    }
+                result = true;
 
-                    internal_error = false;
-                }
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::AND || condition.Type == Conditions::Type::OR)
-        {
-            internal_error = true;
-
-            // variables
-            // 0 - 1st operation (=, !=, <>, >, <, >=. <=)
-            // 1 - 1st variable (first)
-            // 2 - 1st variable (second)
-            // 3 - 2nd operation (=, !=, <>, >, <, >=. <=)
-            // 4 - 2nd variable (first)
-            // 5 - 2nd variable (second)
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 5)
-            {
-                auto empty = 0;
+    }
 
-                for (auto i = 0; i < SafeCast(condition.Variables.size()); i++)
-                {
-                    empty += (condition.Variables[i].empty() ? 1 : 0);
-                }
+    // CHOOSE NUMBER
+    void ChooseNumber(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
 
-                if (empty == 0)
-                {
-                    auto ops1 = condition.Variables[0];
+        auto &internal_error = state.InternalError;
 
-                    auto dst1 = Engine::MapTokens(party, condition.Variables[1]);
+        internal_error = true;
 
-                    auto src1 = Engine::MapTokens(party, condition.Variables[2]);
+        // variables
+        // 0 - CHOOSE/VALUE
+        // 1 - message to display if CHOOSE in #0
+        // 2 - min if CHOOSE in #0
+        // 3 - max if CHOOSE in #0
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
+        {
+            auto number = (Engine::ToUpper(condition.Variables[0]) != "CHOOSE");
 
-                    auto first = party.If(ops1, dst1, src1);
+            if (number)
+            {
+                party.ChosenNumber = party.Number(condition.Operands[0]);
 
-                    auto ops2 = condition.Variables[3];
+                result = true;
+            }
+            else if (SafeCast(condition.Variables.size()) > 3)
+            {
+                auto min_number = party.Number(condition.Operands[2]);
 
-                    auto dst2 = Engine::MapTokens(party, condition.Variables[4]);
+                auto max_number = party.Number(condition.Operands[3]);
 
-                    auto src2 = Engine::MapTokens(party, condition.Variables[5]);
+                party.ChosenNumber = Interface::GetNumber(graphics, background, condition.Variables[1].c_str(), min_number, max_number, Asset::Map("DICE GAME"), Asset::Map("UP"), Asset::Map("DOWN"), false);
 
-                    auto second = party.If(ops2, dst2, src2);
+                result = true;
+            }
 
-                    if (condition.Type == Conditions::Type::AND)
-                    {
-                        result = (first && second);
-                    }
-                    else if (condition.Type == Conditions::Type::OR)
-                    {
-                        result = (first || second);
-                    }
-
-                    internal_error = false;
-                }
-            }
+            internal_error = false;
         }
-        else if (condition.Type == Conditions::Type::ADD_TO_ITEM)
+    }
+
+    // ROLL
+    void Roll(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        internal_error = true;
+
+        // variables
+        // 0 - number of dice to roll
+        // 1 - modifiers
+        // 2 - variable to save results to
+        // 3 - asset (CHOSEN / asset name)
+        // 4 - asset (action)
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 4)
         {
-            internal_error = true;
+            auto roll = party.Number(condition.Operands[0]);
 
-            // variables
-            // 0 - player
-            // 1 - item
-            // 2 - quantity or variable
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 2)
-            {
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+            auto mods = party.Number(condition.Operands[1]);
 
-                auto item = Item::Map(condition.Variables[1]);
+            auto variable = condition.Variables[2];
 
-                auto quantity = party.Number(condition.Variables[2]);
+            auto is_character = (Engine::ToUpper(condition.Variables[3]) == "CHOSEN");
 
-                if (character != Character::Class::NONE && item != Item::Type::NONE && quantity != 0)
-                {
-                    if (!party.Has(character))
-                    {
-                        text = Engine::NotInParty(character);
-                    }
-                    else
-                    {
-                        if (!Engine::IsAlive(party[character]))
-                        {
-                            text = Engine::IsDead(party[character]);
-                        }
-                        else
-                        {
-                            if ((party[character].Quantity(item) + quantity) >= 0)
-                            {
-                                result = true;
+            if (!is_character || (is_character && party.ChosenCharacter != Character::Class::NONE && party.Has(party.ChosenCharacter) && Engine::IsAlive(party[party.ChosenCharacter])))
+            {
+                auto asset = is_character ? party[party.ChosenCharacter].Asset : Asset::Map(condition.Variables[3]);
 
-                                party[character].Add(item, quantity);
+                auto action = Asset::Map(condition.Variables[4]);
 
-                                if (quantity > 0)
-                                {
-                                    text = "YOU GAINED " + std::to_string(quantity) + " " + Item::TypeMapping[item] + "!";
-                                }
-                                else
-                                {
-                                    text = "YOU LOST " + std::to_string(quantity) + " " + Item::TypeMapping[item] + "!";
-                                }
-                            }
-                            else
-                            {
-                                text = Engine::NotEnough(item);
-                            }
-                        }
-                    }
+                if (asset != Asset::NONE && action != Asset::NONE && !variable.empty())
+                {
+                    party.Set(variable, Interface::Roll(graphics, background, asset, action, roll, mods).Sum);
+
+                    result = true;
 
                     internal_error = false;
                 }
             }
         }
-        else if (condition.Type == Conditions::Type::SHOW_VARIABLES)
-        {
-            internal_error = true;
-
-            // variables:
-            // 0 - border color
-            // 1 - N variables to show
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 1)
-            {
-                auto border = Engine::Color(condition.Variables[0]);
-
-                auto message = std::string();
+    }
 
-                for (auto i = 1; i < SafeCast(condition.Variables.size()); i++)
-                {
-                    auto value = party.Get(condition.Variables[i]);
+    // IF
+    void If(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
 
-                    if (!condition.Variables[i].empty())
-                    {
-                        if (!value.empty() && condition.Variables[i] != value)
-                        {
-                            if (!message.empty())
-                            {
-                                message += "\n";
-                            }
+        auto &internal_error = state.InternalError;
 
-                            if (Engine::ToUpper(condition.Variables[i]) != "PLAYER")
-                            {
-                                auto n = condition.Variables[i].find(" (");
+        internal_error = true;
 
-                                if (n != std::string::npos)
-                                {
-                                    message += condition.Variables[i].substr(0, n);
-                                }
-                                else
-                                {
-                                    // show value
-                                    message += condition.Variables[i];
-                                }
+        // variables
+        // 0 - operation (=, !=, <>, >, <, >=. <=)
+        // 1 - first variable / value
+        // 2 - second variable / value
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 2)
+        {
+            auto &ops = condition.Operands[0];
 
-                                message += ": " + value;
-                            }
-                            else
-                            {
-                                message += value;
-                            }
-                        }
-                        else
-                        {
-                            // assume variable is a literal
-                            message += condition.Variables[i];
-                        }
-                    }
-                    else
-                    {
-                        // assume a blank is for spacing
-                        message += "\n";
-                    }
-                }
+            auto &first = condition.Operands[1];
 
-                if (SafeCast(message.size()) > 0)
-                {
-                    Interface::TextBox(graphics, background, message, border, BloodSword::Wrap);
-                }
+            auto &second = condition.Operands[2];
 
-                result = true;
+            if (!ops.IsEmpty() && !first.IsEmpty() && !second.IsEmpty())
+            {
+                result = party.If(ops, first, second);
 
                 internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::TAKE_ITEMS)
+    }
+
+    // IF MATH
+    void IfMath(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        internal_error = true;
+
+        // variables
+        // 0 - logical operation (=, !=, <>, >, <, >=. <=)
+        // 1 - first variable
+        // 2 - second variable
+        // 3 - math operation (*, +, -)
+        // 4 - first variable (destination)
+        // 5 - second variable / value (source)
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 4)
         {
-            internal_error = true;
+            auto &ops = condition.Operands[0];
 
-            // variables:
-            // 0 - item (type)
-            // 1 - limit
-            // 2 - asset
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 2)
-            {
-                auto item = Item::Map(condition.Variables[0]);
+            auto first = Engine::MapTokens(party, condition.Operands[1]);
 
-                auto limit = (Engine::ToUpper(condition.Variables[1]) == "UNLIMITED") ? Items::Unlimited : party.Number(condition.Variables[1]);
+            auto second = Engine::MapTokens(party, condition.Operands[2]);
 
-                auto asset = Asset::Map(condition.Variables[2]);
+            if (!ops.IsEmpty() && !first.IsEmpty() && !second.IsEmpty())
+            {
+                result = party.If(ops, first, second);
 
-                if (item != Item::Type::NONE && asset != Asset::NONE && (limit == Item::Unlimited || limit > 0))
+                if (result)
                 {
-                    Interface::TakeItems(graphics, background, party, item, asset, limit);
+                    auto &ops = condition.Operands[3];
 
-                    result = true;
+                    auto first = Engine::MapTokens(party, condition.Operands[4]);
 
-                    internal_error = false;
+                    auto second = Engine::MapTokens(party, condition.Operands[5]);
+
+                    party.Math(ops, first, second);
                 }
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::EAT_FOOD)
+    }
+
+    // IF TRUE RETURN / IF FALSE RETURN
+    void IfTrueReturn(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        internal_error = true;
+
+        // variables
+        // 0 - operation (=, !=, <>, >, <, >=. <=)
+        // 1 - first variable / value
+        // 2 - second variable / value
+        // 3 - message on return
+        // 4 - border
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 4)
         {
-            internal_error = true;
+            auto &ops = condition.Operands[0];
 
-            // variables:
-            // 0 - asset
-            // 1 - gain (ENDURANCE)
-            // 2 - limit
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 2)
-            {
-                auto asset = Asset::Map(condition.Variables[0]);
+            auto first = Engine::MapTokens(party, condition.Operands[1]);
 
-                auto gain = party.Number(condition.Variables[1]);
+            auto second = Engine::MapTokens(party, condition.Operands[2]);
 
-                auto limit = (Engine::ToUpper(condition.Variables[2]) == "UNLIMITED") ? Items::Unlimited : party.Number(condition.Variables[2]);
+            if (!ops.IsEmpty() && !first.IsEmpty() && !second.IsEmpty())
+            {
+                auto check = party.If(ops, first, second);
 
-                if (asset != Asset::NONE && (limit == Item::Unlimited || limit > 0) && gain > 0)
+                if ((condition.Type == Conditions::Type::IF_TRUE_RETURN && check) || (condition.Type == Conditions::Type::IF_FALSE_RETURN && !check))
                 {
-                    Interface::EatFood(graphics, background, party, asset, gain, limit);
+                    condition.Location = party.PreviousLocation;
 
-                    result = true;
+                    // do not trigger previous events
+                    party.Add(Character::Status::SKIP_EVENTS);
 
-                    internal_error = false;
+                    // get border
+                    auto border = Engine::Color(condition.Variables[4]);
+
+                    // show message
+                    Interface::TextBox(graphics, background, condition.Variables[3], border, BloodSword::Wrap, true);
+
+                    result = true;
                 }
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::SHOW_MESSAGE || condition.Type == Conditions::Type::TEXTBOX)
+    }
+
+    // AND / OR
+    void And(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        internal_error = true;
+
+        // variables
+        // 0 - 1st operation (=, !=, <>, >, <, >=. <=)
+        // 1 - 1st variable (first)
+        // 2 - 1st variable (second)
+        // 3 - 2nd operation (=, !=, <>, >, <, >=. <=)
+        // 4 - 2nd variable (first)
+        // 5 - 2nd variable (second)
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 5)
         {
-            internal_error = true;
+            auto empty = 0;
+
+            for (auto i = 0; i < SafeCast(condition.Variables.size()); i++)
+            {
+                empty += (condition.Variables[i].empty() ? 1 : 0);
+            }
 
-            // variables:
-            // 0 - message
-            // 1 - border color (ACTIVE, HIGHLIGHT, INACTIVE, BACKGROUND, TRANSPARENT)
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 1 && !condition.Variables[0].empty())
+            if (empty == 0)
             {
-                auto border = Engine::Color(condition.Variables[1]);
+                auto &ops1 = condition.Operands[0];
+
+                auto dst1 = Engine::MapTokens(party, condition.Operands[1]);
+
+                auto src1 = Engine::MapTokens(party, condition.Operands[2]);
+
+                auto first = party.If(ops1, dst1, src1);
+
+                auto &ops2 = condition.Operands[3];
 
-                if (condition.Type == Conditions::Type::SHOW_MESSAGE)
+                auto dst2 = Engine::MapTokens(party, condition.Operands[4]);
+
+                auto src2 = Engine::MapTokens(party, condition.Operands[5]);
+
+                auto second = party.If(ops2, dst2, src2);
+
+                if (condition.Type == Conditions::Type::AND)
                 {
-                    Interface::MessageBox(graphics, background, condition.Variables[0], border);
+                    result = (first && second);
                 }
-                else if (condition.Type == Conditions::Type::TEXTBOX)
+                else if (condition.Type == Conditions::Type::OR)
                 {
-                    Interface::TextBox(graphics, background, condition.Variables[0], border, BloodSword::OctaTile);
+                    result = (first || second);
                 }
 
-                result = true;
-
                 internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::HAS_QUANTITY_OF_ITEM)
-        {
-            internal_error = true;
+    }
 
-            // variables
-            // 0 - ALL / player
-            // 1 - item
-            // 2 - quantity
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 2)
-            {
-                auto is_party = (Engine::ToUpper(condition.Variables[0]) == "ALL");
+    // ADD TO ITEM
+    void AddToItem(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
 
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
 
-                auto item = Item::Map(condition.Variables[1]);
+        // variables
+        // 0 - player
+        // 1 - item
+        // 2 - quantity or variable
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 2)
+        {
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+
+            auto item = condition.Items[1];
 
-                auto required = party.Number(condition.Variables[2]);
+            auto quantity = party.Number(condition.Operands[2]);
 
-                if (item != Item::Type::NONE && (is_party || character != Character::Class::NONE))
+            if (character != Character::Class::NONE && item != Item::Type::NONE && quantity != 0)
+            {
+                if (!party.Has(character))
+                {
+                    text = Engine::NotInParty(character);
+                }
+                else
                 {
-                    if (is_party || (party.Has(character) && Engine::IsAlive(party[character])))
+                    if (!Engine::IsAlive(party[character]))
+                    {
+                        text = Engine::IsDead(party[character]);
+                    }
+                    else
                     {
-                        auto quantity = is_party ? Engine::Quantity(party, item) : party[character].Quantity(item);
+                        if ((party[character].Quantity(item) + quantity) >= 0)
+                        {
+                            result = true;
 
-                        result = (quantity >= required);
+                            party[character].Add(item, quantity);
 
-                        if (!result)
+                            if (quantity > 0)
+                            {
+                                text = "YOU GAINED " + std::to_string(quantity) + " " + Item::TypeMapping[item] + "!";
+                            }
+                            else
+                            {
+                                text = "YOU LOST " + std::to_string(quantity) + " " + Item::TypeMapping[item] + "!";
+                            }
+                        }
+                        else
                         {
                             text = Engine::NotEnough(item);
                         }
                     }
-                    else if (!party.Has(character))
-                    {
-                        text = Engine::NotInParty(character);
-                    }
-                    else if (!Engine::IsAlive(party[character]))
-                    {
-                        text = Engine::IsDead(party[character]);
-                    }
-
-                    internal_error = false;
                 }
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::PSYCHIC_SPELL)
-        {
-            internal_error = true;
-
-            // variables
-            // 0 - player
-            // 1 - spell
-            // 2 - target asset
-            // 3 - difficulty (when sucessfully cast)
-            // 4 - damage action asset
-            // 5 - damage roll (on failure)
-            // 6 - damage modifier (on failure)
-            // 7 - ignore armour (TRUE/FALSE)
-            // 8 - message (on failure)
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 8)
-            {
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
-
-                auto spell = Spells::Map(condition.Variables[1]);
+    }
 
-                auto target = Asset::Map(condition.Variables[2]);
+    // SHOW VARIABLES
+    void ShowVariables(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
 
-                auto difficulty = party.Number(condition.Variables[3]);
+        auto &internal_error = state.InternalError;
 
-                auto dmg_act = Asset::Map(condition.Variables[4]);
+        internal_error = true;
 
-                auto dmg_rol = party.Number(condition.Variables[5]);
+        // variables:
+        // 0 - border color
+        // 1 - N variables to show
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 1)
+        {
+            auto border = Engine::Color(condition.Variables[0]);
 
-                auto dmg_mod = party.Number(condition.Variables[6]);
+            auto message = std::string();
 
-                auto ignore_armour = (Engine::ToUpper(condition.Variables[7]) == "TRUE");
+            for (auto i = 1; i < SafeCast(condition.Variables.size()); i++)
+            {
+                auto value = party.Get(condition.Operands[i]);
 
-                if (character != Character::Class::NONE && spell != Spells::Type::NONE && target != Asset::NONE && dmg_act != Asset::NONE && difficulty > 0 && dmg_rol > 0)
+                if (!condition.Variables[i].empty())
                 {
-                    if (party.Has(character) && Engine::IsAlive(party[character]))
+                    if (!value.empty() && condition.Variables[i] != value)
                     {
-                        party[character].CallToMind(spell);
-
-                        if (Interface::Cast(graphics, background, Point(0, 0), graphics.Width, graphics.Height, party[character], spell, false))
+                        if (!message.empty())
                         {
-                            if (Interface::Roll(graphics, background, target, Spells::Assets[spell], 2, 0).Sum <= difficulty)
-                            {
-                                result = true;
-                            }
+                            message += "\n";
                         }
 
-                        if (!result)
+                        if (Engine::ToUpper(condition.Variables[i]) != "PLAYER")
                         {
-                            // spellcasting unsuccessful!
-                            auto message = condition.Variables[8].empty() ? Interface::GetText(Interface::MSG_CAST) : condition.Variables[8];
+                            auto n = condition.Variables[i].find(" (");
 
-                            Interface::MessageBox(graphics, background, message, Color::Highlight);
-
-                            if (dmg_rol > 0)
+                            if (n != std::string::npos)
                             {
-                                auto damage = Interface::Roll(graphics, background, party[character].Asset, dmg_act, dmg_rol, dmg_mod).Sum;
-
-                                damage -= ignore_armour ? 0 : Engine::Score(party[character], Attribute::Type::ARMOUR);
-
-                                if (damage > 0)
-                                {
-                                    Engine::GainEndurance(party[character], -damage);
-                                }
-
-                                if (!Engine::IsAlive(party[character]))
-                                {
-                                    auto message = party[character].Name + " KILLED!";
-
-                                    Interface::MessageBox(graphics, background, message, Color::Highlight);
-
-                                    Interface::Resurrect(graphics, background, party, party[character]);
-                                }
+                                message += condition.Variables[i].substr(0, n);
+                            }
+                            else
+                            {
+                                // show value
+                                message += condition.Variables[i];
                             }
 
-                            failed = true;
+                            message += ": " + value;
+                        }
+                        else
+                        {
+                            message += value;
                         }
                     }
-                    else if (!party.Has(character))
-                    {
-                        text = Engine::NotInParty(character);
-                    }
-                    else if (!Engine::IsAlive(party[character]))
+                    else
                     {
-                        text = Engine::IsDead(party[character]);
+                        // assume variable is a literal
+                        message += condition.Variables[i];
                     }
-
-                    internal_error = false;
+                }
+                else
+                {
+                    // assume a blank is for spacing
+                    message += "\n";
                 }
             }
-        }
-        else if (condition.Type == Conditions::Type::PSYCHIC_SPELL_GAIN_ATTRIBUTE)
-        {
-            internal_error = true;
-
-            // variables
-            // 0 - player
-            // 1 - spell
-            // 2 - target asset
-            // 3 - difficulty (when sucessfully cast)
-            // 4 - attribute
-            // 5 - gain/loss
-            // 6 - message (on failure)
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 6)
-            {
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
 
-                auto spell = Spells::Map(condition.Variables[1]);
-
-                auto target = Asset::Map(condition.Variables[2]);
+            if (SafeCast(message.size()) > 0)
+            {
+                Interface::TextBox(graphics, background, message, border, BloodSword::Wrap);
+            }
 
-                auto difficulty = party.Number(condition.Variables[3]);
+            result = true;
 
-                auto attribute = Attribute::Map(condition.Variables[4]);
+            internal_error = false;
+        }
+    }
 
-                auto gain = party.Number(condition.Variables[5]);
+    // TAKE ITEMS
+    void TakeItems(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
 
-                if (character != Character::Class::NONE && spell != Spells::Type::NONE && target != Asset::NONE && attribute != Attribute::Type::NONE && difficulty > 0 && gain != 0)
-                {
-                    if (party.Has(character) && Engine::IsAlive(party[character]))
-                    {
-                        party[character].CallToMind(spell);
+        auto &internal_error = state.InternalError;
 
-                        if (Interface::Cast(graphics, background, Point(0, 0), graphics.Width, graphics.Height, party[character], spell, false))
-                        {
-                            result = Interface::Roll(graphics, background, target, Spells::Assets[spell], 2, 0).Sum <= difficulty;
-                        }
+        internal_error = true;
 
-                        if (!result)
-                        {
-                            // spellcasting unsuccessful!
-                            auto message = condition.Variables[6].empty() ? Interface::GetText(Interface::MSG_CAST) : condition.Variables[6];
+        // variables:
+        // 0 - item (type)
+        // 1 - limit
+        // 2 - asset
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 2)
+        {
+            auto item = condition.Items[0];
 
-                            Interface::MessageBox(graphics, background, message, Color::Highlight);
+            auto limit = (Engine::ToUpper(condition.Variables[1]) == "UNLIMITED") ? Items::Unlimited : party.Number(condition.Operands[1]);
 
-                            auto value = party[character].Value(attribute) + gain;
+            auto asset = Asset::Map(condition.Variables[2]);
 
-                            party[character].Value(attribute, value);
+            if (item != Item::Type::NONE && asset != Asset::NONE && (limit == Item::Unlimited || limit > 0))
+            {
+                Interface::TakeItems(graphics, background, party, item, asset, limit);
 
-                            failed = true;
-                        }
-                    }
-                    else if (!party.Has(character))
-                    {
-                        text = Engine::NotInParty(character);
-                    }
-                    else if (!Engine::IsAlive(party[character]))
-                    {
-                        text = Engine::IsDead(party[character]);
-                    }
+                result = true;
 
-                    internal_error = false;
-                }
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::COLLECT)
-        {
-            internal_error = true;
-
-            // variables
-            // 0 - item to stake
-            // 1 - asset (to item in #0)
-            // 2 - min collect
-            // 3 - max collect
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 3)
-            {
-                auto item = Item::Map(condition.Variables[0]);
-
-                auto asset = Asset::Map(condition.Variables[1]);
+    }
 
-                auto min_collect = party.Number(condition.Variables[2]);
+    // EAT FOOD
+    void EatFood(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
 
-                auto max_collect = party.Number(condition.Variables[3]);
+        auto &internal_error = state.InternalError;
 
-                if (item != Item::Type::NONE && asset != Asset::NONE)
-                {
-                    if (Engine::Quantity(party, item) >= min_collect)
-                    {
-                        result = Interface::Collect(graphics, background, party, item, asset, min_collect, max_collect);
-                    }
-                    else
-                    {
-                        text = Engine::NotEnough(item);
-                    }
+        internal_error = true;
 
-                    internal_error = false;
-                }
-            }
-        }
-        else if (condition.Type == Conditions::Type::PERMANENT_ATTRIBUTE_GAIN)
+        // variables:
+        // 0 - asset
+        // 1 - gain (ENDURANCE)
+        // 2 - limit
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 2)
         {
-            internal_error = true;
+            auto asset = Asset::Map(condition.Variables[0]);
 
-            // variables
-            // 0 - player / all
-            // 1 - number of attributes to update
-            // 2 - gain (+/-)
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 2)
-            {
-                auto is_party = (Engine::ToUpper(condition.Variables[0]) == "ALL");
+            auto gain = party.Number(condition.Operands[1]);
 
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+            auto limit = (Engine::ToUpper(condition.Variables[2]) == "UNLIMITED") ? Items::Unlimited : party.Number(condition.Operands[2]);
 
-                auto attributes = party.Number(condition.Variables[1]);
+            if (asset != Asset::NONE && (limit == Item::Unlimited || limit > 0) && gain > 0)
+            {
+                Interface::EatFood(graphics, background, party, asset, gain, limit);
 
-                auto gain = party.Number(condition.Variables[2]);
+                result = true;
+
+                internal_error = false;
+            }
+        }
+    }
+
+    // SHOW MESSAGE / TEXTBOX
+    void ShowMessage(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        internal_error = true;
+
+        // variables:
+        // 0 - message
+        // 1 - border color (ACTIVE, HIGHLIGHT, INACTIVE, BACKGROUND, TRANSPARENT)
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 1 && !condition.Variables[0].empty())
+        {
+            auto border = Engine::Color(condition.Variables[1]);
+
+            if (condition.Type == Conditions::Type::SHOW_MESSAGE)
+            {
+                Interface::MessageBox(graphics, background, condition.Variables[0], border);
+            }
+            else if (condition.Type == Conditions::Type::TEXTBOX)
+            {
+                Interface::TextBox(graphics, background, condition.Variables[0], border, BloodSword::OctaTile);
+            }
+
+            result = true;
+
+            internal_error = false;
+        }
+    }
+
+    // HAS QUANTITY OF ITEM
+    void HasQuantityOfItem(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
 
-                if (attributes > 0 && gain != 0 && (is_party || character != Character::Class::NONE))
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables
+        // 0 - ALL / player
+        // 1 - item
+        // 2 - quantity
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 2)
+        {
+            auto is_party = (Engine::ToUpper(condition.Variables[0]) == "ALL");
+
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+
+            auto item = condition.Items[1];
+
+            auto required = party.Number(condition.Operands[2]);
+
+            if (item != Item::Type::NONE && (is_party || character != Character::Class::NONE))
+            {
+                if (is_party || (party.Has(character) && Engine::IsAlive(party[character])))
                 {
-                    if (is_party || (party.Has(character) && Engine::IsAlive(party[character])))
-                    {
-                        if (is_party)
-                        {
-                            Interface::PermanentAttributeGain(graphics, background, party, attributes, gain);
-                        }
-                        else
-                        {
-                            Interface::PermanentAttributeGain(graphics, background, party[character], attributes, gain);
-                        }
+                    auto quantity = is_party ? Engine::Quantity(party, item) : party[character].Quantity(item);
 
-                        result = true;
-                    }
-                    else if (!party.Has(character))
-                    {
-                        text = Engine::NotInParty(character);
-                    }
-                    else if (!Engine::IsAlive(party[character]))
+                    result = (quantity >= required);
+
+                    if (!result)
                     {
-                        text = Engine::IsDead(party[character]);
+                        text = Engine::NotEnough(item);
                     }
-
-                    internal_error = false;
                 }
+                else if (!party.Has(character))
+                {
+                    text = Engine::NotInParty(character);
+                }
+                else if (!Engine::IsAlive(party[character]))
+                {
+                    text = Engine::IsDead(party[character]);
+                }
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::HAS_CHARGED_ITEM)
+    }
+
+    // PSYCHIC SPELL
+    void PsychicSpell(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &failed = state.Failed;
+
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables
+        // 0 - player
+        // 1 - spell
+        // 2 - target asset
+        // 3 - difficulty (when sucessfully cast)
+        // 4 - damage action asset
+        // 5 - damage roll (on failure)
+        // 6 - damage modifier (on failure)
+        // 7 - ignore armour (TRUE/FALSE)
+        // 8 - message (on failure)
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 8)
         {
-            internal_error = true;
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
 
-            // variables
-            // 0 - item
-            // 1 - charge (item)
-            // 2 - charges (minimum)
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 2)
-            {
-                auto item = Item::Map(condition.Variables[0]);
+            auto spell = Spells::Map(condition.Variables[1]);
+
+            auto target = Asset::Map(condition.Variables[2]);
 
-                auto charge = Item::Map(condition.Variables[1]);
+            auto difficulty = party.Number(condition.Operands[3]);
 
-                auto charges = party.Number(condition.Variables[2]);
+            auto dmg_act = Asset::Map(condition.Variables[4]);
 
-                if (item != Item::Type::NONE && charge != Item::Type::NONE)
+            auto dmg_rol = party.Number(condition.Operands[5]);
+
+            auto dmg_mod = party.Number(condition.Operands[6]);
+
+            auto ignore_armour = (Engine::ToUpper(condition.Variables[7]) == "TRUE");
+
+            if (character != Character::Class::NONE && spell != Spells::Type::NONE && target != Asset::NONE && dmg_act != Asset::NONE && difficulty > 0 && dmg_rol > 0)
+            {
+                if (party.Has(character) && Engine::IsAlive(party[character]))
                 {
-                    result = party.Has(item);
+                    party[character].CallToMind(spell);
 
-                    if (result)
+                    if (Interface::Cast(graphics, background, Point(0, 0), graphics.Width, graphics.Height, party[character], spell, false))
                     {
-                        if (party.HasChargedItem(item, charge, charges))
+                        if (Interface::Roll(graphics, background, target, Spells::Assets[spell], 2, 0).Sum <= difficulty)
                         {
                             result = true;
                         }
-                        else
+                    }
+
+                    if (!result)
+                    {
+                        // spellcasting unsuccessful!
+                        auto message = condition.Variables[8].empty() ? Interface::GetText(Interface::MSG_CAST) : condition.Variables[8];
+
+                        Interface::MessageBox(graphics, background, message, Color::Highlight);
+
+                        if (dmg_rol > 0)
                         {
-                            text = Engine::NotEnough(charge);
+                            auto damage = Interface::Roll(graphics, background, party[character].Asset, dmg_act, dmg_rol, dmg_mod).Sum;
+
+                            damage -= ignore_armour ? 0 : Engine::Score(party[character], Attribute::Type::ARMOUR);
+
+                            if (damage > 0)
+                            {
+                                Engine::GainEndurance(party[character], -damage);
+                            }
+
+                            if (!Engine::IsAlive(party[character]))
+                            {
+                                auto message = party[character].Name + " KILLED!";
+
+                                Interface::MessageBox(graphics, background, message, Color::Highlight);
+
+                                Interface::Resurrect(graphics, background, party, party[character]);
+                            }
                         }
+
+                        failed = true;
                     }
-                    else
+                }
+                else if (!party.Has(character))
+                {
+                    text = Engine::NotInParty(character);
+                }
+                else if (!Engine::IsAlive(party[character]))
+                {
+                    text = Engine::IsDead(party[character]);
+                }
+
+                internal_error = false;
+            }
+        }
+    }
+
+    // PSYCHIC SPELL GAIN ATTRIBUTE
+    void PsychicSpellGainAttribute(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &failed = state.Failed;
+
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables
+        // 0 - player
+        // 1 - spell
+        // 2 - target asset
+        // 3 - difficulty (when sucessfully cast)
+        // 4 - attribute
+        // 5 - gain/loss
+        // 6 - message (on failure)
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 6)
+        {
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+
+            auto spell = Spells::Map(condition.Variables[1]);
+
+            auto target = Asset::Map(condition.Variables[2]);
+
+            auto difficulty = party.Number(condition.Operands[3]);
+
+            auto attribute = condition.Attributes[4];
+
+            auto gain = party.Number(condition.Operands[5]);
+
+            if (character != Character::Class::NONE && spell != Spells::Type::NONE && target != Asset::NONE && attribute != Attribute::Type::NONE && difficulty > 0 && gain != 0)
+            {
+                if (party.Has(character) && Engine::IsAlive(party[character]))
+                {
+                    party[character].CallToMind(spell);
+
+                    if (Interface::Cast(graphics, background, Point(0, 0), graphics.Width, graphics.Height, party[character], spell, false))
                     {
-                        text = Engine::NoItem(item);
+                        result = Interface::Roll(graphics, background, target, Spells::Assets[spell], 2, 0).Sum <= difficulty;
                     }
 
-                    internal_error = false;
+                    if (!result)
+                    {
+                        // spellcasting unsuccessful!
+                        auto message = condition.Variables[6].empty() ? Interface::GetText(Interface::MSG_CAST) : condition.Variables[6];
+
+                        Interface::MessageBox(graphics, background, message, Color::Highlight);
+
+                        auto value = party[character].Value(attribute) + gain;
+
+                        party[character].Value(attribute, value);
+
+                        failed = true;
+                    }
+                }
+                else if (!party.Has(character))
+                {
+                    text = Engine::NotInParty(character);
                 }
+                else if (!Engine::IsAlive(party[character]))
+                {
+                    text = Engine::IsDead(party[character]);
+                }
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::CHARGE || condition.Type == Conditions::Type::DISCHARGE)
+    }
+
+    // COLLECT
+    void Collect(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables
+        // 0 - item to stake
+        // 1 - asset (to item in #0)
+        // 2 - min collect
+        // 3 - max collect
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 3)
         {
-            internal_error = true;
+            auto item = condition.Items[0];
 
-            // variables
-            // 0 - item
-            // 1 - charge (item)
-            // 2 - charges (minimum)
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 2)
-            {
-                auto item = Item::Map(condition.Variables[0]);
+            auto asset = Asset::Map(condition.Variables[1]);
 
-                auto charge = Item::Map(condition.Variables[1]);
+            auto min_collect = party.Number(condition.Operands[2]);
 
-                auto charges = party.Number(condition.Variables[2]);
+            auto max_collect = party.Number(condition.Operands[3]);
 
-                if (item != Item::Type::NONE && charge != Item::Type::NONE && charges > 0)
+            if (item != Item::Type::NONE && asset != Asset::NONE)
+            {
+                if (Engine::Quantity(party, item) >= min_collect)
+                {
+                    result = Interface::Collect(graphics, background, party, item, asset, min_collect, max_collect);
+                }
+                else
                 {
-                    result = party.Has(item);
+                    text = Engine::NotEnough(item);
+                }
 
-                    if (result)
-                    {
-                        if (condition.Type == Conditions::Type::DISCHARGE)
-                        {
-                            if (party.HasChargedItem(item, charge, charges))
-                            {
-                                party.AddCharge(item, charge, -charges);
+                internal_error = false;
+            }
+        }
+    }
 
-                                result = true;
-                            }
-                            else
-                            {
-                                text = Engine::NotEnough(charge);
-                            }
-                        }
-                        else if (condition.Type == Conditions::Type::CHARGE)
-                        {
-                            party.AddCharge(item, charge, charges);
+    // PERMANENT ATTRIBUTE GAIN
+    void PermanentAttributeGain(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
 
-                            result = true;
-                        }
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables
+        // 0 - player / all
+        // 1 - number of attributes to update
+        // 2 - gain (+/-)
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 2)
+        {
+            auto is_party = (Engine::ToUpper(condition.Variables[0]) == "ALL");
+
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+
+            auto attributes = party.Number(condition.Operands[1]);
+
+            auto gain = party.Number(condition.Operands[2]);
+
+            if (attributes > 0 && gain != 0 && (is_party || character != Character::Class::NONE))
+            {
+                if (is_party || (party.Has(character) && Engine::IsAlive(party[character])))
+                {
+                    if (is_party)
+                    {
+                        Interface::PermanentAttributeGain(graphics, background, party, attributes, gain);
                     }
                     else
                     {
-                        text = Engine::NoItem(item);
+                        Interface::PermanentAttributeGain(graphics, background, party[character], attributes, gain);
                     }
 
-                    internal_error = false;
+                    result = true;
+                }
+                else if (!party.Has(character))
+                {
+                    text = Engine::NotInParty(character);
+                }
+                else if (!Engine::IsAlive(party[character]))
+                {
+                    text = Engine::IsDead(party[character]);
                 }
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::KILL_PLAYER)
+    }
+
+    // HAS CHARGED ITEM
+    void HasChargedItem(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables
+        // 0 - item
+        // 1 - charge (item)
+        // 2 - charges (minimum)
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 2)
         {
-            internal_error = true;
+            auto item = condition.Items[0];
 
-            // variables
-            // 0 - player
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
+            auto charge = condition.Items[1];
+
+            auto charges = party.Number(condition.Operands[2]);
+
+            if (item != Item::Type::NONE && charge != Item::Type::NONE)
             {
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+                result = party.Has(item);
 
-                if (character != Character::Class::NONE)
+                if (result)
                 {
-                    result = party.Has(character);
-
-                    if (!result)
+                    if (party.HasChargedItem(item, charge, charges))
                     {
-                        text = Engine::NotInParty(character);
-                    }
-                    else if (!Engine::IsAlive(party[character]))
-                    {
-                        text = Engine::IsDead(party[character]);
-
-                        result = false;
+                        result = true;
                     }
                     else
                     {
-                        // unalive player
-                        party[character].Value(Attribute::Type::ENDURANCE, 0);
-
-                        Interface::Resurrect(graphics, background, party, party[character]);
-
-                        if (!Engine::IsAlive(party[character]))
-                        {
-                            text = party[character].Name + " DIES.";
-                        }
+                        text = Engine::NotEnough(charge);
                     }
-
-                    internal_error = false;
                 }
+                else
+                {
+                    text = Engine::NoItem(item);
+                }
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::KILL_OTHERS)
+    }
+
+    // CHARGE / DISCHARGE
+    void Charge(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables
+        // 0 - item
+        // 1 - charge (item)
+        // 2 - charges (minimum)
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 2)
         {
-            internal_error = true;
+            auto item = condition.Items[0];
 
-            // variables
-            // 0 - player (not killed)
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
+            auto charge = condition.Items[1];
+
+            auto charges = party.Number(condition.Operands[2]);
+
+            if (item != Item::Type::NONE && charge != Item::Type::NONE && charges > 0)
             {
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+                result = party.Has(item);
 
-                if (character != Character::Class::NONE)
+                if (result)
                 {
-                    result = party.Has(character) && Engine::IsAlive(party[character]);
-
-                    if (result)
+                    if (condition.Type == Conditions::Type::DISCHARGE)
                     {
-                        for (auto others = 0; others < party.Count(); others++)
+                        if (party.HasChargedItem(item, charge, charges))
                         {
-                            if (Engine::IsAlive(party[others]) && party[others].Class != character)
-                            {
-                                // unalive player
-                                party[others].Value(Attribute::Type::ENDURANCE, 0);
-                            }
+                            party.AddCharge(item, charge, -charges);
+
+                            result = true;
+                        }
+                        else
+                        {
+                            text = Engine::NotEnough(charge);
                         }
                     }
-                    else if (!party.Has(character))
+                    else if (condition.Type == Conditions::Type::CHARGE)
                     {
-                        text = Engine::NotInParty(character);
+                        party.AddCharge(item, charge, charges);
+
+                        result = true;
                     }
-                    else if (!Engine::IsAlive(party[character]))
+                }
+                else
+                {
+                    text = Engine::NoItem(item);
+                }
+
+                internal_error = false;
+            }
+        }
+    }
+
+    // KILL PLAYER
+    void KillPlayer(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables
+        // 0 - player
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
+        {
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+
+            if (character != Character::Class::NONE)
+            {
+                result = party.Has(character);
+
+                if (!result)
+                {
+                    text = Engine::NotInParty(character);
+                }
+                else if (!Engine::IsAlive(party[character]))
+                {
+                    text = Engine::IsDead(party[character]);
+
+                    result = false;
+                }
+                else
+                {
+                    // unalive player
+                    party[character].Value(Attribute::Type::ENDURANCE, 0);
+
+                    Interface::Resurrect(graphics, background, party, party[character]);
+
+                    if (!Engine::IsAlive(party[character]))
                     {
-                        text = Engine::IsDead(party[character]);
+                        text = party[character].Name + " DIES.";
                     }
-
-                    internal_error = false;
                 }
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::KILL_ALL_WITH_STATUS)
+    }
+
+    // KILL OTHERS
+    void KillOthers(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables
+        // 0 - player (not killed)
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
         {
-            internal_error = true;
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
 
-            // variables
-            // 0 - status
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
+            if (character != Character::Class::NONE)
             {
-                auto status = Character::MapStatus(condition.Variables[0]);
+                result = party.Has(character) && Engine::IsAlive(party[character]);
 
-                if (status != Character::Status::NONE)
+                if (result)
                 {
-                    for (auto character = 0; character < party.Count(); character++)
+                    for (auto others = 0; others < party.Count(); others++)
                     {
-                        if (Engine::IsAlive(party[character]) && party[character].Has(status))
+                        if (Engine::IsAlive(party[others]) && party[others].Class != character)
                         {
                             // unalive player
-                            party[character].Value(Attribute::Type::ENDURANCE, 0);
-
-                            Interface::Resurrect(graphics, background, party, party[character]);
+                            party[others].Value(Attribute::Type::ENDURANCE, 0);
                         }
                     }
-
-                    internal_error = false;
-
-                    result = true;
                 }
+                else if (!party.Has(character))
+                {
+                    text = Engine::NotInParty(character);
+                }
+                else if (!Engine::IsAlive(party[character]))
+                {
+                    text = Engine::IsDead(party[character]);
+                }
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::REMOVE_PLAYER)
+    }
+
+    // KILL ALL WITH STATUS
+    void KillAllWithStatus(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        internal_error = true;
+
+        // variables
+        // 0 - status
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
         {
-            internal_error = true;
+            auto status = Character::MapStatus(condition.Variables[0]);
 
-            // variables
-            // 0 - player
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
+            if (status != Character::Status::NONE)
             {
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
-
-                if (character != Character::Class::NONE)
+                for (auto character = 0; character < party.Count(); character++)
                 {
-                    result = party.Has(character);
-
-                    if (!result)
+                    if (Engine::IsAlive(party[character]) && party[character].Has(status))
                     {
-                        text = Engine::NotInParty(character);
-                    }
-                    else if (!Engine::IsAlive(party[character]))
-                    {
-                        text = Engine::IsDead(party[character]);
+                        // unalive player
+                        party[character].Value(Attribute::Type::ENDURANCE, 0);
 
-                        result = false;
+                        Interface::Resurrect(graphics, background, party, party[character]);
                     }
-                    else
-                    {
-                        // remove player from party
-                        party.Remove(character);
+                }
 
-                        text = condition.Variables[1];
-                    }
+                internal_error = false;
 
-                    internal_error = false;
-                }
+                result = true;
             }
         }
-        else if (condition.Type == Conditions::Type::TAKE_ITEM || condition.Type == Conditions::Type::GET_ITEM)
+    }
+
+    // REMOVE PLAYER
+    void RemovePlayer(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables
+        // 0 - player
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
         {
-            internal_error = true;
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
 
-            // variables
-            // 0 - item
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
+            if (character != Character::Class::NONE)
             {
-                auto item = Item::Map(condition.Variables[0]);
+                result = party.Has(character);
 
-                if (item != Item::Type::NONE && Items::Found(item))
+                if (!result)
                 {
-                    if (Interface::CanReceive(party))
-                    {
-                        auto character = Engine::FirstClass(party);
+                    text = Engine::NotInParty(character);
+                }
+                else if (!Engine::IsAlive(party[character]))
+                {
+                    text = Engine::IsDead(party[character]);
 
-                        if (Engine::Count(party) > 1)
-                        {
-                            auto message = "WHO GETS THE " + Items::Defaults[item].Name + "?";
+                    result = false;
+                }
+                else
+                {
+                    // remove player from party
+                    party.Remove(character);
 
-                            character = Interface::SelectCharacter(graphics, background, party, message.c_str(), true, false, false, false, true);
-                        }
+                    text = condition.Variables[1];
+                }
 
-                        if (Interface::CanReceive(party[character]))
-                        {
-                            // preserve choice
-                            party.ChosenCharacter = character;
+                internal_error = false;
+            }
+        }
+    }
 
-                            party[character].Add(Items::Defaults[item]);
+    // TAKE ITEM / GET ITEM
+    void TakeItem(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
 
-                            text = party[character].Name + " TAKES THE " + Item::TypeMapping[item] + ".";
+        auto &internal_error = state.InternalError;
 
-                            result = true;
-                        }
-                        else
-                        {
-                            text = Interface::Text[Interface::MSG_FULL].Text;
-                        }
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables
+        // 0 - item
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
+        {
+            auto item = condition.Items[0];
+
+            if (item != Item::Type::NONE && Items::Found(item))
+            {
+                if (Interface::CanReceive(party))
+                {
+                    auto character = Engine::FirstClass(party);
+
+                    if (Engine::Count(party) > 1)
+                    {
+                        auto message = "WHO GETS THE " + Items::Defaults[item].Name + "?";
+
+                        character = Interface::SelectCharacter(graphics, background, party, message.c_str(), true, false, false, false, true);
+                    }
+
+                    if (Interface::CanReceive(party[character]))
+                    {
+                        // preserve choice
+                        party.ChosenCharacter = character;
+
+                        party[character].Add(Items::Defaults[item]);
+
+                        text = party[character].Name + " TAKES THE " + Item::TypeMapping[item] + ".";
+
+                        result = true;
                     }
                     else
                     {
                         text = Interface::Text[Interface::MSG_FULL].Text;
                     }
-
-                    internal_error = false;
                 }
+                else
+                {
+                    text = Interface::Text[Interface::MSG_FULL].Text;
+                }
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::GAIN_ATTRIBUTE)
-        {
-            internal_error = true;
+    }
 
-            // variables
-            // 0 - player / ALL
-            // 1 - attribute
-            // 2 - points to gain/lose
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 2)
-            {
-                auto is_party = (Engine::ToUpper(condition.Variables[0]) == "ALL");
+    // GAIN ATTRIBUTE
+    void GainAttribute(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
 
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
 
-                auto attribute = Attribute::Map(condition.Variables[1]);
+        internal_error = true;
 
-                auto gain = party.Number(condition.Variables[2]);
+        // variables
+        // 0 - player / ALL
+        // 1 - attribute
+        // 2 - points to gain/lose
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 2)
+        {
+            auto is_party = (Engine::ToUpper(condition.Variables[0]) == "ALL");
+
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+
+            auto attribute = condition.Attributes[1];
+
+            auto gain = party.Number(condition.Operands[2]);
 
-                if (attribute != Attribute::Type::NONE && (is_party || character != Character::Class::NONE))
+            if (attribute != Attribute::Type::NONE && (is_party || character != Character::Class::NONE))
+            {
+                if (is_party || (party.Has(character) && Engine::IsAlive(party[character])))
                 {
-                    if (is_party || (party.Has(character) && Engine::IsAlive(party[character])))
+                    if (is_party)
                     {
-                        if (is_party)
+                        for (auto i = 0; i < party.Count(); i++)
                         {
-                            for (auto i = 0; i < party.Count(); i++)
+                            if (Engine::IsAlive(party[i]))
                             {
-                                if (Engine::IsAlive(party[i]))
-                                {
-                                    auto value = party[i].Value(attribute) + gain;
+                                auto value = party[i].Value(attribute) + gain;
 
-                                    party[i].Value(attribute, value);
-                                }
+                                party[i].Value(attribute, value);
                             }
-
-                            auto plural = (Engine::Count(party) > 1);
-
-                            text = std::string(plural ? "EVERYONE " : "YOU ") + (gain < 0 ? "LOSE" : "GAIN") + (plural ? "S" : "") + " " + std::to_string(std::abs(gain)) + " " + Attribute::TypeMapping[attribute] + ".";
                         }
-                        else
-                        {
-                            auto value = party[character].Value(attribute) + gain;
-
-                            party[character].Value(attribute, value);
 
-                            text = party[character].Name + " " + (gain < 0 ? "LOSE" : "GAIN") + " " + std::to_string(std::abs(gain)) + " " + Attribute::TypeMapping[attribute] + ".";
-                        }
+                        auto plural = (Engine::Count(party) > 1);
 
-                        result = true;
+                        text = std::string(plural ? "EVERYONE " : "YOU ") + (gain < 0 ? "LOSE" : "GAIN") + (plural ? "S" : "") + " " + std::to_string(std::abs(gain)) + " " + Attribute::TypeMapping[attribute] + ".";
                     }
-                    else if (!party.Has(character))
-                    {
-                        text = Engine::NotInParty(character);
-                    }
-                    else if (!Engine::IsAlive(party[character]))
+                    else
                     {
-                        text = Engine::IsDead(party[character]);
+                        auto value = party[character].Value(attribute) + gain;
+
+                        party[character].Value(attribute, value);
+
+                        text = party[character].Name + " " + (gain < 0 ? "LOSE" : "GAIN") + " " + std::to_string(std::abs(gain)) + " " + Attribute::TypeMapping[attribute] + ".";
                     }
 
-                    internal_error = false;
+                    result = true;
+                }
+                else if (!party.Has(character))
+                {
+                    text = Engine::NotInParty(character);
                 }
+                else if (!Engine::IsAlive(party[character]))
+                {
+                    text = Engine::IsDead(party[character]);
+                }
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::ALL_WITH_STATUS_GAIN_ATTRIBUTE)
-        {
-            internal_error = true;
+    }
 
-            // variables
-            // 0 - status
-            // 1 - attribute
-            // 2 - points to gain/lose
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 2)
-            {
-                auto status = Character::MapStatus(condition.Variables[0]);
+    // ALL WITH STATUS GAIN ATTRIBUTE
+    void AllWithStatusGainAttribute(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
 
-                auto attribute = Attribute::Map(condition.Variables[1]);
+        auto &internal_error = state.InternalError;
 
-                auto gain = party.Number(condition.Variables[2]);
+        internal_error = true;
 
-                if (attribute != Attribute::Type::NONE && status != Character::Status::NONE && gain != 0)
+        // variables
+        // 0 - status
+        // 1 - attribute
+        // 2 - points to gain/lose
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 2)
+        {
+            auto status = Character::MapStatus(condition.Variables[0]);
+
+            auto attribute = condition.Attributes[1];
+
+            auto gain = party.Number(condition.Operands[2]);
+
+            if (attribute != Attribute::Type::NONE && status != Character::Status::NONE && gain != 0)
+            {
+                for (auto character = 0; character < party.Count(); character++)
                 {
-                    for (auto character = 0; character < party.Count(); character++)
+                    if (Engine::IsAlive(party[character]) && party[character].Has(status))
                     {
-                        if (Engine::IsAlive(party[character]) && party[character].Has(status))
-                        {
-                            auto value = party[character].Value(attribute) + gain;
+                        auto value = party[character].Value(attribute) + gain;
 
-                            party[character].Value(attribute, value);
-                        }
+                        party[character].Value(attribute, value);
                     }
+                }
 
-                    result = true;
+                result = true;
 
-                    internal_error = false;
-                }
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::ALL_WITH_STATUS_MODIFY_ATTRIBUTE)
-        {
-            internal_error = true;
+    }
 
-            // variables
-            // 0 - status
-            // 1 - attribute
-            // 2 - points to modify
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 2)
-            {
-                auto status = Character::MapStatus(condition.Variables[0]);
+    // ALL WITH STATUS MODIFY ATTRIBUTE
+    void AllWithStatusModifyAttribute(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
 
-                auto attribute = Attribute::Map(condition.Variables[1]);
+        internal_error = true;
 
-                auto gain = party.Number(condition.Variables[2]);
+        // variables
+        // 0 - status
+        // 1 - attribute
+        // 2 - points to modify
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 2)
+        {
+            auto status = Character::MapStatus(condition.Variables[0]);
+
+            auto attribute = condition.Attributes[1];
 
-                if (attribute != Attribute::Type::NONE && status != Character::Status::NONE && gain != 0)
+            auto gain = party.Number(condition.Operands[2]);
+
+            if (attribute != Attribute::Type::NONE && status != Character::Status::NONE && gain != 0)
+            {
+                for (auto character = 0; character < party.Count(); character++)
                 {
-                    for (auto character = 0; character < party.Count(); character++)
+                    if (Engine::IsAlive(party[character]) && party[character].Has(status))
                     {
-                        if (Engine::IsAlive(party[character]) && party[character].Has(status))
-                        {
-                            Engine::ModifyAttribute(party[character], attribute, gain);
-                        }
+                        Engine::ModifyAttribute(party[character], attribute, gain);
                     }
+                }
 
-                    result = true;
+                result = true;
 
-                    internal_error = false;
-                }
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::MODIFY_ATTRIBUTE)
-        {
-            internal_error = true;
+    }
 
-            // variables
-            // 0 - player / ALL
-            // 1 - attribute
-            // 2 - points to modify
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 2)
-            {
-                auto is_party = (Engine::ToUpper(condition.Variables[0]) == "ALL");
+    // MODIFY ATTRIBUTE
+    void ModifyAttribute(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
 
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+        auto &internal_error = state.InternalError;
 
-                auto attribute = Attribute::Map(condition.Variables[1]);
+        auto &text = state.Text;
 
-                auto gain = party.Number(condition.Variables[2]);
+        internal_error = true;
 
-                if (attribute != Attribute::Type::NONE && (is_party || character != Character::Class::NONE))
-                {
-                    if (is_party || (party.Has(character) && Engine::IsAlive(party[character])))
-                    {
-                        if (is_party)
-                        {
-                            Engine::ModifyAttribute(party, attribute, gain);
+        // variables
+        // 0 - player / ALL
+        // 1 - attribute
+        // 2 - points to modify
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 2)
+        {
+            auto is_party = (Engine::ToUpper(condition.Variables[0]) == "ALL");
 
-                            auto plural = (Engine::Count(party) > 1);
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
 
-                            text = std::string(plural ? "EVERYONE " : "YOU ") + "PERMANENTLY " + (gain < 0 ? "LOSE" : "GAIN") + (plural ? "S" : "") + " " + std::to_string(std::abs(gain)) + " " + Attribute::TypeMapping[attribute] + ".";
-                        }
-                        else
-                        {
-                            Engine::ModifyAttribute(party[character], attribute, gain);
+            auto attribute = condition.Attributes[1];
 
-                            text = party[character].Name + " PERMANENTLY " + (gain < 0 ? "LOSE" : "GAIN") + " " + std::to_string(std::abs(gain)) + " " + Attribute::TypeMapping[attribute] + ".";
-                        }
+            auto gain = party.Number(condition.Operands[2]);
 
-                        result = true;
-                    }
-                    else if (!party.Has(character))
+            if (attribute != Attribute::Type::NONE && (is_party || character != Character::Class::NONE))
+            {
+                if (is_party || (party.Has(character) && Engine::IsAlive(party[character])))
+                {
+                    if (is_party)
                     {
-                        text = Engine::NotInParty(character);
+                        Engine::ModifyAttribute(party, attribute, gain);
+
+                        auto plural = (Engine::Count(party) > 1);
+
+                        text = std::string(plural ? "EVERYONE " : "YOU ") + "PERMANENTLY " + (gain < 0 ? "LOSE" : "GAIN") + (plural ? "S" : "") + " " + std::to_string(std::abs(gain)) + " " + Attribute::TypeMapping[attribute] + ".";
                     }
-                    else if (!Engine::IsAlive(party[character]))
+                    else
                     {
-                        text = Engine::IsDead(party[character]);
+                        Engine::ModifyAttribute(party[character], attribute, gain);
+
+                        text = party[character].Name + " PERMANENTLY " + (gain < 0 ? "LOSE" : "GAIN") + " " + std::to_string(std::abs(gain)) + " " + Attribute::TypeMapping[attribute] + ".";
                     }
 
-                    internal_error = false;
+                    result = true;
+                }
+                else if (!party.Has(character))
+                {
+                    text = Engine::NotInParty(character);
                 }
+                else if (!Engine::IsAlive(party[character]))
+                {
+                    text = Engine::IsDead(party[character]);
+                }
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::MAXIMISE_ATTRIBUTE || condition.Type == Conditions::Type::MAXIMIZE_ATTRIBUTE)
-        {
-            internal_error = true;
+    }
 
-            // variables
-            // 0 - player / ALL
-            // 1 - attribute
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 1)
-            {
-                auto is_party = (Engine::ToUpper(condition.Variables[0]) == "ALL");
+    // MAXIMISE ATTRIBUTE / MAXIMIZE ATTRIBUTE
+    void MaximiseAttribute(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
 
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables
+        // 0 - player / ALL
+        // 1 - attribute
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 1)
+        {
+            auto is_party = (Engine::ToUpper(condition.Variables[0]) == "ALL");
+
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
 
-                auto attribute = Attribute::Map(condition.Variables[1]);
+            auto attribute = condition.Attributes[1];
 
-                if (attribute != Attribute::Type::NONE && (is_party || character != Character::Class::NONE))
+            if (attribute != Attribute::Type::NONE && (is_party || character != Character::Class::NONE))
+            {
+                if (is_party || (party.Has(character) && Engine::IsAlive(party[character])))
                 {
-                    if (is_party || (party.Has(character) && Engine::IsAlive(party[character])))
+                    if (is_party)
                     {
-                        if (is_party)
+                        if (condition.Type == Conditions::Type::MAXIMISE_ATTRIBUTE)
                         {
-                            if (condition.Type == Conditions::Type::MAXIMISE_ATTRIBUTE)
-                            {
-                                Engine::MaximiseAttribute(party, attribute);
-                            }
-                            else
-                            {
-                                Engine::MaximizeAttribute(party, attribute);
-                            }
-
-                            auto plural = (Engine::Count(party) > 1);
-
-                            text = std::string(plural ? "EVERYONE's " : "YOUR ") + Attribute::TypeMapping[attribute] + " IS RESTORED TO MAXIMUM";
+                            Engine::MaximiseAttribute(party, attribute);
                         }
                         else
                         {
-                            if (condition.Type == Conditions::Type::MAXIMISE_ATTRIBUTE)
-                            {
-                                Engine::MaximiseAttribute(party[character], attribute);
-                            }
-                            else
-                            {
-                                Engine::MaximizeAttribute(party[character], attribute);
-                            }
-
-                            text = party[character].Name + "'s " + Attribute::TypeMapping[attribute] + " IS RESTORED TO MAXIMUM";
+                            Engine::MaximizeAttribute(party, attribute);
                         }
 
-                        result = true;
-                    }
-                    else if (!party.Has(character))
-                    {
-                        text = Engine::NotInParty(character);
+                        auto plural = (Engine::Count(party) > 1);
+
+                        text = std::string(plural ? "EVERYONE's " : "YOUR ") + Attribute::TypeMapping[attribute] + " IS RESTORED TO MAXIMUM";
                     }
-                    else if (!Engine::IsAlive(party[character]))
+                    else
                     {
-                        text = Engine::IsDead(party[character]);
+                        if (condition.Type == Conditions::Type::MAXIMISE_ATTRIBUTE)
+                        {
+                            Engine::MaximiseAttribute(party[character], attribute);
+                        }
+                        else
+                        {
+                            Engine::MaximizeAttribute(party[character], attribute);
+                        }
+
+                        text = party[character].Name + "'s " + Attribute::TypeMapping[attribute] + " IS RESTORED TO MAXIMUM";
                     }
 
-                    internal_error = false;
+                    result = true;
+                }
+                else if (!party.Has(character))
+                {
+                    text = Engine::NotInParty(character);
                 }
+                else if (!Engine::IsAlive(party[character]))
+                {
+                    text = Engine::IsDead(party[character]);
+                }
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::ITEM_EFFECT)
+    }
+
+    // ITEM EFFECT
+    void ItemEffect(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables
+        // 0 - item (type)
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
         {
-            internal_error = true;
+            auto item = condition.Items[0];
 
-            // variables
-            // 0 - item (type)
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
+            if (item != Item::Type::NONE)
             {
-                auto item = Item::Map(condition.Variables[0]);
-
-                if (item != Item::Type::NONE)
+                if (party.ChosenCharacter == Character::Class::NONE)
                 {
-                    if (party.ChosenCharacter == Character::Class::NONE)
+                    for (auto i = 0; i < party.Count(); i++)
                     {
-                        for (auto i = 0; i < party.Count(); i++)
+                        if (Engine::IsAlive(party[i]) && party[i].Has(item))
                         {
-                            if (Engine::IsAlive(party[i]) && party[i].Has(item))
-                            {
-                                party.ChosenCharacter = party[i].Class;
+                            party.ChosenCharacter = party[i].Class;
 
-                                break;
-                            }
+                            break;
                         }
                     }
+                }
 
-                    if (party.ChosenCharacter != Character::Class::NONE)
+                if (party.ChosenCharacter != Character::Class::NONE)
+                {
+                    if (party.Has(party.ChosenCharacter) && Engine::IsAlive(party[party.ChosenCharacter]))
                     {
-                        if (party.Has(party.ChosenCharacter) && Engine::IsAlive(party[party.ChosenCharacter]))
-                        {
-                            auto &chosen = party[party.ChosenCharacter];
-
-                            if (chosen.Has(item))
-                            {
-                                Interface::ItemEffects(graphics, background, party, chosen, item);
+                        auto &chosen = party[party.ChosenCharacter];
 
-                                result = true;
-                            }
-                            else
-                            {
-                                text = Engine::NoItem(item);
-                            }
-                        }
-                        else if (!party.Has(party.ChosenCharacter))
+                        if (chosen.Has(item))
                         {
-                            text = Engine::NotInParty(party.ChosenCharacter);
+                            Interface::ItemEffects(graphics, background, party, chosen, item);
+
+                            result = true;
                         }
-                        else if (party.Has(party.ChosenCharacter) && !Engine::IsAlive(party[party.ChosenCharacter]))
+                        else
                         {
-                            text = Engine::IsDead(party[party.ChosenCharacter]);
+                            text = Engine::NoItem(item);
                         }
-
-                        internal_error = false;
                     }
+                    else if (!party.Has(party.ChosenCharacter))
+                    {
+                        text = Engine::NotInParty(party.ChosenCharacter);
+                    }
+                    else if (party.Has(party.ChosenCharacter) && !Engine::IsAlive(party[party.ChosenCharacter]))
+                    {
+                        text = Engine::IsDead(party[party.ChosenCharacter]);
+                    }
+
+                    internal_error = false;
                 }
             }
         }
-        else if (condition.Type == Conditions::Type::DAMAGE_PLAYER)
-        {
-            internal_error = true;
-
-            // variables
-            // 0 - player
-            // 1 - roll
-            // 2 - modifier
-            // 3 - ignore armour
-            // 4 - display
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 4)
-            {
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+    }
 
-                auto roll = party.Number(condition.Variables[1]);
+    // DAMAGE PLAYER
+    void DamagePlayer(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
 
-                auto modifier = party.Number(condition.Variables[2]);
+        auto &internal_error = state.InternalError;
 
-                auto ignore_armour = (Engine::ToUpper(condition.Variables[3]) == "TRUE");
+        auto &text = state.Text;
 
-                auto display = (Engine::ToUpper(condition.Variables[4]) == "TRUE");
+        internal_error = true;
 
-                if (character != Character::Class::NONE)
-                {
-                    if (party.Has(character) && Engine::IsAlive(party[character]))
-                    {
-                        auto damage = Interface::DamagePlayer(graphics, background, party[character], roll, modifier, ignore_armour, false, display);
+        // variables
+        // 0 - player
+        // 1 - roll
+        // 2 - modifier
+        // 3 - ignore armour
+        // 4 - display
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 4)
+        {
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
 
-                        auto color = Color::Inactive;
+            auto roll = party.Number(condition.Operands[1]);
 
-                        auto message = std::string();
+            auto modifier = party.Number(condition.Operands[2]);
 
-                        if (damage > 0)
-                        {
-                            message = party[character].Name + " LOSES " + std::to_string(damage) + " ENDURANCE";
+            auto ignore_armour = (Engine::ToUpper(condition.Variables[3]) == "TRUE");
 
-                            color = Color::Highlight;
+            auto display = (Engine::ToUpper(condition.Variables[4]) == "TRUE");
 
-                            Interface::Resurrect(graphics, background, party, party[character]);
-                        }
-                        else
-                        {
-                            message = party[character].Name + " IS UNHARMED";
-                        }
+            if (character != Character::Class::NONE)
+            {
+                if (party.Has(character) && Engine::IsAlive(party[character]))
+                {
+                    auto damage = Interface::DamagePlayer(graphics, background, party[character], roll, modifier, ignore_armour, false, display);
 
-                        if (display)
-                        {
-                            Interface::MessageBox(graphics, background, text, color);
-                        }
-                        else
-                        {
-                            text = message;
-                        }
+                    auto color = Color::Inactive;
 
-                        result = true;
-                    }
-                    else if (!party.Has(character))
+                    auto message = std::string();
+
+                    if (damage > 0)
                     {
-                        text = Engine::NotInParty(character);
+                        message = party[character].Name + " LOSES " + std::to_string(damage) + " ENDURANCE";
+
+                        color = Color::Highlight;
+
+                        Interface::Resurrect(graphics, background, party, party[character]);
                     }
-                    else if (!Engine::IsAlive(party[character]))
+                    else
                     {
-                        text = Engine::IsDead(party[character]);
+                        message = party[character].Name + " IS UNHARMED";
+                    }
 
-                        result = false;
+                    if (display)
+                    {
+                        Interface::MessageBox(graphics, background, text, color);
+                    }
+                    else
+                    {
+                        text = message;
                     }
 
-                    internal_error = false;
+                    result = true;
+                }
+                else if (!party.Has(character))
+                {
+                    text = Engine::NotInParty(character);
                 }
+                else if (!Engine::IsAlive(party[character]))
+                {
+                    text = Engine::IsDead(party[character]);
+
+                    result = false;
+                }
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::DAMAGE_PARTY)
+    }
+
+    // DAMAGE PARTY
+    void DamageParty(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        internal_error = true;
+
+        // variables
+        // 0 - targets
+        // 1 - rounds
+        // 2 - roll
+        // 3 - modifier
+        // 4 - ignore armour
+        // 5 - display
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 5)
         {
-            internal_error = true;
-
-            // variables
-            // 0 - targets
-            // 1 - rounds
-            // 2 - roll
-            // 3 - modifier
-            // 4 - ignore armour
-            // 5 - display
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 5)
-            {
-                auto targets = party.Number(condition.Variables[0]);
+            auto targets = party.Number(condition.Operands[0]);
 
-                auto rounds = party.Number(condition.Variables[1]);
+            auto rounds = party.Number(condition.Operands[1]);
 
-                auto roll = party.Number(condition.Variables[2]);
+            auto roll = party.Number(condition.Operands[2]);
 
-                auto modifier = party.Number(condition.Variables[3]);
+            auto modifier = party.Number(condition.Operands[3]);
 
-                auto ignore_armour = Engine::ToUpper(condition.Variables[4]) == "TRUE";
+            auto ignore_armour = Engine::ToUpper(condition.Variables[4]) == "TRUE";
 
-                auto display = Engine::ToUpper(condition.Variables[5]) == "TRUE";
+            auto display = Engine::ToUpper(condition.Variables[5]) == "TRUE";
 
-                if (targets > 0 && roll > 0)
-                {
-                    Interface::DamageParty(graphics, background, party, targets, rounds, roll, modifier, ignore_armour, false, display);
+            if (targets > 0 && roll > 0)
+            {
+                Interface::DamageParty(graphics, background, party, targets, rounds, roll, modifier, ignore_armour, false, display);
 
-                    result = true;
+                result = true;
 
-                    internal_error = false;
-                }
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::DAMAGE_EVERYONE)
+    }
+
+    // DAMAGE EVERYONE
+    void DamageEveryone(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        internal_error = true;
+
+        // variables
+        // 0 - roll
+        // 1 - modifier
+        // 2 - ignore armour
+        // 3 - display
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 3)
         {
-            internal_error = true;
-
-            // variables
-            // 0 - roll
-            // 1 - modifier
-            // 2 - ignore armour
-            // 3 - display
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 3)
-            {
-                auto roll = party.Number(condition.Variables[0]);
+            auto roll = party.Number(condition.Operands[0]);
 
-                auto modifier = party.Number(condition.Variables[1]);
+            auto modifier = party.Number(condition.Operands[1]);
 
-                auto ignore_armour = Engine::ToUpper(condition.Variables[2]) == "TRUE";
+            auto ignore_armour = Engine::ToUpper(condition.Variables[2]) == "TRUE";
 
-                auto display = Engine::ToUpper(condition.Variables[3]) == "TRUE";
+            auto display = Engine::ToUpper(condition.Variables[3]) == "TRUE";
 
-                if (roll > 0)
+            if (roll > 0)
+            {
+                for (auto character = 0; character < party.Count(); character++)
                 {
-                    for (auto character = 0; character < party.Count(); character++)
+                    if (Engine::IsAlive(party[character]))
                     {
-                        if (Engine::IsAlive(party[character]))
-                        {
-                            Interface::DamagePlayer(graphics, background, party[character], roll, modifier, ignore_armour, false, display);
-                        }
+                        Interface::DamagePlayer(graphics, background, party[character], roll, modifier, ignore_armour, false, display);
                     }
+                }
 
-                    result = true;
+                result = true;
 
-                    internal_error = false;
-                }
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::LOSE_ENDURANCE || condition.Type == Conditions::Type::GAIN_ENDURANCE)
-        {
-            internal_error = true;
+    }
 
-            // variables
-            // 0 - player
-            // 1 - endurance
-            // 2 - ignore armour
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 2)
-            {
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+    // LOSE ENDURANCE / GAIN ENDURANCE
+    void LoseEndurance(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables
+        // 0 - player
+        // 1 - endurance
+        // 2 - ignore armour
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 2)
+        {
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
 
-                auto endurance = party.Number(condition.Variables[1]);
+            auto endurance = party.Number(condition.Operands[1]);
 
-                auto ignore_armour = (Engine::ToUpper(condition.Variables[2]) == "TRUE");
+            auto ignore_armour = (Engine::ToUpper(condition.Variables[2]) == "TRUE");
 
-                if (character != Character::Class::NONE && endurance > 0)
+            if (character != Character::Class::NONE && endurance > 0)
+            {
+                if (party.Has(character) && Engine::IsAlive(party[character]))
                 {
-                    if (party.Has(character) && Engine::IsAlive(party[character]))
+                    if (condition.Type == Conditions::Type::LOSE_ENDURANCE)
                     {
-                        if (condition.Type == Conditions::Type::LOSE_ENDURANCE)
-                        {
-                            endurance -= ignore_armour ? 0 : Engine::Score(party[character], Attribute::Type::ARMOUR, false);
+                        endurance -= ignore_armour ? 0 : Engine::Score(party[character], Attribute::Type::ARMOUR, false);
 
-                            endurance = -endurance;
-                        }
+                        endurance = -endurance;
+                    }
 
-                        Engine::GainEndurance(party[character], endurance, false);
+                    Engine::GainEndurance(party[character], endurance, false);
 
-                        if (endurance < 0)
-                        {
-                            text = party[character].Name + " LOSES " + std::to_string(endurance) + " ENDURANCE";
+                    if (endurance < 0)
+                    {
+                        text = party[character].Name + " LOSES " + std::to_string(endurance) + " ENDURANCE";
 
-                            if (!Engine::IsAlive(party[character]))
-                            {
-                                Interface::Resurrect(graphics, background, party, party[character]);
-                            }
-                        }
-                        else if (endurance > 0)
-                        {
-                            text = party[character].Name + " GAINS " + std::to_string(endurance) + " ENDURANCE";
-                        }
-                        else
+                        if (!Engine::IsAlive(party[character]))
                         {
-                            text = party[character].Name + " IS UNHARMED";
+                            Interface::Resurrect(graphics, background, party, party[character]);
                         }
-
-                        result = true;
                     }
-                    else if (!party.Has(character))
+                    else if (endurance > 0)
                     {
-                        text = Engine::NotInParty(character);
+                        text = party[character].Name + " GAINS " + std::to_string(endurance) + " ENDURANCE";
                     }
-                    else if (!Engine::IsAlive(party[character]))
+                    else
                     {
-                        text = Engine::IsDead(party[character]);
+                        text = party[character].Name + " IS UNHARMED";
                     }
 
-                    internal_error = false;
+                    result = true;
+                }
+                else if (!party.Has(character))
+                {
+                    text = Engine::NotInParty(character);
+                }
+                else if (!Engine::IsAlive(party[character]))
+                {
+                    text = Engine::IsDead(party[character]);
                 }
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::FAIL_THEN_DIE)
-        {
-            internal_error = true;
+    }
 
-            // variables
-            // 0 - player
-            // 1 - attribute
-            // 2 - failure message
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 2)
-            {
-                auto is_party = (Engine::ToUpper(condition.Variables[0]) == "ALL");
+    // FAIL THEN DIE
+    void FailThenDie(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
 
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables
+        // 0 - player
+        // 1 - attribute
+        // 2 - failure message
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 2)
+        {
+            auto is_party = (Engine::ToUpper(condition.Variables[0]) == "ALL");
 
-                auto attribute = Attribute::Map(condition.Variables[1]);
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
 
-                if ((is_party || character != Character::Class::NONE) && attribute != Attribute::Type::NONE)
+            auto attribute = condition.Attributes[1];
+
+            if ((is_party || character != Character::Class::NONE) && attribute != Attribute::Type::NONE)
+            {
+                if (!is_party && !party.Has(character))
                 {
-                    if (!is_party && !party.Has(character))
-                    {
-                        text = Engine::NotInParty(character);
-                    }
-                    else if (!is_party && !Engine::IsAlive(party[character]))
+                    text = Engine::NotInParty(character);
+                }
+                else if (!is_party && !Engine::IsAlive(party[character]))
+                {
+                    text = Engine::IsDead(party[character]);
+                }
+                else
+                {
+                    auto characters = std::vector<Character::Class>();
+
+                    if (!is_party)
                     {
-                        text = Engine::IsDead(party[character]);
+                        characters = {character};
                     }
                     else
                     {
-                        auto characters = std::vector<Character::Class>();
-
-                        if (!is_party)
-                        {
-                            characters = {character};
-                        }
-                        else
+                        for (auto i = 0; i < party.Count(); i++)
                         {
-                            for (auto i = 0; i < party.Count(); i++)
+                            if (Engine::IsAlive(party[i]))
                             {
-                                if (Engine::IsAlive(party[i]))
-                                {
-                                    characters.push_back(party[i].Class);
-                                }
+                                characters.push_back(party[i].Class);
                             }
                         }
+                    }
 
-                        for (auto i = 0; i < SafeCast(characters.size()); i++)
-                        {
-                            auto test = Interface::Test(graphics, background, party[characters[i]], attribute);
+                    for (auto i = 0; i < SafeCast(characters.size()); i++)
+                    {
+                        auto test = Interface::Test(graphics, background, party[characters[i]], attribute);
 
-                            if (!test)
-                            {
-                                auto message = party[characters[i]].Name + " " + condition.Variables[2];
+                        if (!test)
+                        {
+                            auto message = party[characters[i]].Name + " " + condition.Variables[2];
 
-                                Interface::MessageBox(graphics, background, message, Color::Highlight);
+                            Interface::MessageBox(graphics, background, message, Color::Highlight);
 
-                                // unalive player
-                                party[characters[i]].Value(Attribute::Type::ENDURANCE, 0);
+                            // unalive player
+                            party[characters[i]].Value(Attribute::Type::ENDURANCE, 0);
 
-                                if (!Engine::IsAlive(party[characters[i]]))
-                                {
-                                    Interface::Resurrect(graphics, background, party, party[characters[i]]);
-                                }
+                            if (!Engine::IsAlive(party[characters[i]]))
+                            {
+                                Interface::Resurrect(graphics, background, party, party[characters[i]]);
                             }
                         }
                     }
+                }
 
-                    result = true;
+                result = true;
 
-                    internal_error = false;
-                }
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::SELECT_DICE)
+    }
+
+    // SELECT DICE
+    void SelectDice(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables
+        // 0 - player
+        // 1 - message
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 1)
         {
-            internal_error = true;
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
 
-            // variables
-            // 0 - player
-            // 1 - message
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 1)
+            if (character != Character::Class::NONE)
             {
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
-
-                if (character != Character::Class::NONE)
+                if (party.Has(character) && Engine::IsAlive(party[character]))
                 {
-                    if (party.Has(character) && Engine::IsAlive(party[character]))
-                    {
-                        party.ChosenNumber = Interface::SelectDice(graphics, background, condition.Variables[1]);
-
-                        result = true;
-                    }
-                    else if (!party.Has(character))
-                    {
-                        text = Engine::NotInParty(character);
-                    }
-                    else if (!Engine::IsAlive(party[character]))
-                    {
-                        text = Engine::IsDead(party[character]);
-                    }
+                    party.ChosenNumber = Interface::SelectDice(graphics, background, condition.Variables[1]);
 
-                    internal_error = false;
+                    result = true;
+                }
+                else if (!party.Has(character))
+                {
+                    text = Engine::NotInParty(character);
                 }
+                else if (!Engine::IsAlive(party[character]))
+                {
+                    text = Engine::IsDead(party[character]);
+                }
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::MULTIPLE_DICE)
-        {
-            internal_error = true;
+    }
 
-            // variables
-            // 0 - player
-            // 1 - message
-            // 2 - number of dice to select
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 2)
-            {
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+    // MULTIPLE DICE
+    void MultipleDice(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
 
-                auto message = condition.Variables[1];
+        auto &internal_error = state.InternalError;
 
-                auto number = party.Number(condition.Variables[2]);
+        auto &text = state.Text;
 
-                if (character != Character::Class::NONE)
-                {
-                    if (party.Has(character) && Engine::IsAlive(party[character]) && number >= 1 && number <= 6)
-                    {
-                        auto choice = Interface::SelectDice(graphics, background, message, number);
+        internal_error = true;
+
+        // variables
+        // 0 - player
+        // 1 - message
+        // 2 - number of dice to select
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 2)
+        {
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
 
-                        party.ChosenNumber = choice.Sum;
+            auto message = condition.Variables[1];
 
-                        result = true;
-                    }
-                    else if (!party.Has(character))
-                    {
-                        text = Engine::NotInParty(character);
-                    }
-                    else if (!Engine::IsAlive(party[character]))
-                    {
-                        text = Engine::IsDead(party[character]);
-                    }
+            auto number = party.Number(condition.Operands[2]);
 
-                    internal_error = false;
+            if (character != Character::Class::NONE)
+            {
+                if (party.Has(character) && Engine::IsAlive(party[character]) && number >= 1 && number <= 6)
+                {
+                    auto choice = Interface::SelectDice(graphics, background, message, number);
+
+                    party.ChosenNumber = choice.Sum;
+
+                    result = true;
                 }
+                else if (!party.Has(character))
+                {
+                    text = Engine::NotInParty(character);
+                }
+                else if (!Engine::IsAlive(party[character]))
+                {
+                    text = Engine::IsDead(party[character]);
+                }
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::IS_ALIVE)
+    }
+
+    // IS ALIVE
+    void IsAlive(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables
+        // 0 - player / ALL
+        // 1 - message / text
+        // 2 - display in textbox (TRUE / FALSE)
+        // 3 - border color on display
+        if (SafeCast(condition.Variables.size()) > 2)
         {
-            internal_error = true;
-
-            // variables
-            // 0 - player / ALL
-            // 1 - message / text
-            // 2 - display in textbox (TRUE / FALSE)
-            // 3 - border color on display
-            if (SafeCast(condition.Variables.size()) > 2)
-            {
-                auto is_party = (Engine::ToUpper(condition.Variables[0]) == "ALL");
+            auto is_party = (Engine::ToUpper(condition.Variables[0]) == "ALL");
 
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
 
-                auto display = (Engine::ToUpper(condition.Variables[2]) == "TRUE");
+            auto display = (Engine::ToUpper(condition.Variables[2]) == "TRUE");
 
-                if (is_party || character != Character::Class::NONE)
+            if (is_party || character != Character::Class::NONE)
+            {
+                if (is_party || party.Has(character))
                 {
-                    if (is_party || party.Has(character))
-                    {
-                        result = is_party ? Engine::IsAlive(party) : Engine::IsAlive(party[character]);
+                    result = is_party ? Engine::IsAlive(party) : Engine::IsAlive(party[character]);
 
-                        if (result && SafeCast(condition.Variables.size()) > 2 && !condition.Variables[1].empty())
+                    if (result && SafeCast(condition.Variables.size()) > 2 && !condition.Variables[1].empty())
+                    {
+                        if (display)
                         {
-                            if (display)
-                            {
-                                auto border = Engine::Color(condition.Variables[3]);
+                            auto border = Engine::Color(condition.Variables[3]);
 
-                                Interface::TextBox(graphics, background, condition.Variables[1], border, BloodSword::Wrap);
-                            }
-                            else
-                            {
-                                text = condition.Variables[1];
-                            }
+                            Interface::TextBox(graphics, background, condition.Variables[1], border, BloodSword::Wrap);
+                        }
+                        else
+                        {
+                            text = condition.Variables[1];
                         }
                     }
-                    else if (!is_party)
-                    {
-                        text = Engine::NotInParty(character);
-                    }
-
-                    internal_error = false;
                 }
+                else if (!is_party)
+                {
+                    text = Engine::NotInParty(character);
+                }
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::GAIN_EXPERIENCE)
-        {
-            internal_error = true;
+    }
 
-            // variables
-            // 0 - experience to gain
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
-            {
-                auto experience = std::stoi(condition.Variables[0], nullptr, 10);
+    // GAIN EXPERIENCE
+    void GainExperience(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
 
-                if (experience > 0 && Engine::Count(party) != 0)
-                {
-                    auto share = experience / Engine::Count(party);
+        auto &internal_error = state.InternalError;
 
-                    Engine::GainExperience(party, share);
-                }
+        internal_error = true;
 
-                result = true;
+        // variables
+        // 0 - experience to gain
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
+        {
+            auto experience = condition.Operands[0].Number;
 
-                internal_error = false;
+            if (experience > 0 && Engine::Count(party) != 0)
+            {
+                auto share = experience / Engine::Count(party);
+
+                Engine::GainExperience(party, share);
             }
+
+            result = true;
+
+            internal_error = false;
         }
-        else if (condition.Type == Conditions::Type::TEST_DISCHARGE_ITEM)
+    }
+
+    // TEST DISCHARGE ITEM
+    void TestDischargeItem(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables
+        // 0 - character (in party able to test)
+        // 1 - item (in current section)
+        // 2 - amount to discharge (on failure)
+        // 3 - message on success (not discharged)
+        // 4 - message on failure
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 4)
         {
-            internal_error = true;
-
-            // variables
-            // 0 - character (in party able to test)
-            // 1 - item (in current section)
-            // 2 - amount to discharge (on failure)
-            // 3 - message on success (not discharged)
-            // 4 - message on failure
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 4)
-            {
-                auto current = Story::CurrentBook.Find(party.Location);
+            auto current = Story::CurrentBook.Find(party.Location);
 
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
 
-                auto item = Item::Map(condition.Variables[1]);
+            auto item = condition.Items[1];
 
-                auto charge = Item::Requirements(item);
+            auto charge = Item::Requirements(item);
 
-                auto discharge = party.Number(condition.Variables[2]);
+            auto discharge = party.Number(condition.Operands[2]);
 
-                if (item != Item::Type::NONE && charge != Item::Type::NONE && discharge > 0)
+            if (item != Item::Type::NONE && charge != Item::Type::NONE && discharge > 0)
+            {
+                if (current >= 0 && current < SafeCast(Story::CurrentBook.Sections.size()) && SafeCast(Story::CurrentBook[current].Items.size()) > 0)
                 {
-                    if (current >= 0 && current < SafeCast(Story::CurrentBook.Sections.size()) && SafeCast(Story::CurrentBook.Sections[current].Items.size()) > 0)
-                    {
-                        auto &section = Story::CurrentBook.Sections[current];
+                    auto &section = Story::CurrentBook[current];
 
-                        auto found = Items::Find(section.Items, item, charge);
+                    auto found = Items::Find(section.Items, item, charge);
 
-                        auto available = (found != section.Items.end() && (*found).Quantity >= discharge);
+                    auto available = (found != section.Items.end() && (*found).Quantity >= discharge);
 
-                        if (available)
+                    if (available)
+                    {
+                        if (!party.Has(character) || !Engine::IsAlive(party[character]))
                         {
-                            if (!party.Has(character) || !Engine::IsAlive(party[character]))
-                            {
-                                (*found).Quantity -= discharge;
+                            (*found).Quantity -= discharge;
 
-                                (*found).Quantity = std::max(0, (*found).Quantity);
+                            (*found).Quantity = std::max(0, (*found).Quantity);
 
-                                text = condition.Variables[4];
-                            }
-                            else
-                            {
-                                text = condition.Variables[3];
-                            }
-
-                            result = true;
-                        }
-                        else if (found == section.Items.end())
-                        {
-                            text = "NOTHING TO TEST HERE";
+                            text = condition.Variables[4];
                         }
                         else
                         {
-                            text = Item::TypeMapping[charge] + " EXHAUSTED";
+                            text = condition.Variables[3];
                         }
+
+                        result = true;
                     }
-                    else if (current >= 0 && current < SafeCast(Story::CurrentBook.Sections.size()))
+                    else if (found == section.Items.end())
                     {
                         text = "NOTHING TO TEST HERE";
                     }
-
-                    internal_error = false;
+                    else
+                    {
+                        text = Item::TypeMapping[charge] + " EXHAUSTED";
+                    }
+                }
+                else if (current >= 0 && current < SafeCast(Story::CurrentBook.Sections.size()))
+                {
+                    text = "NOTHING TO TEST HERE";
                 }
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::TASK)
+    }
+
+    // TASK
+    void Task(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables
+        // 0 - player / ALL
+        // 1 - task
+        // 2 - CHECK/SET
+        // 3 - status
+        // 4 - message on failure
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 4)
         {
-            internal_error = true;
-
-            // variables
-            // 0 - player / ALL
-            // 1 - task
-            // 2 - CHECK/SET
-            // 3 - status
-            // 4 - message on failure
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 4)
-            {
-                auto is_party = (Engine::ToUpper(condition.Variables[0]) == "ALL");
+            auto is_party = (Engine::ToUpper(condition.Variables[0]) == "ALL");
 
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
 
-                auto task = Engine::ToUpper(condition.Variables[1]);
+            auto task = Engine::ToUpper(condition.Variables[1]);
 
-                auto check = (Engine::ToUpper(condition.Variables[2]) == "CHECK");
+            auto check = (Engine::ToUpper(condition.Variables[2]) == "CHECK");
 
-                auto set = (Engine::ToUpper(condition.Variables[2]) == "SET");
+            auto set = (Engine::ToUpper(condition.Variables[2]) == "SET");
 
-                auto status = Task::Map(condition.Variables[3]);
+            auto status = Task::Map(condition.Variables[3]);
 
-                if ((is_party || (character != Character::Class::NONE)) && (check || set) && !task.empty() && status != Task::Status::NONE)
+            if ((is_party || (character != Character::Class::NONE)) && (check || set) && !task.empty() && status != Task::Status::NONE)
+            {
+                if (is_party || party.Has(character))
                 {
-                    if (is_party || party.Has(character))
+                    if (set)
                     {
-                        if (set)
+                        if (is_party)
                         {
-                            if (is_party)
-                            {
-                                Engine::TaskStatus(party, task, status);
+                            Engine::TaskStatus(party, task, status);
 
-                                result = true;
-                            }
-                            else if (Engine::IsAlive(party[character]))
-                            {
-                                Engine::TaskStatus(party, character, task, status);
+                            result = true;
+                        }
+                        else if (Engine::IsAlive(party[character]))
+                        {
+                            Engine::TaskStatus(party, character, task, status);
 
-                                result = true;
-                            }
-                            else
-                            {
-                                text = Engine::IsDead(party[character]);
-                            }
+                            result = true;
                         }
-                        else if (check)
+                        else
                         {
-                            result = is_party ? Engine::CheckTask(party, task, status) : Engine::CheckTask(party, character, task, status);
+                            text = Engine::IsDead(party[character]);
+                        }
+                    }
+                    else if (check)
+                    {
+                        result = is_party ? Engine::CheckTask(party, task, status) : Engine::CheckTask(party, character, task, status);
 
-                            if (!result)
+                        if (!result)
+                        {
+                            if (!is_party && !Engine::IsAlive(party[character]))
                             {
-                                if (!is_party && !Engine::IsAlive(party[character]))
-                                {
-                                    text = Engine::IsDead(party[character]);
-                                }
-                                else
-                                {
-                                    text = condition.Variables[4];
-                                }
+                                text = Engine::IsDead(party[character]);
+                            }
+                            else
+                            {
+                                text = condition.Variables[4];
                             }
                         }
                     }
-                    else if (!is_party && !party.Has(character))
-                    {
-                        text = Engine::NotInParty(character);
-                    }
-
-                    internal_error = false;
                 }
+                else if (!is_party && !party.Has(character))
+                {
+                    text = Engine::NotInParty(character);
+                }
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::LOSE_UNEQUIPPED)
+    }
+
+    // LOSE UNEQUIPPED
+    void LoseUnequipped(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables
+        // 0 - player / ALL
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
         {
-            internal_error = true;
+            auto is_party = (Engine::ToUpper(condition.Variables[0]) == "ALL");
 
-            // variables
-            // 0 - player / ALL
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
-            {
-                auto is_party = (Engine::ToUpper(condition.Variables[0]) == "ALL");
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
 
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+            if (is_party || character != Character::Class::NONE)
+            {
+                auto characters = std::vector<Character::Class>();
 
-                if (is_party || character != Character::Class::NONE)
+                if (is_party || (party.Has(character) && Engine::IsAlive(party[character])))
                 {
-                    auto characters = std::vector<Character::Class>();
-
-                    if (is_party || (party.Has(character) && Engine::IsAlive(party[character])))
+                    if (is_party)
                     {
-                        if (is_party)
+                        for (auto i = 0; i < party.Count(); i++)
                         {
-                            for (auto i = 0; i < party.Count(); i++)
+                            if (Engine::IsAlive(party[i]))
                             {
-                                if (Engine::IsAlive(party[i]))
-                                {
-                                    characters.push_back(party[i].Class);
-                                }
+                                characters.push_back(party[i].Class);
                             }
                         }
-                        else
-                        {
-                            characters = {character};
-                        }
+                    }
+                    else
+                    {
+                        characters = {character};
+                    }
 
-                        for (auto &character_class : characters)
-                        {
-                            auto items = Items::Inventory();
+                    for (auto &character_class : characters)
+                    {
+                        auto items = Items::Inventory();
 
-                            auto &current = party[character_class];
+                        auto &current = party[character_class];
 
-                            // drop items that are either not equipped or can be dropped
-                            for (auto i = 0; i < SafeCast(current.Items.size()); i++)
-                            {
-                                auto cannot_drop = current.Items[i].Is(Item::Property::CANNOT_DROP);
+                        // drop items that are either not equipped or can be dropped
+                        for (auto i = 0; i < SafeCast(current.Items.size()); i++)
+                        {
+                            auto cannot_drop = current.Items[i].Is(Item::Property::CANNOT_DROP);
 
-                                auto weapon = current.Items[i].HasAll({Item::Property::WEAPON, Item::Property::PRIMARY, Item::Property::EQUIPPED});
+                            auto weapon = current.Items[i].HasAll({Item::Property::WEAPON, Item::Property::PRIMARY, Item::Property::EQUIPPED});
 
-                                auto armour = current.Items[i].HasAll({Item::Property::ARMOUR, Item::Property::EQUIPPED});
+                            auto armour = current.Items[i].HasAll({Item::Property::ARMOUR, Item::Property::EQUIPPED});
 
-                                if (cannot_drop || armour || weapon)
-                                {
-                                    items.push_back(current.Items[i]);
-                                }
+                            if (cannot_drop || armour || weapon)
+                            {
+                                items.push_back(current.Items[i]);
                             }
-
-                            current.Items = items;
                         }
 
-                        result = true;
-                    }
-                    else if (!party.Has(character))
-                    {
-                        text = Engine::NotInParty(character);
-                    }
-                    else
-                    {
-                        text = Engine::IsDead(party[character]);
+                        current.Items = items;
                     }
 
-                    internal_error = false;
+                    result = true;
                 }
+                else if (!party.Has(character))
+                {
+                    text = Engine::NotInParty(character);
+                }
+                else
+                {
+                    text = Engine::IsDead(party[character]);
+                }
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::LOSE_EVERYTHING)
+    }
+
+    // LOSE EVERYTHING
+    void LoseEverything(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables
+        // 0 - player / ALL
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
         {
-            internal_error = true;
+            auto is_party = (Engine::ToUpper(condition.Variables[0]) == "ALL");
 
-            // variables
-            // 0 - player / ALL
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
-            {
-                auto is_party = (Engine::ToUpper(condition.Variables[0]) == "ALL");
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
 
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+            if (is_party || character != Character::Class::NONE)
+            {
+                auto characters = std::vector<Character::Class>();
 
-                if (is_party || character != Character::Class::NONE)
+                if (is_party || (party.Has(character) && Engine::IsAlive(party[character])))
                 {
-                    auto characters = std::vector<Character::Class>();
-
-                    if (is_party || (party.Has(character) && Engine::IsAlive(party[character])))
+                    if (is_party)
                     {
-                        if (is_party)
+                        for (auto i = 0; i < party.Count(); i++)
                         {
-                            for (auto i = 0; i < party.Count(); i++)
+                            if (Engine::IsAlive(party[i]))
                             {
-                                if (Engine::IsAlive(party[i]))
-                                {
-                                    characters.push_back(party[i].Class);
-                                }
+                                characters.push_back(party[i].Class);
                             }
                         }
-                        else
-                        {
-                            characters = {character};
-                        }
+                    }
+                    else
+                    {
+                        characters = {character};
+                    }
 
-                        for (auto &character_class : characters)
-                        {
-                            auto items = Items::Inventory();
+                    for (auto &character_class : characters)
+                    {
+                        auto items = Items::Inventory();
 
-                            auto &current = party[character_class];
+                        auto &current = party[character_class];
 
-                            // drop items that are either not equipped or can be dropped
-                            for (auto i = 0; i < SafeCast(current.Items.size()); i++)
-                            {
-                                auto cannot_drop = current.Items[i].Is(Item::Property::CANNOT_DROP) && current.Items[i].Contains == Item::Type::GOLD;
+                        // drop items that are either not equipped or can be dropped
+                        for (auto i = 0; i < SafeCast(current.Items.size()); i++)
+                        {
+                            auto cannot_drop = current.Items[i].Is(Item::Property::CANNOT_DROP) && current.Items[i].Contains == Item::Type::GOLD;
 
-                                auto weapon = current.Items[i].HasAll({Item::Property::WEAPON, Item::Property::PRIMARY, Item::Property::EQUIPPED});
+                            auto weapon = current.Items[i].HasAll({Item::Property::WEAPON, Item::Property::PRIMARY, Item::Property::EQUIPPED});
 
-                                auto armour = current.Items[i].HasAll({Item::Property::ARMOUR, Item::Property::EQUIPPED});
+                            auto armour = current.Items[i].HasAll({Item::Property::ARMOUR, Item::Property::EQUIPPED});
 
-                                if (cannot_drop || armour || weapon)
-                                {
-                                    items.push_back(current.Items[i]);
-                                }
+                            if (cannot_drop || armour || weapon)
+                            {
+                                items.push_back(current.Items[i]);
                             }
-
-                            current.Items = items;
                         }
 
-                        result = true;
-                    }
-                    else if (!party.Has(character))
-                    {
-                        text = Engine::NotInParty(character);
-                    }
-                    else
-                    {
-                        text = Engine::IsDead(party[character]);
+                        current.Items = items;
                     }
 
-                    internal_error = false;
+                    result = true;
                 }
+                else if (!party.Has(character))
+                {
+                    text = Engine::NotInParty(character);
+                }
+                else
+                {
+                    text = Engine::IsDead(party[character]);
+                }
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::LOSE_EVERYTHING_EXCEPT_WEAPONS)
+    }
+
+    // LOSE EVERYTHING EXCEPT WEAPONS
+    void LoseEverythingExceptWeapons(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables
+        // 0 - player / ALL
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
         {
-            internal_error = true;
+            auto is_party = (Engine::ToUpper(condition.Variables[0]) == "ALL");
 
-            // variables
-            // 0 - player / ALL
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
-            {
-                auto is_party = (Engine::ToUpper(condition.Variables[0]) == "ALL");
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
 
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+            if (is_party || character != Character::Class::NONE)
+            {
+                auto characters = std::vector<Character::Class>();
 
-                if (is_party || character != Character::Class::NONE)
+                if (is_party || (party.Has(character) && Engine::IsAlive(party[character])))
                 {
-                    auto characters = std::vector<Character::Class>();
-
-                    if (is_party || (party.Has(character) && Engine::IsAlive(party[character])))
+                    if (is_party)
                     {
-                        if (is_party)
+                        for (auto i = 0; i < party.Count(); i++)
                         {
-                            for (auto i = 0; i < party.Count(); i++)
+                            if (Engine::IsAlive(party[i]))
                             {
-                                if (Engine::IsAlive(party[i]))
-                                {
-                                    characters.push_back(party[i].Class);
-                                }
+                                characters.push_back(party[i].Class);
                             }
                         }
-                        else
-                        {
-                            characters = {character};
-                        }
+                    }
+                    else
+                    {
+                        characters = {character};
+                    }
 
-                        for (auto &character_class : characters)
-                        {
-                            auto items = Items::Inventory();
+                    for (auto &character_class : characters)
+                    {
+                        auto items = Items::Inventory();
 
-                            auto &current = party[character_class];
+                        auto &current = party[character_class];
 
-                            // drop all items except weapons
-                            for (auto i = 0; i < SafeCast(current.Items.size()); i++)
+                        // drop all items except weapons
+                        for (auto i = 0; i < SafeCast(current.Items.size()); i++)
+                        {
+                            if (current.Items[i].HasAll({Item::Property::WEAPON, Item::Property::PRIMARY, Item::Property::EQUIPPED}))
                             {
-                                if (current.Items[i].HasAll({Item::Property::WEAPON, Item::Property::PRIMARY, Item::Property::EQUIPPED}))
-                                {
-                                    items.push_back(current.Items[i]);
-                                }
+                                items.push_back(current.Items[i]);
                             }
-
-                            current.Items = items;
                         }
 
-                        result = true;
-                    }
-                    else if (!party.Has(character))
-                    {
-                        text = Engine::NotInParty(character);
-                    }
-                    else
-                    {
-                        text = Engine::IsDead(party[character]);
+                        current.Items = items;
                     }
 
-                    internal_error = false;
+                    result = true;
+                }
+                else if (!party.Has(character))
+                {
+                    text = Engine::NotInParty(character);
                 }
+                else
+                {
+                    text = Engine::IsDead(party[character]);
+                }
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::TAKE_FROM_LIST)
+    }
+
+    // TAKE FROM LIST
+    void TakeFromList(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables
+        // 0 - player
+        // 1 - N items
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 1)
         {
-            internal_error = true;
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
 
-            // variables
-            // 0 - player
-            // 1 - N items
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 1)
+            if (character != Character::Class::NONE)
             {
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
-
-                if (character != Character::Class::NONE)
+                if (party.Has(character) && Engine::IsAlive(party[character]))
                 {
-                    if (party.Has(character) && Engine::IsAlive(party[character]))
-                    {
-                        auto items = Items::List();
-
-                        for (auto i = 1; i < SafeCast(condition.Variables.size()); i++)
-                        {
-                            auto item = Item::Map(condition.Variables[i]);
+                    auto items = Items::List();
 
-                            if (item != Item::Type::NONE)
-                            {
-                                items.push_back(item);
-                            }
-                        }
+                    for (auto i = 1; i < SafeCast(condition.Variables.size()); i++)
+                    {
+                        auto item = condition.Items[i];
 
-                        if (SafeCast(items.size()) > 0)
+                        if (item != Item::Type::NONE)
                         {
-                            Interface::TakeFromInfiniteList(graphics, background, party, character, items, true);
-
-                            result = true;
+                            items.push_back(item);
                         }
                     }
-                    else if (!party.Has(character))
-                    {
-                        text = Engine::NotInParty(character);
-                    }
-                    else if (!Engine::IsAlive(party[character]))
+
+                    if (SafeCast(items.size()) > 0)
                     {
-                        text = Engine::IsDead(party[character]);
-                    }
+                        Interface::TakeFromInfiniteList(graphics, background, party, character, items, true);
 
-                    internal_error = false;
+                        result = true;
+                    }
+                }
+                else if (!party.Has(character))
+                {
+                    text = Engine::NotInParty(character);
+                }
+                else if (!Engine::IsAlive(party[character]))
+                {
+                    text = Engine::IsDead(party[character]);
                 }
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::GAUNTLET)
+    }
+
+    // GAUNTLET
+    void Gauntlet(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &failed = state.Failed;
+
+        auto &internal_error = state.InternalError;
+
+        internal_error = true;
+
+        // variables
+        // 0 - rounds
+        // 1 - rolls
+        // 2 - roll modifier
+        // 3 - difficulty
+        // 4 - damage
+        // 5 - damage modifier
+        // 6 - asset
+        // 7 - damage prefix
+        // 8 - success message
+        // 9 - failure message
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 9)
         {
-            internal_error = true;
-
-            // variables
-            // 0 - rounds
-            // 1 - rolls
-            // 2 - roll modifier
-            // 3 - difficulty
-            // 4 - damage
-            // 5 - damage modifier
-            // 6 - asset
-            // 7 - damage prefix
-            // 8 - success message
-            // 9 - failure message
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 9)
-            {
-                Interface::Gauntlet gauntlet;
+            Interface::Gauntlet gauntlet;
 
-                gauntlet.Rounds = party.Number(condition.Variables[0]);
+            gauntlet.Rounds = party.Number(condition.Operands[0]);
 
-                gauntlet.Rolls = party.Number(condition.Variables[1]);
+            gauntlet.Rolls = party.Number(condition.Operands[1]);
 
-                gauntlet.RollModifier = party.Number(condition.Variables[2]);
+            gauntlet.RollModifier = party.Number(condition.Operands[2]);
 
-                gauntlet.Difficulty = party.Number(condition.Variables[3]);
+            gauntlet.Difficulty = party.Number(condition.Operands[3]);
 
-                gauntlet.Damage = party.Number(condition.Variables[4]);
+            gauntlet.Damage = party.Number(condition.Operands[4]);
 
-                gauntlet.DamageModifier = party.Number(condition.Variables[5]);
+            gauntlet.DamageModifier = party.Number(condition.Operands[5]);
 
-                auto asset = Asset::Map(condition.Variables[6]);
+            auto asset = Asset::Map(condition.Variables[6]);
 
-                auto prefix = condition.Variables[7];
+            auto prefix = condition.Variables[7];
 
-                if (gauntlet.Rounds > 0 && gauntlet.Rolls > 0 && gauntlet.Difficulty > 0 && gauntlet.Damage > 0 && asset != Asset::NONE && !prefix.empty())
-                {
-                    result = Interface::RunGauntlet(graphics, background, party, gauntlet, asset, prefix);
+            if (gauntlet.Rounds > 0 && gauntlet.Rolls > 0 && gauntlet.Difficulty > 0 && gauntlet.Damage > 0 && asset != Asset::NONE && !prefix.empty())
+            {
+                result = Interface::RunGauntlet(graphics, background, party, gauntlet, asset, prefix);
 
-                    if (result)
+                if (result)
+                {
+                    if (!condition.Variables[8].empty())
                     {
-                        if (!condition.Variables[8].empty())
-                        {
-                            Interface::TextBox(graphics, background, condition.Variables[8], Color::Active, BloodSword::Wrap, true);
-                        }
+                        Interface::TextBox(graphics, background, condition.Variables[8], Color::Active, BloodSword::Wrap, true);
                     }
-                    else
+                }
+                else
+                {
+                    if (Engine::IsAlive(party))
                     {
-                        if (Engine::IsAlive(party))
-                        {
-                            failed = true;
+                        failed = true;
 
-                            if (!condition.Variables[9].empty())
-                            {
-                                Interface::TextBox(graphics, background, condition.Variables[9], Color::Inactive, BloodSword::Wrap, true);
-                            }
+                        if (!condition.Variables[9].empty())
+                        {
+                            Interface::TextBox(graphics, background, condition.Variables[9], Color::Inactive, BloodSword::Wrap, true);
                         }
                     }
-
-                    internal_error = false;
                 }
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::ORDER_FRONT || condition.Type == Conditions::Type::ORDER_FIRST)
+    }
+
+    // ORDER FRONT / ORDER FIRST
+    void OrderFront(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
         {
-            internal_error = true;
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
 
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
+            if (character != Character::Class::NONE)
             {
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
-
-                if (character != Character::Class::NONE)
+                if (party.Has(character) && Engine::IsAlive(party[character]))
                 {
-                    if (party.Has(character) && Engine::IsAlive(party[character]))
-                    {
-                        auto new_order = std::vector<Character::Base>();
+                    auto new_order = std::vector<Character::Base>();
 
-                        // put selected CHARACTER at the front
-                        new_order.push_back(party[character]);
+                    // put selected CHARACTER at the front
+                    new_order.push_back(party[character]);
 
-                        for (auto i = 0; i < party.Count(); i++)
+                    for (auto i = 0; i < party.Count(); i++)
+                    {
+                        if (party[i].Class != character)
                         {
-                            if (party[i].Class != character)
-                            {
-                                new_order.push_back(party[i]);
-                            }
+                            new_order.push_back(party[i]);
                         }
+                    }
 
-                        party.Clear();
-
-                        for (auto i = 0; i < SafeCast(new_order.size()); i++)
-                        {
-                            party.Add(new_order[i]);
-                        }
+                    party.Clear();
 
-                        result = true;
-                    }
-                    else if (!party.Has(character))
-                    {
-                        text = Engine::NotInParty(character);
-                    }
-                    else if (!Engine::IsAlive(party[character]))
+                    for (auto i = 0; i < SafeCast(new_order.size()); i++)
                     {
-                        text = Engine::IsDead(party[character]);
+                        party.Add(new_order[i]);
                     }
 
-                    internal_error = false;
+                    result = true;
+                }
+                else if (!party.Has(character))
+                {
+                    text = Engine::NotInParty(character);
+                }
+                else if (!Engine::IsAlive(party[character]))
+                {
+                    text = Engine::IsDead(party[character]);
                 }
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::ORDER_BACK || condition.Type == Conditions::Type::ORDER_LAST)
+    }
+
+    // ORDER BACK / ORDER LAST
+    void OrderBack(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
         {
-            internal_error = true;
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
 
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
+            if (character != Character::Class::NONE)
             {
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
-
-                if (character != Character::Class::NONE)
+                if (party.Has(character) && Engine::IsAlive(party[character]))
                 {
-                    if (party.Has(character) && Engine::IsAlive(party[character]))
-                    {
-                        auto new_order = std::vector<Character::Base>();
+                    auto new_order = std::vector<Character::Base>();
 
-                        for (auto i = 0; i < party.Count(); i++)
+                    for (auto i = 0; i < party.Count(); i++)
+                    {
+                        if (party[i].Class != character)
                         {
-                            if (party[i].Class != character)
-                            {
-                                new_order.push_back(party[i]);
-                            }
+                            new_order.push_back(party[i]);
                         }
+                    }
 
-                        // put selected CHARACTER at the back
-                        new_order.push_back(party[character]);
-
-                        party.Clear();
+                    // put selected CHARACTER at the back
+                    new_order.push_back(party[character]);
 
-                        for (auto i = 0; i < SafeCast(new_order.size()); i++)
-                        {
-                            party.Add(new_order[i]);
-                        }
+                    party.Clear();
 
-                        result = true;
-                    }
-                    else if (!party.Has(character))
-                    {
-                        text = Engine::NotInParty(character);
-                    }
-                    else if (!Engine::IsAlive(party[character]))
+                    for (auto i = 0; i < SafeCast(new_order.size()); i++)
                     {
-                        text = Engine::IsDead(party[character]);
+                        party.Add(new_order[i]);
                     }
 
-                    internal_error = false;
+                    result = true;
+                }
+                else if (!party.Has(character))
+                {
+                    text = Engine::NotInParty(character);
                 }
+                else if (!Engine::IsAlive(party[character]))
+                {
+                    text = Engine::IsDead(party[character]);
+                }
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::DAMAGE_ON_FAIL)
+    }
+
+    // DAMAGE ON FAIL
+    void DamageOnFail(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &failed = state.Failed;
+
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables
+        // 0 - player
+        // 1 - attribute
+        // 2 - damage
+        // 3 - message on success
+        // 4 - message on fail
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 4)
         {
-            internal_error = true;
-
-            // variables
-            // 0 - player
-            // 1 - attribute
-            // 2 - damage
-            // 3 - message on success
-            // 4 - message on fail
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 4)
-            {
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
 
-                auto attribute = Attribute::Map(condition.Variables[1]);
+            auto attribute = condition.Attributes[1];
 
-                if (character != Character::Class::NONE && attribute != Attribute::Type::NONE)
+            if (character != Character::Class::NONE && attribute != Attribute::Type::NONE)
+            {
+                if (!party.Has(character))
                 {
-                    if (!party.Has(character))
-                    {
-                        text = Engine::NotInParty(character);
-                    }
-                    else if (!Engine::IsAlive(party[character]))
-                    {
-                        text = Engine::IsDead(party[character]);
-                    }
-                    else
-                    {
-                        auto test = Interface::Test(graphics, background, party[character], attribute);
-
-                        if (!test)
-                        {
-                            failed = true;
+                    text = Engine::NotInParty(character);
+                }
+                else if (!Engine::IsAlive(party[character]))
+                {
+                    text = Engine::IsDead(party[character]);
+                }
+                else
+                {
+                    auto test = Interface::Test(graphics, background, party[character], attribute);
 
-                            auto endurance = party.Number(condition.Variables[2]);
+                    if (!test)
+                    {
+                        failed = true;
 
-                            Engine::GainEndurance(party[character], -endurance, false);
+                        auto endurance = party.Number(condition.Operands[2]);
 
-                            text = condition.Variables[4];
-                        }
-                        else
-                        {
-                            text = condition.Variables[3];
+                        Engine::GainEndurance(party[character], -endurance, false);
 
-                            result = true;
-                        }
+                        text = condition.Variables[4];
                     }
-
-                    if (!Engine::IsAlive(party[character]))
+                    else
                     {
-                        Interface::Resurrect(graphics, background, party, party[character]);
+                        text = condition.Variables[3];
+
+                        result = true;
                     }
+                }
 
-                    internal_error = false;
+                if (!Engine::IsAlive(party[character]))
+                {
+                    Interface::Resurrect(graphics, background, party, party[character]);
                 }
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::DAMAGE_PARTY_ON_FAIL)
+    }
+
+    // DAMAGE PARTY ON FAIL
+    void DamagePartyOnFail(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables
+        // 0 - attribute
+        // 1 - damage roll
+        // 2 - damage modifier
+        // 3 - ignore armour
+        // 4 - message on success
+        // 5 - message on fail
+        // 6 - display
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 6)
         {
-            internal_error = true;
-
-            // variables
-            // 0 - attribute
-            // 1 - damage roll
-            // 2 - damage modifier
-            // 3 - ignore armour
-            // 4 - message on success
-            // 5 - message on fail
-            // 6 - display
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 6)
-            {
-                auto attribute = Attribute::Map(condition.Variables[0]);
+            auto attribute = condition.Attributes[0];
 
-                auto damage = party.Number(condition.Variables[1]);
+            auto damage = party.Number(condition.Operands[1]);
 
-                auto modifier = party.Number(condition.Variables[2]);
+            auto modifier = party.Number(condition.Operands[2]);
 
-                auto ignore_armour = (Engine::ToUpper(condition.Variables[3]) == "TRUE");
+            auto ignore_armour = (Engine::ToUpper(condition.Variables[3]) == "TRUE");
 
-                auto display = (Engine::ToUpper(condition.Variables[6]) == "TRUE");
+            auto display = (Engine::ToUpper(condition.Variables[6]) == "TRUE");
 
-                if (attribute != Attribute::Type::NONE && damage > 0)
+            if (attribute != Attribute::Type::NONE && damage > 0)
+            {
+                for (auto character = 0; character < party.Count(); character++)
                 {
-                    for (auto character = 0; character < party.Count(); character++)
+                    if (Engine::IsAlive(party[character]))
                     {
-                        if (Engine::IsAlive(party[character]))
-                        {
-                            auto test = Interface::Test(graphics, background, party[character], attribute);
-
-                            if (!test)
-                            {
-                                if (!condition.Variables[5].empty())
-                                {
-                                    if (display)
-                                    {
-                                        Interface::MessageBox(graphics, background, party[character].Name + " " + condition.Variables[5], Color::Highlight);
-                                    }
-                                    else
-                                    {
-                                        text += (party[character].Name + " " + condition.Variables[5] + "\n");
-                                    }
-                                }
-
-                                Interface::DamagePlayer(graphics, background, party[character], damage, modifier, ignore_armour, false, display);
+                        auto test = Interface::Test(graphics, background, party[character], attribute);
 
-                                if (!Engine::IsAlive(party[character]))
-                                {
-                                    Interface::Resurrect(graphics, background, party, party[character]);
-                                }
-                            }
-                            else if (!condition.Variables[4].empty())
+                        if (!test)
+                        {
+                            if (!condition.Variables[5].empty())
                             {
                                 if (display)
                                 {
-                                    Interface::MessageBox(graphics, background, party[character].Name + " " + condition.Variables[4], Color::Active);
+                                    Interface::MessageBox(graphics, background, party[character].Name + " " + condition.Variables[5], Color::Highlight);
                                 }
                                 else
                                 {
-                                    text += (party[character].Name + " " + condition.Variables[4] + "\n");
+                                    text += (party[character].Name + " " + condition.Variables[5] + "\n");
                                 }
                             }
+
+                            Interface::DamagePlayer(graphics, background, party[character], damage, modifier, ignore_armour, false, display);
+
+                            if (!Engine::IsAlive(party[character]))
+                            {
+                                Interface::Resurrect(graphics, background, party, party[character]);
+                            }
+                        }
+                        else if (!condition.Variables[4].empty())
+                        {
+                            if (display)
+                            {
+                                Interface::MessageBox(graphics, background, party[character].Name + " " + condition.Variables[4], Color::Active);
+                            }
+                            else
+                            {
+                                text += (party[character].Name + " " + condition.Variables[4] + "\n");
+                            }
                         }
                     }
+                }
 
-                    result = Engine::IsAlive(party);
+                result = Engine::IsAlive(party);
 
-                    internal_error = false;
-                }
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::COMBAT_TASK || condition.Type == Conditions::Type::COMBAT_MISSION)
+    }
+
+    // COMBAT TASK / COMBAT MISSION
+    void CombatTask(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        internal_error = true;
+
+        // variables
+        // 0 - status to apply (usually AWAY)
+        // 1 - limit (to number of players doing the task)
+        // 2 - mission rounds
+        // 3 - character selection prompt (message)
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 3)
         {
-            internal_error = true;
-
-            // variables
-            // 0 - status to apply (usually AWAY)
-            // 1 - limit (to number of players doing the task)
-            // 2 - mission rounds
-            // 3 - character selection prompt (message)
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 3)
-            {
-                auto status = Character::MapStatus(condition.Variables[0]);
+            auto status = Character::MapStatus(condition.Variables[0]);
 
-                auto limit = party.Number(condition.Variables[1]);
+            auto limit = party.Number(condition.Operands[1]);
 
-                auto rounds = party.Number(condition.Variables[2]);
+            auto rounds = party.Number(condition.Operands[2]);
 
-                auto mission = condition.Variables[3];
+            auto mission = condition.Variables[3];
 
-                if (status != Character::Status::NONE && limit > 0 && rounds > 1 && !mission.empty())
-                {
-                    // remove status from entire party
-                    party.Remove(status);
+            if (status != Character::Status::NONE && limit > 0 && rounds > 1 && !mission.empty())
+            {
+                // remove status from entire party
+                party.Remove(status);
 
-                    if (Engine::Count(party) > 1 && (limit < Engine::Count(party) || (limit > 1 && (limit - 1) < Engine::Count(party))))
-                    {
-                        limit = std::min(limit, Engine::Count(party) - 1);
+                if (Engine::Count(party) > 1 && (limit < Engine::Count(party) || (limit > 1 && (limit - 1) < Engine::Count(party))))
+                {
+                    limit = std::min(limit, Engine::Count(party) - 1);
 
-                        Interface::SelectMultiple(graphics, background, party, mission.c_str(), status, limit, true);
+                    Interface::SelectMultiple(graphics, background, party, mission.c_str(), status, limit, true);
 
-                        for (auto i = 0; i < party.Count(); i++)
+                    for (auto i = 0; i < party.Count(); i++)
+                    {
+                        if (Engine::IsAlive(party[i]) && party[i].Has(status))
                         {
-                            if (Engine::IsAlive(party[i]) && party[i].Has(status))
-                            {
-                                party[i].Status[status] = rounds;
-                            }
+                            party[i].Status[status] = rounds;
                         }
                     }
+                }
 
-                    result = true;
+                result = true;
 
-                    internal_error = false;
-                }
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::GAIN_ARMOUR)
-        {
-            internal_error = true;
+    }
 
-            // variables
-            // 0 - player
-            // 1 - gain
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 1)
-            {
-                auto is_party = (Engine::ToUpper(condition.Variables[0]) == "ALL");
+    // GAIN ARMOUR
+    void GainArmour(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
 
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
 
-                auto gain = party.Number(condition.Variables[1]);
+        // variables
+        // 0 - player
+        // 1 - gain
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 1)
+        {
+            auto is_party = (Engine::ToUpper(condition.Variables[0]) == "ALL");
+
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
 
-                if ((is_party || character != Character::Class::NONE) && gain != 0)
+            auto gain = party.Number(condition.Operands[1]);
+
+            if ((is_party || character != Character::Class::NONE) && gain != 0)
+            {
+                if (!is_party && !party.Has(character))
                 {
-                    if (!is_party && !party.Has(character))
-                    {
-                        text = Engine::NotInParty(character);
-                    }
-                    else if (!is_party && !Engine::IsAlive(party[character]))
+                    text = Engine::NotInParty(character);
+                }
+                else if (!is_party && !Engine::IsAlive(party[character]))
+                {
+                    text = Engine::IsDead(party[character]);
+                }
+                else
+                {
+                    auto characters = std::vector<Character::Class>();
+
+                    if (is_party)
                     {
-                        text = Engine::IsDead(party[character]);
+                        for (auto i = 0; i < party.Count(); i++)
+                        {
+                            if (Engine::IsAlive(party[i]))
+                            {
+                                characters.push_back(party[i].Class);
+                            }
+                        }
                     }
                     else
                     {
-                        auto characters = std::vector<Character::Class>();
+                        characters.push_back(party[character].Class);
+                    }
 
-                        if (is_party)
+                    for (auto &character : characters)
+                    {
+                        if (Engine::IsAlive(party[character]) && SafeCast(party[character].Items.size()) > 0)
                         {
-                            for (auto i = 0; i < party.Count(); i++)
+                            for (auto item = 0; item < SafeCast(party[character].Items.size()); item++)
                             {
-                                if (Engine::IsAlive(party[i]))
+                                if (party[character].Items[item].HasAll({Item::Property::ARMOUR, Item::Property::EQUIPPED}) && party[character].Items[item].Has(Attribute::Type::ARMOUR))
                                 {
-                                    characters.push_back(party[i].Class);
+                                    auto armour = party[character].Items[item].Attributes[Attribute::Type::ARMOUR] + gain;
+
+                                    armour = std::max(0, armour);
+
+                                    party[character].Items[item].Attributes[Attribute::Type::ARMOUR] = armour;
                                 }
                             }
                         }
-                        else
-                        {
-                            characters.push_back(party[character].Class);
-                        }
+                    }
+
+                    result = true;
+                }
+
+                internal_error = false;
+            }
+        }
+    }
+
+    // CHAOS EFFECT
+    void ChaosEffect(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
 
-                        for (auto &character : characters)
-                        {
-                            if (Engine::IsAlive(party[character]) && SafeCast(party[character].Items.size()) > 0)
-                            {
-                                for (auto item = 0; item < SafeCast(party[character].Items.size()); item++)
-                                {
-                                    if (party[character].Items[item].HasAll({Item::Property::ARMOUR, Item::Property::EQUIPPED}) && party[character].Items[item].Has(Attribute::Type::ARMOUR))
-                                    {
-                                        auto armour = party[character].Items[item].Attributes[Attribute::Type::ARMOUR] + gain;
+        auto &text = state.Text;
 
-                                        armour = std::max(0, armour);
+        internal_error = true;
 
-                                        party[character].Items[item].Attributes[Attribute::Type::ARMOUR] = armour;
-                                    }
-                                }
-                            }
-                        }
+        // variables
+        // 0 - player
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
+        {
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
 
-                        result = true;
-                    }
+            if (character != Character::Class::NONE)
+            {
+                result = party.Has(character) && Engine::IsAlive(party[character]);
 
-                    internal_error = false;
+                if (result)
+                {
+                    Interface::ChaosEffect(graphics, background, party[character]);
+                }
+                else if (!party.Has(character))
+                {
+                    text = Engine::NotInParty(character);
+                }
+                else if (!Engine::IsAlive(party[character]))
+                {
+                    text = Engine::IsDead(party[character]);
                 }
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::CHAOS_EFFECT)
-        {
-            internal_error = true;
+    }
 
-            // variables
-            // 0 - player
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
-            {
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+    // LOSE ENDURANCE OR DROP ITEM
+    void LoseEnduranceOrDropItem(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
 
-                if (character != Character::Class::NONE)
-                {
-                    result = party.Has(character) && Engine::IsAlive(party[character]);
+        auto &failed = state.Failed;
 
-                    if (result)
-                    {
-                        Interface::ChaosEffect(graphics, background, party[character]);
-                    }
-                    else if (!party.Has(character))
-                    {
-                        text = Engine::NotInParty(character);
-                    }
-                    else if (!Engine::IsAlive(party[character]))
-                    {
-                        text = Engine::IsDead(party[character]);
-                    }
+        auto &internal_error = state.InternalError;
 
-                    internal_error = false;
+        internal_error = true;
+
+        if (Engine::IsAlive(party))
+        {
+            auto characters = std::vector<Character::Class>();
+
+            for (auto character = 0; character < party.Count(); character++)
+            {
+                if (Engine::IsAlive(party[character]))
+                {
+                    characters.push_back(party[character].Class);
                 }
             }
-        }
-        else if (condition.Type == Conditions::Type::LOSE_ENDURANCE_OR_DROP_ITEM)
-        {
-            internal_error = true;
 
-            if (Engine::IsAlive(party))
+            if (SafeCast(characters.size()) > 0)
             {
-                auto characters = std::vector<Character::Class>();
+                result = true;
 
-                for (auto character = 0; character < party.Count(); character++)
+                for (auto &character : characters)
                 {
-                    if (Engine::IsAlive(party[character]))
+                    result &= Interface::Test(graphics, background, party[character], Attribute::Type::PSYCHIC_ABILITY);
+
+                    if (!result)
                     {
-                        characters.push_back(party[character].Class);
+                        Interface::LoseEnduranceOrDropItem(graphics, background, party[character]);
                     }
                 }
 
-                if (SafeCast(characters.size()) > 0)
+                if (!result && Book::IsDefined(condition.Failure))
                 {
-                    result = true;
+                    failed = true;
+                }
 
-                    for (auto &character : characters)
-                    {
-                        result &= Interface::Test(graphics, background, party[character], Attribute::Type::PSYCHIC_ABILITY);
+                internal_error = false;
+            }
+        }
+    }
 
-                        if (!result)
-                        {
-                            Interface::LoseEnduranceOrDropItem(graphics, background, party[character]);
-                        }
-                    }
+    // IS WOUNDED
+    void IsWounded(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
 
-                    if (!result && Book::IsDefined(condition.Failure))
-                    {
-                        failed = true;
-                    }
+        auto &internal_error = state.InternalError;
 
-                    internal_error = false;
-                }
-            }
-        }
-        else if (condition.Type == Conditions::Type::IS_WOUNDED)
-        {
-            internal_error = true;
+        auto &text = state.Text;
 
-            // variables
-            // 0 - player / all
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
-            {
-                auto is_party = (Engine::ToUpper(condition.Variables[0]) == "ALL");
+        internal_error = true;
 
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+        // variables
+        // 0 - player / all
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
+        {
+            auto is_party = (Engine::ToUpper(condition.Variables[0]) == "ALL");
 
-                if ((is_party || character != Character::Class::NONE))
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+
+            if ((is_party || character != Character::Class::NONE))
+            {
+                if (is_party)
                 {
-                    if (is_party)
-                    {
-                        result = !Engine::Healed(party);
+                    result = !Engine::Healed(party);
 
-                        if (!result)
-                        {
-                            text = "NO ONE IS WOUNDED";
-                        }
-                    }
-                    else if (!party.Has(character))
-                    {
-                        text = Engine::NotInParty(character);
-                    }
-                    else if (!Engine::IsAlive(party[character]))
+                    if (!result)
                     {
-                        text = Engine::IsDead(party[character]);
+                        text = "NO ONE IS WOUNDED";
                     }
-                    else
-                    {
-                        result = !Engine::Healed(party[character]);
+                }
+                else if (!party.Has(character))
+                {
+                    text = Engine::NotInParty(character);
+                }
+                else if (!Engine::IsAlive(party[character]))
+                {
+                    text = Engine::IsDead(party[character]);
+                }
+                else
+                {
+                    result = !Engine::Healed(party[character]);
 
-                        if (!result)
-                        {
-                            text = party[character].Name + " IS NOT WOUNDED";
-                        }
+                    if (!result)
+                    {
+                        text = party[character].Name + " IS NOT WOUNDED";
                     }
-
-                    internal_error = false;
                 }
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::MUST_TAKE_ITEM || condition.Type == Conditions::Type::MUST_GET_ITEM)
+    }
+
+    // MUST TAKE ITEM / MUST GET ITEM
+    void MustTakeItem(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables
+        // 0 - item to take
+        // 1 - item (if present, then must take item in #0)
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 1)
         {
-            internal_error = true;
+            auto item = condition.Items[0];
 
-            // variables
-            // 0 - item to take
-            // 1 - item (if present, then must take item in #0)
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 1)
-            {
-                auto item = Item::Map(condition.Variables[0]);
+            auto required = condition.Items[1];
 
-                auto required = Item::Map(condition.Variables[1]);
+            if (item != Item::Type::NONE)
+            {
+                auto take = false;
 
-                if (item != Item::Type::NONE)
+                if (required != Item::Type::NONE)
                 {
-                    auto take = false;
-
-                    if (required != Item::Type::NONE)
+                    if (party.Has(required))
                     {
-                        if (party.Has(required))
-                        {
-                            take = true;
-                        }
-                        else
-                        {
-                            auto message = "TAKE " + Items::Defaults[item].Name + "?";
-
-                            if (Interface::Confirm(graphics, background, message, Color::Background, Color::Active, BloodSword::Border, Color::Active, true))
-                            {
-                                take = true;
-                            }
-                        }
+                        take = true;
                     }
                     else
                     {
@@ -4482,35 +5229,40 @@ namespace BloodSword::Conditions
                             take = true;
                         }
                     }
+                }
+                else
+                {
+                    auto message = "TAKE " + Items::Defaults[item].Name + "?";
+
+                    if (Interface::Confirm(graphics, background, message, Color::Background, Color::Active, BloodSword::Border, Color::Active, true))
+                    {
+                        take = true;
+                    }
+                }
 
-                    if (take)
+                if (take)
+                {
+                    if (Interface::CanReceive(party))
                     {
-                        if (Interface::CanReceive(party))
-                        {
-                            auto character = Engine::FirstClass(party);
+                        auto character = Engine::FirstClass(party);
 
-                            if (Engine::Count(party) > 1)
-                            {
-                                auto message = "WHO GETS THE " + Items::Defaults[item].Name + "?";
+                        if (Engine::Count(party) > 1)
+                        {
+                            auto message = "WHO GETS THE " + Items::Defaults[item].Name + "?";
 
-                                character = Interface::SelectCharacter(graphics, background, party, message.c_str(), true, false, false, false, true);
-                            }
+                            character = Interface::SelectCharacter(graphics, background, party, message.c_str(), true, false, false, false, true);
+                        }
 
-                            if (Interface::CanReceive(party[character]))
-                            {
-                                // preserve choice
-                                party.ChosenCharacter = character;
+                        if (Interface::CanReceive(party[character]))
+                        {
+                            // preserve choice
+                            party.ChosenCharacter = character;
 
-                                party[character].Add(Items::Defaults[item]);
+                            party[character].Add(Items::Defaults[item]);
 
-                                text = party[character].Name + " TAKES THE " + Item::TypeMapping[item] + ".";
+                            text = party[character].Name + " TAKES THE " + Item::TypeMapping[item] + ".";
 
-                                result = true;
-                            }
-                            else
-                            {
-                                text = Interface::Text[Interface::MSG_FULL].Text;
-                            }
+                            result = true;
                         }
                         else
                         {
@@ -4519,104 +5271,299 @@ namespace BloodSword::Conditions
                     }
                     else
                     {
-                        result = true;
+                        text = Interface::Text[Interface::MSG_FULL].Text;
                     }
-
-                    internal_error = false;
                 }
+                else
+                {
+                    result = true;
+                }
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::GAIN_DELAYED_EFFECT)
+    }
+
+    // GAIN DELAYED EFFECT
+    void GainDelayedEffect(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &internal_error = state.InternalError;
+
+        auto &text = state.Text;
+
+        internal_error = true;
+
+        // variables
+        // 0 - player / all
+        // 1 - status
+        // 2 - item type
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 2)
         {
-            internal_error = true;
+            auto is_party = (Engine::ToUpper(condition.Variables[0]) == "ALL");
 
-            // variables
-            // 0 - player / all
-            // 1 - status
-            // 2 - item type
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 2)
-            {
-                auto is_party = (Engine::ToUpper(condition.Variables[0]) == "ALL");
+            auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
 
-                auto character = Interface::SelectCharacter(graphics, background, party, condition.Variables[0]);
+            auto status = Character::MapStatus(condition.Variables[1]);
 
-                auto status = Character::MapStatus(condition.Variables[1]);
+            auto item = condition.Items[2];
 
-                auto item = Item::Map(condition.Variables[2]);
+            if ((is_party || character != Character::Class::NONE) && status != Character::Status::NONE && item != Item::Type::NONE)
+            {
+                auto characters = std::vector<Character::Class>();
 
-                if ((is_party || character != Character::Class::NONE) && status != Character::Status::NONE && item != Item::Type::NONE)
+                if (is_party)
                 {
-                    auto characters = std::vector<Character::Class>();
-
-                    if (is_party)
+                    for (auto i = 0; i < party.Count(); i++)
                     {
-                        for (auto i = 0; i < party.Count(); i++)
+                        if (Engine::IsAlive(party[i]))
                         {
-                            if (Engine::IsAlive(party[i]))
-                            {
-                                characters.push_back(party[i].Class);
-                            }
+                            characters.push_back(party[i].Class);
                         }
                     }
-                    else if (!party.Has(character))
-                    {
-                        text = Engine::NotInParty(character);
-                    }
-                    else if (!Engine::IsAlive(party[character]))
-                    {
-                        text = Engine::IsDead(party[character]);
-                    }
-                    else
-                    {
-                        characters = {character};
-                    }
+                }
+                else if (!party.Has(character))
+                {
+                    text = Engine::NotInParty(character);
+                }
+                else if (!Engine::IsAlive(party[character]))
+                {
+                    text = Engine::IsDead(party[character]);
+                }
+                else
+                {
+                    characters = {character};
+                }
 
-                    if (SafeCast(characters.size()) > 0)
+                if (SafeCast(characters.size()) > 0)
+                {
+                    for (auto &character : characters)
                     {
-                        for (auto &character : characters)
-                        {
-                            party[character].DelayedEffects[status] = item;
-                        }
-
-                        result = true;
+                        party[character].DelayedEffects[status] = item;
                     }
 
-                    internal_error = false;
+                    result = true;
                 }
+
+                internal_error = false;
             }
         }
-        else if (condition.Type == Conditions::Type::CONFIRM)
+    }
+
+    // CONFIRM
+    void Confirm(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        // variables
+        // 0 - message to display
+        if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
         {
-            // variables
-            // 0 - message to display
-            if (Engine::IsAlive(party) && SafeCast(condition.Variables.size()) > 0)
-            {
-                result = Interface::Confirm(graphics, background, condition.Variables[0], Color::Background, Color::Active, BloodSword::Border, Color::Active, true);
-            }
+            result = Interface::Confirm(graphics, background, condition.Variables[0], Color::Background, Color::Active, BloodSword::Border, Color::Active, true);
+        }
+    }
+
+    // PREVIOUS LOCATION
+    void PreviousLocation(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition, Conditions::State &state)
+    {
+        auto &result = state.Result;
+
+        auto &text = state.Text;
+
+        condition.Location = party.PreviousLocation;
+
+        // variables
+        // 0 - text to display (when used in an event)
+        if (SafeCast(condition.Variables.size()) > 0 && !condition.Variables[0].empty())
+        {
+            text = condition.Variables[0];
         }
-        else if (condition.Type == Conditions::Type::PREVIOUS_LOCATION)
+
+        // do not trigger previous events upon return
+        party.Add(Character::Status::SKIP_EVENTS);
+
+        result = true;
+    }
+}
+
+namespace BloodSword::Conditions
+{
+    // build handler table (indexed by condition type)
+    std::vector<Conditions::Handler> Compile(std::vector<std::pair<Conditions::Type, Conditions::Handler>> handlers)
+    {
+        auto table = std::vector<Conditions::Handler>();
+
+        for (auto &handler : handlers)
         {
-            condition.Location = party.PreviousLocation;
+            auto index = SafeCast(handler.first);
 
-            // variables
-            // 0 - text to display (when used in an event)
-            if (SafeCast(condition.Variables.size()) > 0 && !condition.Variables[0].empty())
+            if (index >= SafeCast(table.size()))
             {
-                text = condition.Variables[0];
+                table.resize(index + 1, nullptr);
             }
 
-            // do not trigger previous events upon return
-            party.Add(Character::Status::SKIP_EVENTS);
+            table[index] = handler.second;
+        }
+
+        return table;
+    }
 
-            result = true;
+    // condition handlers dispatch table
+    std::vector<Conditions::Handler> Dispatch = Conditions::Compile({
+            {Conditions::Type::NORMAL, Handlers::Normal},
+            {Conditions::Type::IN_PARTY, Handlers::InParty},
+            {Conditions::Type::ADD_CHARACTER, Handlers::AddCharacter},
+            {Conditions::Type::IS_DEAD, Handlers::IsDead},
+            {Conditions::Type::CHOSEN_PLAYER, Handlers::ChosenPlayer},
+            {Conditions::Type::CHOSEN_NUMBER, Handlers::ChosenNumber},
+            {Conditions::Type::PARTY_HAS_ITEM, Handlers::PartyHasItem},
+            {Conditions::Type::ITEM_IN_ENVIRONMENT, Handlers::ItemInEnvironment},
+            {Conditions::Type::ITEM_IN_SECTION, Handlers::ItemInEnvironment},
+            {Conditions::Type::DROP_ITEM, Handlers::DropItem},
+            {Conditions::Type::HAS_ITEM, Handlers::HasItem},
+            {Conditions::Type::HAS_ALL_ITEMS, Handlers::HasAllItems},
+            {Conditions::Type::COUNT_ITEMS, Handlers::CountItems},
+            {Conditions::Type::REVEAL_ITEM, Handlers::RevealItem},
+            {Conditions::Type::IN_PARTY_WITH_ITEM, Handlers::InPartyWithItem},
+            {Conditions::Type::TEST_ATTRIBUTE, Handlers::TestAttribute},
+            {Conditions::Type::LOSE_ALL, Handlers::LoseAll},
+            {Conditions::Type::BATTLE_VICTORY, Handlers::BattleVictory},
+            {Conditions::Type::BATTLE_FLEE, Handlers::BattleFlee},
+            {Conditions::Type::BATTLE_ENTHRALMENT, Handlers::BattleEnthralment},
+            {Conditions::Type::BATTLE_VICTORY_OR_ENTHRALMENT, Handlers::BattleVictoryOrEnthralment},
+            {Conditions::Type::HAVE_COLLEAGUES, Handlers::HaveColleagues},
+            {Conditions::Type::SOLO, Handlers::Solo},
+            {Conditions::Type::GAIN_STATUS, Handlers::GainStatus},
+            {Conditions::Type::LOSE_STATUS, Handlers::LoseStatus},
+            {Conditions::Type::FIRST, Handlers::First},
+            {Conditions::Type::LAST, Handlers::Last},
+            {Conditions::Type::TEST_GAIN_STATUS, Handlers::TestGainStatus},
+            {Conditions::Type::COUNT_STATUS, Handlers::CountStatus},
+            {Conditions::Type::SELECT_MULTIPLE, Handlers::SelectMultiple},
+            {Conditions::Type::CALL_TO_MIND, Handlers::CallToMind},
+            {Conditions::Type::FORGET_SPELL, Handlers::ForgetSpell},
+            {Conditions::Type::KALUGEN_SELECT, Handlers::KalugenSelect},
+            {Conditions::Type::KALUGEN_LIST, Handlers::KalugenList},
+            {Conditions::Type::KALUGEN_SCORE, Handlers::KalugenScore},
+            {Conditions::Type::KALUGEN_PLAY, Handlers::KalugenPlay},
+            {Conditions::Type::DISCARD_ITEMS, Handlers::DiscardItems},
+            {Conditions::Type::RECEIVE_ITEM, Handlers::ReceiveItem},
+            {Conditions::Type::LOSE_WEAPONS, Handlers::LoseWeapons},
+            {Conditions::Type::LOSE_ARMOUR, Handlers::LoseArmour},
+            {Conditions::Type::SELECT_PLAYER, Handlers::SelectPlayer},
+            {Conditions::Type::CHOOSE_PLAYER, Handlers::SelectPlayer},
+            {Conditions::Type::PLAYER_PAYS, Handlers::PlayerPays},
+            {Conditions::Type::CHARACTER_PAYS, Handlers::PlayerPays},
+            {Conditions::Type::PLAYER_BUYS_ITEM, Handlers::PlayerBuysItem},
+            {Conditions::Type::CHARACTER_BUYS_ITEM, Handlers::PlayerBuysItem},
+            {Conditions::Type::SET_CHOSEN, Handlers::SetChosen},
+            {Conditions::Type::STAKE, Handlers::Stake},
+            {Conditions::Type::COPY, Handlers::Copy},
+            {Conditions::Type::SET, Handlers::Copy},
+            {Conditions::Type::MATH, Handlers::Math},
+            {Conditions::Type::CHOOSE_NUMBER, Handlers::ChooseNumber},
+            {Conditions::Type::ROLL, Handlers::Roll},
+            {Conditions::Type::IF, Handlers::If},
+            {Conditions::Type::IF_MATH, Handlers::IfMath},
+            {Conditions::Type::IF_TRUE_RETURN, Handlers::IfTrueReturn},
+            {Conditions::Type::IF_FALSE_RETURN, Handlers::IfTrueReturn},
+            {Conditions::Type::AND, Handlers::And},
+            {Conditions::Type::OR, Handlers::And},
+            {Conditions::Type::ADD_TO_ITEM, Handlers::AddToItem},
+            {Conditions::Type::SHOW_VARIABLES, Handlers::ShowVariables},
+            {Conditions::Type::TAKE_ITEMS, Handlers::TakeItems},
+            {Conditions::Type::EAT_FOOD, Handlers::EatFood},
+            {Conditions::Type::SHOW_MESSAGE, Handlers::ShowMessage},
+            {Conditions::Type::TEXTBOX, Handlers::ShowMessage},
+            {Conditions::Type::HAS_QUANTITY_OF_ITEM, Handlers::HasQuantityOfItem},
+            {Conditions::Type::PSYCHIC_SPELL, Handlers::PsychicSpell},
+            {Conditions::Type::PSYCHIC_SPELL_GAIN_ATTRIBUTE, Handlers::PsychicSpellGainAttribute},
+            {Conditions::Type::COLLECT, Handlers::Collect},
+            {Conditions::Type::PERMANENT_ATTRIBUTE_GAIN, Handlers::PermanentAttributeGain},
+            {Conditions::Type::HAS_CHARGED_ITEM, Handlers::HasChargedItem},
+            {Conditions::Type::CHARGE, Handlers::Charge},
+            {Conditions::Type::DISCHARGE, Handlers::Charge},
+            {Conditions::Type::KILL_PLAYER, Handlers::KillPlayer},
+            {Conditions::Type::KILL_OTHERS, Handlers::KillOthers},
+            {Conditions::Type::KILL_ALL_WITH_STATUS, Handlers::KillAllWithStatus},
+            {Conditions::Type::REMOVE_PLAYER, Handlers::RemovePlayer},
+            {Conditions::Type::TAKE_ITEM, Handlers::TakeItem},
+            {Conditions::Type::GET_ITEM, Handlers::TakeItem},
+            {Conditions::Type::GAIN_ATTRIBUTE, Handlers::GainAttribute},
+            {Conditions::Type::ALL_WITH_STATUS_GAIN_ATTRIBUTE, Handlers::AllWithStatusGainAttribute},
+            {Conditions::Type::ALL_WITH_STATUS_MODIFY_ATTRIBUTE, Handlers::AllWithStatusModifyAttribute},
+            {Conditions::Type::MODIFY_ATTRIBUTE, Handlers::ModifyAttribute},
+            {Conditions::Type::MAXIMISE_ATTRIBUTE, Handlers::MaximiseAttribute},
+            {Conditions::Type::MAXIMIZE_ATTRIBUTE, Handlers::MaximiseAttribute},
+            {Conditions::Type::ITEM_EFFECT, Handlers::ItemEffect},
+            {Conditions::Type::DAMAGE_PLAYER, Handlers::DamagePlayer},
+            {Conditions::Type::DAMAGE_PARTY, Handlers::DamageParty},
+            {Conditions::Type::DAMAGE_EVERYONE, Handlers::DamageEveryone},
+            {Conditions::Type::LOSE_ENDURANCE, Handlers::LoseEndurance},
+            {Conditions::Type::GAIN_ENDURANCE, Handlers::LoseEndurance},
+            {Conditions::Type::FAIL_THEN_DIE, Handlers::FailThenDie},
+            {Conditions::Type::SELECT_DICE, Handlers::SelectDice},
+            {Conditions::Type::MULTIPLE_DICE, Handlers::MultipleDice},
+            {Conditions::Type::IS_ALIVE, Handlers::IsAlive},
+            {Conditions::Type::GAIN_EXPERIENCE, Handlers::GainExperience},
+            {Conditions::Type::TEST_DISCHARGE_ITEM, Handlers::TestDischargeItem},
+            {Conditions::Type::TASK, Handlers::Task},
+            {Conditions::Type::LOSE_UNEQUIPPED, Handlers::LoseUnequipped},
+            {Conditions::Type::LOSE_EVERYTHING, Handlers::LoseEverything},
+            {Conditions::Type::LOSE_EVERYTHING_EXCEPT_WEAPONS, Handlers::LoseEverythingExceptWeapons},
+            {Conditions::Type::TAKE_FROM_LIST, Handlers::TakeFromList},
+            {Conditions::Type::GAUNTLET, Handlers::Gauntlet},
+            {Conditions::Type::ORDER_FRONT, Handlers::OrderFront},
+            {Conditions::Type::ORDER_FIRST, Handlers::OrderFront},
+            {Conditions::Type::ORDER_BACK, Handlers::OrderBack},
+            {Conditions::Type::ORDER_LAST, Handlers::OrderBack},
+            {Conditions::Type::DAMAGE_ON_FAIL, Handlers::DamageOnFail},
+            {Conditions::Type::DAMAGE_PARTY_ON_FAIL, Handlers::DamagePartyOnFail},
+            {Conditions::Type::COMBAT_TASK, Handlers::CombatTask},
+            {Conditions::Type::COMBAT_MISSION, Handlers::CombatTask},
+            {Conditions::Type::GAIN_ARMOUR, Handlers::GainArmour},
+            {Conditions::Type::CHAOS_EFFECT, Handlers::ChaosEffect},
+            {Conditions::Type::LOSE_ENDURANCE_OR_DROP_ITEM, Handlers::LoseEnduranceOrDropItem},
+            {Conditions::Type::IS_WOUNDED, Handlers::IsWounded},
+            {Conditions::Type::MUST_TAKE_ITEM, Handlers::MustTakeItem},
+            {Conditions::Type::MUST_GET_ITEM, Handlers::MustTakeItem},
+            {Conditions::Type::GAIN_DELAYED_EFFECT, Handlers::GainDelayedEffect},
+            {Conditions::Type::CONFIRM, Handlers::Confirm},
+            {Conditions::Type::PREVIOUS_LOCATION, Handlers::PreviousLocation}});
+
+    // find handler for condition type
+    Conditions::Handler Find(Conditions::Type type)
+    {
+        auto index = SafeCast(type);
+
+        return (index >= 0 && index < SafeCast(Conditions::Dispatch.size())) ? Conditions::Dispatch[index] : nullptr;
+    }
+
+    // routine to validate "condition"
+    Conditions::Evaluation Process(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Conditions::Base &condition)
+    {
+        auto state = Conditions::State();
+
+        auto handler = Conditions::Find(condition.Type);
+
+        if (handler != nullptr)
+        {
+            handler(graphics, background, party, condition, state);
         }
 
+        auto &result = state.Result;
+
+        auto &failed = state.Failed;
+
+        auto &text = state.Text;
+
         // internal error
         if (!Engine::IsAlive(party))
         {
             text = Interface::DeathMessage(party);
         }
-        else if (internal_error)
+        else if (state.InternalError)
         {
             Conditions::InternalError(graphics, background, condition.Type);
         }
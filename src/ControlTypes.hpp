@@ -138,7 +138,7 @@ namespace BloodSword::Controls
         Controls::Type::DETECT_ENCHANTMENT};
 
     // mapping of control types to strings
-    BloodSword::ConstStrings<Controls::Type> TypeMapping = {
+    constexpr auto TypeMapping = BloodSword::Tabulate<Controls::Type>({
         {Controls::Type::NONE, "NONE"},
         {Controls::Type::MOVE, "MOVE"},
         {Controls::Type::FIGHT, "FIGHT"},
@@ -148,7 +148,7 @@ namespace BloodSword::Controls
         {Controls::Type::FLEE, "FLEE"},
         {Controls::Type::SPELLS, "SPELLS"},
         {Controls::Type::ITEMS, "ITEMS"},
-        {Controls::Type::STEEL_SCEPTRE, "STEEL SCEPTRE"}};
+        {Controls::Type::STEEL_SCEPTRE, "STEEL SCEPTRE"}});
 
     // list of player control types
     Controls::List Players = {
@@ -1742,6 +1742,12 @@ namespace BloodSword::Engine
         return mapped;
     }
 
+    // replace instances of tokens in a pre-resolved variable (re-resolve only if it has tokens)
+    Variables::Operand MapTokens(Party::Base &party, Variables::Operand &variable)
+    {
+        return variable.Tokens ? Variables::Operand(Engine::MapTokens(party, variable.Text)) : variable;
+    }
+
     // checks if a character can drop any item from their inventory
     bool CanDrop(Character::Base &character)
     {
@@ -23,7 +23,7 @@ namespace BloodSword::Feature
     };
 
     // feature type to string mapping
-    BloodSword::ConstStrings<Feature::Type> TypeMapping = {
+    constexpr auto TypeMapping = BloodSword::Tabulate<Feature::Type>({
         {Feature::Type::NONE, "NONE"},
         {Feature::Type::ENDING, "ENDING"},
         {Feature::Type::BAD_ENDING, "BAD ENDING"},
@@ -34,7 +34,7 @@ namespace BloodSword::Feature
         {Feature::Type::TASK_TRICKSTER, "TASK TRICKSTER"},
         {Feature::Type::TASK_SAGE, "TASK SAGE"},
         {Feature::Type::TASK_ENCHANTER, "TASK ENCHANTER"},
-        {Feature::Type::ALONE, "ALONE"}};
+        {Feature::Type::ALONE, "ALONE"}});
 
     // map string to feature type
     Feature::Type Map(const char *feature)
@@ -758,13 +758,13 @@ namespace BloodSword::FieldOfView
     };
 
     // field of view method to string mapping
-    BloodSword::ConstStrings<FieldOfView::Method> MethodMapping = {
+    constexpr auto MethodMapping = BloodSword::Tabulate<FieldOfView::Method>({
         {Method::NONE, "NONE"},
         {Method::DIAMOND, "DIAMOND"},
         {Method::SHADOW_CAST, "SHADOW CAST"},
         {Method::RAY_CAST, "RAY CAST"},
         {Method::MILAZZO, "MILAZZO"},
-        {Method::BINARY, "BINARY"}};
+        {Method::BINARY, "BINARY"}});
 
     // map string to field of view method
     FieldOfView::Method Map(const char *method)
@@ -1,6 +1,9 @@
 #ifndef __FONT_CACHE_HPP__
 #define __FONT_CACHE_HPP__
 
+#include <algorithm>
+#include <array>
+#include <cstring>
 #include <fstream>
 #include <string>
 
@@ -8,8 +11,6 @@
 #define SDL_MAIN_HANDLED
 #endif
 
-#include <string>
-
 #include <SDL.h>
 #include <SDL_ttf.h>
 
@@ -17,37 +18,77 @@
 #include "Primitives.hpp"
 #include "Templates.hpp"
 
-// simple implementation of a font (glyph) cache
+// glyph cache: characters and words of one font (size), style and color packed into a single texture
 namespace BloodSword::FontCache
 {
+    // width of the glyph atlas (it grows downwards)
+    const int AtlasWidth = 1024;
+
+    // space between glyphs in the atlas
+    const int Padding = 1;
+
     class Glyph
     {
     public:
-        SDL_Texture *Texture = nullptr;
+        // location in the atlas
+        SDL_Rect Bounds = {0, 0, 0, 0};
+
+        // location in the previous atlas (when glyphs are added later)
+        SDL_Rect Previous = {0, 0, 0, 0};
+
+        // horizontal distance to the next glyph
+        int Advance = 0;
+
+        // character rendered (0 if a word)
+        Uint32 Character = 0;
 
         int Width = -1;
 
         int Height = -1;
 
-        Glyph(Graphics::Base &graphics, TTF_Font *font, const char *text, SDL_Color text_color, int style)
+        // rasterized glyph (released when the atlas is built)
+        SDL_Surface *Surface = nullptr;
+
+        Glyph(TTF_Font *font, const char *text, SDL_Color text_color, int style)
         {
             // set style
             TTF_SetFontStyle(font, style);
 
-            auto surface = TTF_RenderUTF8_Blended(font, text, text_color);
+            this->Surface = TTF_RenderUTF8_Blended(font, text, text_color);
+
+            Metrics::Rasterize();
+
+            if (this->Surface)
+            {
+                this->Width = this->Surface->w;
+
+                this->Height = this->Surface->h;
+
+                this->Advance = this->Width;
+
+                this->Bounds.w = this->Width;
+
+                this->Bounds.h = this->Height;
+            }
 
-            if (surface)
+            if (std::strlen(text) == 1)
             {
-                // create texture
-                this->Texture = SDL_CreateTextureFromSurface(graphics.Renderer, surface);
+                this->Character = Uint32((unsigned char)text[0]);
 
-                if (this->Texture)
+                auto minx = 0;
+
+                auto maxx = 0;
+
+                auto miny = 0;
+
+                auto maxy = 0;
+
+                auto advance = 0;
+
+                if (TTF_GlyphMetrics32(font, this->Character, &minx, &maxx, &miny, &maxy, &advance) == 0 && advance > 0)
                 {
-                    // get texture dimensions
-                    BloodSword::Size(this->Texture, &this->Width, &this->Height);
+                    this->Advance = advance;
                 }
-
-                BloodSword::Free(&surface);
             }
         }
 
@@ -55,10 +96,7 @@ namespace BloodSword::FontCache
 
         void Free()
         {
-            if (this->Texture)
-            {
-                BloodSword::Free(&this->Texture);
-            }
+            BloodSword::Free(&this->Surface);
         }
     };
 
@@ -66,56 +104,256 @@ namespace BloodSword::FontCache
 
     class Base
     {
+    private:
+        // glyphs of single (8-bit) characters, indexed by character
+        std::array<int, 256> Characters;
+
+        // glyphs of words
+        BloodSword::UnorderedMap<std::string, int> Words = {};
+
+        // glyphs added since the atlas was built
+        bool Stale = false;
+
+        // add glyph (no duplicates)
+        void CreateGlyph(TTF_Font *font, std::string &text, SDL_Color text_color, int style)
+        {
+            if (!text.empty() && !this->Has(text))
+            {
+                auto glyph = FontCache::Glyph(font, text.c_str(), text_color, style);
+
+                if (glyph.Surface)
+                {
+                    auto index = SafeCast(this->Glyphs.size());
+
+                    if (SafeCast(text.size()) == 1)
+                    {
+                        this->Characters[(unsigned char)text[0]] = index;
+                    }
+                    else
+                    {
+                        this->Words[text] = index;
+                    }
+
+                    this->Glyphs.push_back(glyph);
+
+                    this->Stale = true;
+                }
+            }
+        }
+
+        // pack all glyphs into a single texture
+        void Build(Graphics::Base &graphics)
+        {
+            if (!this->Stale)
+            {
+                return;
+            }
+
+            this->Stale = false;
+
+            // shelf packing, in the order the glyphs were added
+            auto x = 0;
+
+            auto y = 0;
+
+            auto shelf = 0;
+
+            auto width = 0;
+
+            for (auto &glyph : this->Glyphs)
+            {
+                if (x > 0 && x + glyph.Width > FontCache::AtlasWidth)
+                {
+                    x = 0;
+
+                    y += shelf + FontCache::Padding;
+
+                    shelf = 0;
+                }
+
+                glyph.Bounds.x = x;
+
+                glyph.Bounds.y = y;
+
+                x += glyph.Width + FontCache::Padding;
+
+                width = std::max(width, x);
+
+                shelf = std::max(shelf, glyph.Height);
+            }
+
+            auto height = y + shelf;
+
+            if (width <= 0 || height <= 0)
+            {
+                return;
+            }
+
+            auto atlas = SDL_CreateRGBSurfaceWithFormat(0, width, height, 32, SDL_PIXELFORMAT_RGBA32);
+
+            if (atlas)
+            {
+                SDL_FillRect(atlas, nullptr, 0);
+
+                for (auto &glyph : this->Glyphs)
+                {
+                    auto surface = glyph.Surface;
+
+                    if (!surface)
+                    {
+                        // re-use the previous atlas
+                        surface = this->Sheet;
+                    }
+
+                    if (surface)
+                    {
+                        auto src = glyph.Surface ? SDL_Rect{0, 0, glyph.Width, glyph.Height} : glyph.Previous;
+
+                        auto dst = glyph.Bounds;
+
+                        SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_NONE);
+
+                        SDL_BlitSurface(surface, &src, atlas, &dst);
+                    }
+                }
+
+                for (auto &glyph : this->Glyphs)
+                {
+                    glyph.Free();
+
+                    glyph.Previous = glyph.Bounds;
+                }
+
+                // glyphs added later rebuild the atlas (only the first build is logged)
+                auto initial = (this->Sheet == nullptr);
+
+                BloodSword::Free(&this->Sheet);
+
+                this->Sheet = atlas;
+
+                BloodSword::Free(&this->Atlas);
+
+                this->Atlas = BloodSword::CreateTexture(graphics.Renderer, this->Sheet);
+
+                if (this->Atlas)
+                {
+                    SDL_SetTextureBlendMode(this->Atlas, SDL_BLENDMODE_BLEND);
+                }
+
+                if (initial)
+                {
+                    SDL_Log("[FONT CACHE] %d GLYPHS (%dx%d)", SafeCast(this->Glyphs.size()), width, height);
+                }
+            }
+        }
+
     public:
-        BloodSword::UnorderedMap<std::string, FontCache::Glyph> Glyphs = {};
+        // all glyphs
+        std::vector<FontCache::Glyph> Glyphs = {};
 
-        Base() {}
+        // texture containing all the glyphs
+        SDL_Texture *Atlas = nullptr;
+
+        // copy of the atlas (glyphs are added to it)
+        SDL_Surface *Sheet = nullptr;
+
+        // font used (for kerning)
+        TTF_Font *Font = nullptr;
+
+        Base()
+        {
+            this->Characters.fill(-1);
+        }
 
         bool Has(std::string &text)
         {
-            return BloodSword::Has(this->Glyphs, text);
+            return SafeCast(text.size()) == 1 ? this->Characters[(unsigned char)text[0]] >= 0 : BloodSword::Has(this->Words, text);
         }
 
-        FontCache::Glyph &operator[](std::string chr)
+        // glyph of a single character
+        FontCache::Glyph &operator[](char chr)
         {
-            return this->Has(chr) ? this->Glyphs[chr] : FontCache::Null;
+            auto index = this->Characters[(unsigned char)chr];
+
+            return index >= 0 ? this->Glyphs[index] : FontCache::Null;
         }
 
-        SDL_Texture *Texture(std::string chr)
+        // glyph of a character or a word
+        FontCache::Glyph &operator[](std::string &text)
         {
-            return this->Has(chr) ? this->Glyphs[chr].Texture : nullptr;
+            if (SafeCast(text.size()) == 1)
+            {
+                return (*this)[text[0]];
+            }
+
+            auto search = this->Words.find(text);
+
+            return search != this->Words.end() ? this->Glyphs[search->second] : FontCache::Null;
         }
 
-        void Free()
+        // horizontal adjustment between two characters
+        int Kerning(char previous, char current)
+        {
+            return (this->Font && previous != 0) ? TTF_GetFontKerningSizeGlyphs32(this->Font, Uint32((unsigned char)previous), Uint32((unsigned char)current)) : 0;
+        }
+
+        // width of text (without rendering it)
+        int Width(std::string &text)
         {
-            for (auto &item : this->Glyphs)
+            if (this->Has(text))
             {
-                auto glyph = item.second;
+                return (*this)[text].Width;
+            }
 
-                glyph.Free();
+            auto width = 0;
+
+            auto previous = char(0);
+
+            for (auto chr : text)
+            {
+                width += this->Kerning(previous, chr) + (*this)[chr].Advance;
+
+                previous = chr;
             }
 
-            this->Glyphs.clear();
+            return width;
         }
 
-        void CreateGlyph(BloodSword::Graphics::Base &graphics, TTF_Font *font, std::string &text, SDL_Color text_color, int style)
+        void Free()
         {
-            // ensure that there are no duplicates
-            if (!this->Has(text))
+            for (auto &glyph : this->Glyphs)
             {
-                this->Glyphs[text] = FontCache::Glyph(graphics, font, text.c_str(), text_color, style);
+                glyph.Free();
             }
+
+            this->Glyphs.clear();
+
+            this->Words.clear();
+
+            this->Characters.fill(-1);
+
+            BloodSword::Free(&this->Sheet);
+
+            BloodSword::Free(&this->Atlas);
+
+            this->Font = nullptr;
+
+            this->Stale = false;
         }
 
         // add character to cache
         void Add(Graphics::Base &graphics, TTF_Font *font, const char *text, SDL_Color text_color, int style)
         {
-            for (auto c = 0; c < std::strlen(text); c++)
+            this->Font = font;
+
+            for (auto c = 0; c < SafeCast(std::strlen(text)); c++)
             {
                 auto chr = std::string(1, text[c]);
 
-                this->CreateGlyph(graphics, font, chr, text_color, style);
+                this->CreateGlyph(font, chr, text_color, style);
             }
+
+            this->Build(graphics);
         }
 
         // create texture cache of individual characters
@@ -129,10 +367,14 @@ namespace BloodSword::FontCache
         // add words to cache
         void Add(Graphics::Base &graphics, TTF_Font *font, std::vector<std::string> &collection, SDL_Color text_color, int style)
         {
+            this->Font = font;
+
             for (auto &text : collection)
             {
-                this->CreateGlyph(graphics, font, text, text_color, style);
+                this->CreateGlyph(font, text, text_color, style);
             }
+
+            this->Build(graphics);
         }
 
         // create cache of words
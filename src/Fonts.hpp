@@ -155,15 +155,15 @@ namespace BloodSword::Fonts
         }
         else
         {
-            auto ifs = ZipFile::Read(zip_file, fonts);
+            auto ifs = ZipFile::Open(zip_file, fonts);
 
-            if (!ifs.empty())
+            if (!ifs.IsEmpty())
             {
-                auto data = nlohmann::json::parse(ifs);
+                auto data = nlohmann::json::parse(ifs.View());
 
                 Fonts::Load(data, zip_file);
 
-                ifs.clear();
+                ifs.Clear();
             }
         }
     }
@@ -2,10 +2,13 @@
 #define __GRAPHICS_HPP__
 
 #include <iostream>
+#include <list>
 
 #include "Animation.hpp"
+#include "Asset.hpp"
 #include "Controls.hpp"
 #include "RichText.hpp"
+#include "TextLayout.hpp"
 
 // classes and functions for the graphics rendering engine
 namespace BloodSword::Graphics
@@ -22,6 +25,64 @@ namespace BloodSword::Graphics
     // horizontal scan lines toggle
     bool ScanLinesEnabled = true;
 
+    // wait for vertical sync when presenting frames
+    bool VSync = true;
+
+    // maximum number of frames presented per second (0 if unlimited)
+    int FrameCap = 0;
+
+    // time (in milliseconds) when the last frame was presented
+    Uint64 LastPresent = 0;
+
+    // number of frames presented so far
+    Uint64 Presents = 0;
+
+    // do not present frames that are identical to the one on screen
+    bool SkipIdleFrames = true;
+
+    // fast-forward of NPC turns: NORMAL (off), FAST (shortened), INSTANT (skipped, no intermediate frames)
+    enum class Turbo
+    {
+        NORMAL = 0,
+        FAST,
+        INSTANT
+    };
+
+    // fast-forward of NPC turns
+    Graphics::Turbo TurboMode = Graphics::Turbo::NORMAL;
+
+    // animations and message delays are divided by this in FAST mode
+    const int TurboSpeed = 4;
+
+    // an NPC is taking its turn (fast-forward applies)
+    bool Autoplay = false;
+
+    // check if the actions being shown are fast-forwarded
+    bool FastForward()
+    {
+        return Graphics::Autoplay && Graphics::TurboMode != Graphics::Turbo::NORMAL;
+    }
+
+    // check if the actions being shown are not shown at all
+    bool Instant()
+    {
+        return Graphics::Autoplay && Graphics::TurboMode == Graphics::Turbo::INSTANT;
+    }
+
+    // contents of render targets were lost (e.g. device reset) and must be redrawn
+    bool TargetsReset = false;
+
+    // watch for events that discard the contents of render targets
+    int WatchTargets(void *data, SDL_Event *event)
+    {
+        if (event->type == SDL_RENDER_TARGETS_RESET || event->type == SDL_RENDER_DEVICE_RESET)
+        {
+            Graphics::TargetsReset = true;
+        }
+
+        return 0;
+    }
+
     // base class of the graphics system
     class Base
     {
@@ -38,7 +99,16 @@ namespace BloodSword::Graphics
         // screen dimension (height)
         int Height = 800;
 
+        // offscreen surface drawn on (headless mode only)
+        SDL_Surface *Canvas = nullptr;
+
         Base() {}
+
+        // frames are drawn on an offscreen surface instead of a window
+        bool IsHeadless()
+        {
+            return this->Canvas != nullptr;
+        }
     };
 
     // initialize graphics system
@@ -63,11 +133,15 @@ namespace BloodSword::Graphics
 
             graphics.Height = mode.h;
 
+            SDL_SetHint(SDL_HINT_RENDER_VSYNC, Graphics::VSync ? "1" : "0");
+
             SDL_CreateWindowAndRenderer(graphics.Width, graphics.Height, (SDL_WINDOW_FULLSCREEN_DESKTOP | SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC), &graphics.Window, &graphics.Renderer);
 
             if (graphics.Renderer)
             {
                 SDL_SetRenderDrawBlendMode(graphics.Renderer, SDL_BLENDMODE_BLEND);
+
+                SDL_AddEventWatch(Graphics::WatchTargets, nullptr);
             }
 
             if (!graphics.Window || !graphics.Renderer)
@@ -81,6 +155,51 @@ namespace BloodSword::Graphics
         }
     }
 
+    // initialize graphics system without a window (frames are drawn by the software renderer on an offscreen surface)
+    void CreateHeadless(Uint32 flags, Base &graphics, int width, int height)
+    {
+        graphics.Window = nullptr;
+
+        graphics.Renderer = nullptr;
+
+        graphics.Canvas = nullptr;
+
+        // no display or audio device is needed (unless requested through SDL_VIDEODRIVER / SDL_AUDIODRIVER)
+        SDL_SetHint(SDL_HINT_VIDEODRIVER, "dummy");
+
+        SDL_SetHint(SDL_HINT_AUDIODRIVER, "dummy");
+
+        if (SDL_Init(flags) < 0)
+        {
+            SDL_LogCritical(SDL_LOG_CATEGORY_APPLICATION, "SDL could not initialize! SDL_Error: %s", SDL_GetError());
+        }
+        else
+        {
+            graphics.Width = width;
+
+            graphics.Height = height;
+
+            graphics.Canvas = SDL_CreateRGBSurfaceWithFormat(0, width, height, 32, SDL_PIXELFORMAT_RGBA32);
+
+            if (graphics.Canvas)
+            {
+                graphics.Renderer = SDL_CreateSoftwareRenderer(graphics.Canvas);
+            }
+
+            if (graphics.Renderer)
+            {
+                SDL_SetRenderDrawBlendMode(graphics.Renderer, SDL_BLENDMODE_BLEND);
+
+                SDL_AddEventWatch(Graphics::WatchTargets, nullptr);
+            }
+
+            if (!graphics.Canvas || !graphics.Renderer)
+            {
+                SDL_LogCritical(SDL_LOG_CATEGORY_APPLICATION, "Offscreen renderer could not be created! SDL_Error: %s", SDL_GetError());
+            }
+        }
+    }
+
     // set window/screen icon
     void SetWindowIcon(Base &graphics, const char *icon)
     {
@@ -117,6 +236,24 @@ namespace BloodSword::Graphics
         return graphics;
     }
 
+    // initialize graphics subsystem without a window (e.g. automated rendering and benchmarks)
+    void InitializeHeadless(Base &graphics, int width, int height)
+    {
+        Graphics::CreateHeadless(SDL_INIT_VIDEO, graphics, width, height);
+
+        IMG_Init(IMG_INIT_JPG | IMG_INIT_PNG);
+    }
+
+    // initialize graphics system without a window, drawing on an offscreen surface (width x height)
+    Graphics::Base Headless(int width, int height)
+    {
+        auto graphics = Graphics::Base();
+
+        Graphics::InitializeHeadless(graphics, width, height);
+
+        return graphics;
+    }
+
     // define an rectangle and prepare color
     SDL_Rect CreateRect(Graphics::Base &graphics, int w, int h, int x, int y, int color)
     {
@@ -145,6 +282,8 @@ namespace BloodSword::Graphics
         {
             auto rect = Graphics::CreateRect(graphics, w, h, x, y, color);
 
+            Metrics::Draw(nullptr);
+
             SDL_RenderDrawRect(graphics.Renderer, &rect);
         }
     }
@@ -172,8 +311,13 @@ namespace BloodSword::Graphics
     {
         SDL_Texture *image = nullptr;
 
-        // load image from a file as a surface
-        auto original = !zip_file.empty() ? BloodSword::Surface(filename.c_str(), zip_file.c_str()) : BloodSword::Surface(filename.c_str());
+        // use image decoded ahead of time (see Asset::Preload) or load it from a file as a surface
+        auto original = Asset::Take(filename, zip_file);
+
+        if (!original)
+        {
+            original = !zip_file.empty() ? BloodSword::Surface(filename.c_str(), zip_file.c_str()) : BloodSword::Surface(filename.c_str());
+        }
 
         // render in current palette
         if (original)
@@ -220,7 +364,7 @@ namespace BloodSword::Graphics
 
             SDL_BlitScaled(converted, nullptr, resized, &dst);
 
-            image = SDL_CreateTextureFromSurface(graphics.Renderer, resized);
+            image = BloodSword::CreateTexture(graphics.Renderer, resized);
 
             BloodSword::Free(&converted);
 
@@ -245,6 +389,8 @@ namespace BloodSword::Graphics
         {
             auto rect = Graphics::CreateRect(graphics, w, h, x, y, color);
 
+            Metrics::Draw(nullptr);
+
             SDL_RenderFillRect(graphics.Renderer, &rect);
         }
     }
@@ -268,30 +414,181 @@ namespace BloodSword::Graphics
         {
             SDL_SetRenderDrawColor(graphics.Renderer, Color::R(color), Color::G(color), Color::B(color), Color::A(color));
 
+            Metrics::Draw(nullptr);
+
             SDL_RenderClear(graphics.Renderer);
         }
     }
 
+    // textured quads that share a texture, drawn with a single call
+    class Batch
+    {
+    public:
+        // texture shared by all quads
+        SDL_Texture *Texture = nullptr;
+
+        // dimensions of the texture
+        int W = 0;
+
+        int H = 0;
+
+        std::vector<SDL_Vertex> Vertices = {};
+
+        std::vector<int> Indices = {};
+
+        // add quad (source rectangle in texture pixels, w and h are texture dimensions)
+        void Add(SDL_Rect &src, SDL_Rect &dst, int w, int h, SDL_Color color)
+        {
+            auto index = SafeCast(this->Vertices.size());
+
+            auto x1 = float(dst.x);
+
+            auto y1 = float(dst.y);
+
+            auto x2 = float(dst.x + dst.w);
+
+            auto y2 = float(dst.y + dst.h);
+
+            auto u1 = float(src.x) / w;
+
+            auto v1 = float(src.y) / h;
+
+            auto u2 = float(src.x + src.w) / w;
+
+            auto v2 = float(src.y + src.h) / h;
+
+            this->Vertices.push_back({{x1, y1}, color, {u1, v1}});
+
+            this->Vertices.push_back({{x2, y1}, color, {u2, v1}});
+
+            this->Vertices.push_back({{x2, y2}, color, {u2, v2}});
+
+            this->Vertices.push_back({{x1, y2}, color, {u1, v2}});
+
+            for (auto corner : {0, 1, 2, 0, 2, 3})
+            {
+                this->Indices.push_back(index + corner);
+            }
+        }
+
+        // add solid quad (no texture)
+        void Add(SDL_Rect &dst, SDL_Color color)
+        {
+            auto src = SDL_Rect{0, 0, 0, 0};
+
+            this->Add(src, dst, 1, 1, color);
+        }
+
+        // add solid border of the given thickness around (outside) a rectangle
+        void Frame(SDL_Rect &dst, int size, SDL_Color color)
+        {
+            SDL_Rect top = {dst.x - size, dst.y - size, dst.w + size * 2, size};
+
+            SDL_Rect bottom = {dst.x - size, dst.y + dst.h, dst.w + size * 2, size};
+
+            SDL_Rect left = {dst.x - size, dst.y, size, dst.h};
+
+            SDL_Rect right = {dst.x + dst.w, dst.y, size, dst.h};
+
+            for (auto side : {&top, &bottom, &left, &right})
+            {
+                this->Add(*side, color);
+            }
+        }
+
+        // check if there is nothing to draw
+        bool IsEmpty()
+        {
+            return this->Indices.empty();
+        }
+
+        // discard quads (keeps allocated memory)
+        void Clear()
+        {
+            this->Vertices.clear();
+
+            this->Indices.clear();
+        }
+    };
+
+    // quads waiting to be drawn (re-used every frame)
+    Graphics::Batch Quads = Graphics::Batch();
+
+    // draw all quads in the batch
+    void Flush(Base &graphics, Graphics::Batch &batch)
+    {
+        if (graphics.Renderer && !batch.IsEmpty())
+        {
+            Metrics::Draw(batch.Texture);
+
+            SDL_RenderGeometry(graphics.Renderer, batch.Texture, batch.Vertices.data(), SafeCast(batch.Vertices.size()), batch.Indices.data(), SafeCast(batch.Indices.size()));
+        }
+
+        batch.Clear();
+    }
+
+    // number of rows in the scan line pattern (even, so that the pattern lines up when tiled)
+    const int ScanlineRows = 64;
+
+    // scan line pattern
+    SDL_Texture *ScanlinePattern = nullptr;
+
     // add scan lines to display
     void Scanlines(Base &graphics)
     {
-        if (ScanLinesEnabled)
+        if (ScanLinesEnabled && graphics.Renderer)
         {
-            SDL_Rect scanline;
+            // pattern is created once and tiled over the screen
+            if (!Graphics::ScanlinePattern || BloodSword::Width(Graphics::ScanlinePattern) != graphics.Width)
+            {
+                BloodSword::Free(&Graphics::ScanlinePattern);
 
-            scanline.w = graphics.Width;
+                auto pixels = std::vector<Uint8>(graphics.Width * Graphics::ScanlineRows * 4, 0);
 
-            scanline.h = 1;
+                // every other row is darkened (black, 25% opacity)
+                for (auto y = 1; y < Graphics::ScanlineRows; y += BloodSword::Pixel)
+                {
+                    for (auto x = 0; x < graphics.Width; x++)
+                    {
+                        pixels[(y * graphics.Width + x) * 4 + 3] = 0x40;
+                    }
+                }
 
-            scanline.x = 0;
+                Graphics::ScanlinePattern = BloodSword::CreateTexture(graphics.Renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, graphics.Width, Graphics::ScanlineRows);
 
-            SDL_SetRenderDrawColor(graphics.Renderer, 0, 0, 0, 0x40);
+                if (Graphics::ScanlinePattern)
+                {
+                    SDL_UpdateTexture(Graphics::ScanlinePattern, nullptr, pixels.data(), graphics.Width * 4);
+
+                    SDL_SetTextureBlendMode(Graphics::ScanlinePattern, SDL_BLENDMODE_BLEND);
+                }
+            }
 
-            for (auto i = 0; i < graphics.Height; i += BloodSword::Pixel)
+            if (Graphics::ScanlinePattern)
             {
-                scanline.y = i + 1;
+                auto &batch = Graphics::Quads;
 
-                SDL_RenderFillRect(graphics.Renderer, &scanline);
+                batch.Clear();
+
+                batch.Texture = Graphics::ScanlinePattern;
+
+                batch.W = graphics.Width;
+
+                batch.H = Graphics::ScanlineRows;
+
+                for (auto y = 0; y < graphics.Height; y += Graphics::ScanlineRows)
+                {
+                    auto rows = std::min(Graphics::ScanlineRows, graphics.Height - y);
+
+                    SDL_Rect src = {0, 0, graphics.Width, rows};
+
+                    SDL_Rect dst = {0, y, graphics.Width, rows};
+
+                    batch.Add(src, dst, batch.W, batch.H, SDL_Color{255, 255, 255, 255});
+                }
+
+                // all strips in a single draw call
+                Graphics::Flush(graphics, batch);
             }
         }
     }
@@ -302,23 +599,42 @@ namespace BloodSword::Graphics
         Graphics::ScanLinesEnabled = !Graphics::ScanLinesEnabled;
     }
 
+    // cycle through fast-forward modes (NORMAL, FAST, INSTANT)
+    void ToggleTurbo()
+    {
+        auto modes = {"NORMAL", "FAST", "INSTANT"};
+
+        Graphics::TurboMode = Graphics::Turbo((int(Graphics::TurboMode) + 1) % SafeCast(modes.size()));
+
+        SDL_Log("[TURBO] %s", *(modes.begin() + int(Graphics::TurboMode)));
+    }
+
     // handle window events
     void HandleWindowEvent(SDL_Event &result, Graphics::Base &graphics)
     {
         if (result.window.event == SDL_WINDOWEVENT_RESTORED || result.window.event == SDL_WINDOWEVENT_MAXIMIZED || result.window.event == SDL_WINDOWEVENT_SHOWN)
         {
+            Graphics::TargetsReset = true;
+
             Graphics::Scanlines(graphics);
 
             SDL_RenderPresent(graphics.Renderer);
         }
+        else if (result.window.event == SDL_WINDOWEVENT_EXPOSED || result.window.event == SDL_WINDOWEVENT_SIZE_CHANGED)
+        {
+            // contents of the window must be presented again
+            Graphics::TargetsReset = true;
+        }
     }
 
-    // respond to window resizing/in focus/out of focus events
-    void WaitForWindowEvent(Graphics::Base &graphics)
+    // respond to window resizing/in focus/out of focus events (wait up to the given time, in milliseconds)
+    void WaitForWindowEvent(Graphics::Base &graphics, int wait)
     {
         SDL_Event result;
 
-        SDL_WaitEventTimeout(&result, 1);
+        result.type = 0;
+
+        SDL_WaitEventTimeout(&result, std::max(1, wait));
 
         if (result.type == SDL_WINDOWEVENT)
         {
@@ -329,9 +645,20 @@ namespace BloodSword::Graphics
         }
     }
 
-    // clip rendering outside of specified area
-    void Clip(Graphics::Base &graphics, Point clip, int w, int h)
+    // respond to window resizing/in focus/out of focus events
+    void WaitForWindowEvent(Graphics::Base &graphics)
+    {
+        Graphics::WaitForWindowEvent(graphics, 1);
+    }
+
+    // area being redrawn (empty if the whole screen). clipping never extends outside of it
+    SDL_Rect Limit = {0, 0, 0, 0};
+
+    // clip rendering outside of specified area (false if nothing can be drawn)
+    bool Clip(Graphics::Base &graphics, Point clip, int w, int h)
     {
+        auto visible = true;
+
         if (graphics.Renderer)
         {
             SDL_Rect view;
@@ -344,8 +671,15 @@ namespace BloodSword::Graphics
 
             view.y = clip.Y;
 
+            if (Graphics::Limit.w > 0 && Graphics::Limit.h > 0)
+            {
+                visible = SDL_IntersectRect(&view, &Graphics::Limit, &view) == SDL_TRUE;
+            }
+
             SDL_RenderSetClipRect(graphics.Renderer, &view);
         }
+
+        return visible;
     }
 
     // reset clipping area
@@ -353,7 +687,7 @@ namespace BloodSword::Graphics
     {
         if (graphics.Renderer)
         {
-            SDL_RenderSetClipRect(graphics.Renderer, nullptr);
+            SDL_RenderSetClipRect(graphics.Renderer, (Graphics::Limit.w > 0 && Graphics::Limit.h > 0) ? &Graphics::Limit : nullptr);
         }
     }
 
@@ -386,11 +720,15 @@ namespace BloodSword::Graphics
             {
                 SDL_SetRenderDrawColor(graphics.Renderer, Color::R(background), Color::G(background), Color::B(background), Color::A(background));
 
+                Metrics::Draw(nullptr);
+
                 SDL_RenderFillRect(graphics.Renderer, &dst);
             }
 
             if (texture)
             {
+                Metrics::Draw(texture);
+
                 SDL_RenderCopy(graphics.Renderer, texture, &src, &dst);
             }
         }
@@ -455,89 +793,853 @@ namespace BloodSword::Graphics
         Graphics::Render(graphics, texture, location.X, location.Y);
     }
 
-    // render overlay on screen
-    void Overlay(Base &graphics, Scene::Base &scene)
+    // portion of the texture rendered by the element
+    SDL_Rect Source(Scene::Element &element)
     {
-        if (graphics.Renderer)
-        {
-            if (!scene.Clip.IsNone())
-            {
-                // render only in visible areas
-                Graphics::Clip(graphics, scene.Clip, scene.ClipW, scene.ClipH);
-            }
-            else
-            {
-                // reset clipping
-                Graphics::Clip(graphics);
-            }
+        SDL_Rect src = element.Source;
 
-            for (auto &element : scene.Elements)
-            {
-                Graphics::Render(graphics, element.Texture, element.W, element.H, element.X, element.Y, element.Bounds, element.Offset, element.W, std::min(element.Bounds, element.H), element.Background, element.Border, element.BorderSize);
-            }
+        if (src.w <= 0 || src.h <= 0)
+        {
+            src = {0, element.Offset, element.W, std::min(element.H, element.Bounds)};
         }
+
+        return src;
     }
 
-    // render scene (set backgroud color)
-    void Render(Base &graphics, Scene::Base &scene)
+    // render element (texture portion, background and borders)
+    void Render(Base &graphics, Scene::Element &element)
     {
-        if (graphics.Renderer)
+        if (element.Source.w > 0 && element.Source.h > 0)
         {
-            Graphics::FillWindow(graphics, scene.Background);
+            SDL_Rect dst = {element.X, element.Y, element.W, std::min(element.Bounds, element.H)};
 
-            Graphics::Overlay(graphics, scene);
-        }
-    }
+            if (element.Background != 0)
+            {
+                SDL_SetRenderDrawColor(graphics.Renderer, Color::R(element.Background), Color::G(element.Background), Color::B(element.Background), Color::A(element.Background));
 
-    // render scenes
-    void Render(Base &graphics, Graphics::Scenery scenes)
-    {
-        if (graphics.Renderer && SafeCast(scenes.size()) > 0)
-        {
-            Graphics::FillWindow(graphics, scenes.front().get().Background);
+                Metrics::Draw(nullptr);
 
-            for (auto &scene : scenes)
+                SDL_RenderFillRect(graphics.Renderer, &dst);
+            }
+
+            if (element.Texture)
+            {
+                Metrics::Draw(element.Texture);
+
+                SDL_RenderCopy(graphics.Renderer, element.Texture, &element.Source, &dst);
+            }
+
+            if (element.Border != 0)
             {
-                Graphics::Overlay(graphics, scene.get());
+                Graphics::ThickRect(graphics, dst.w, dst.h, dst.x, dst.y, element.Border, element.BorderSize);
             }
         }
+        else
+        {
+            Graphics::Render(graphics, element.Texture, element.W, element.H, element.X, element.Y, element.Bounds, element.Offset, element.W, std::min(element.Bounds, element.H), element.Background, element.Border, element.BorderSize);
+        }
     }
 
-    // render controls
-    void Render(Graphics::Base &graphics, Controls::Collection &controls, Controls::User input)
+    // render overlay on screen
+    void Overlay(Base &graphics, Scene::Base &scene)
     {
-        for (auto &control : controls)
+        if (graphics.Renderer)
         {
-            if (control.Id == input.Current)
+            if (!scene.Clip.IsNone())
             {
-                if (!input.Blink || !control.OnMap)
+                // render only in visible areas
+                if (!Graphics::Clip(graphics, scene.Clip, scene.ClipW, scene.ClipH))
                 {
-                    Graphics::ThickRect(graphics, control.W - 4 * control.Pixels, control.H - 4 * control.Pixels, control.X + 2 * control.Pixels, control.Y + 2 * control.Pixels, control.Highlight, control.Pixels);
+                    return;
                 }
             }
-        }
-    }
+            else
+            {
+                // reset clipping
+                Graphics::Clip(graphics);
+            }
 
-    // render scene and highlight the control currently in focus (if any)
-    void Overlay(Base &graphics, Scene::Base &scene, Controls::User input)
-    {
-        Graphics::Overlay(graphics, scene);
+            auto &batch = Graphics::Quads;
 
-        Graphics::Render(graphics, scene.Controls, input);
-    }
+            batch.Clear();
 
-    // render scenes and highlight the control currently in focus (if any)
-    void Render(Base &graphics, Graphics::Scenery scenes, Controls::Collection &controls, Controls::User input)
-    {
-        if (graphics.Renderer && SafeCast(scenes.size()) > 0)
-        {
-            Graphics::Render(graphics, scenes);
+            for (auto &element : scene.Elements)
+            {
+                // plain textures packed into an atlas are batched with their neighbours
+                auto region = (element.Background == 0 && element.Border == 0) ? Asset::Find(element.Texture) : nullptr;
 
-            Graphics::Render(graphics, controls, input);
-        }
-    }
+                if (region)
+                {
+                    if (batch.Texture != region->Atlas)
+                    {
+                        Graphics::Flush(graphics, batch);
 
-    // render scenes and highlight the control currently in focus (if any)
+                        batch.Texture = region->Atlas;
+                    }
+
+                    auto src = Graphics::Source(element);
+
+                    src.x += region->Bounds.x;
+
+                    src.y += region->Bounds.y;
+
+                    SDL_Rect dst = {element.X, element.Y, element.W, std::min(element.Bounds, element.H)};
+
+                    // each asset keeps its own color and alpha modulation
+                    SDL_Color color = {255, 255, 255, 255};
+
+                    SDL_GetTextureColorMod(element.Texture, &color.r, &color.g, &color.b);
+
+                    SDL_GetTextureAlphaMod(element.Texture, &color.a);
+
+                    batch.Add(src, dst, region->W, region->H, color);
+                }
+                else if (element.Texture && element.Background == 0 && element.Border == 0 && element.Source.w > 0 && element.Source.h > 0)
+                {
+                    // portions of the same texture (e.g. glyphs, sprite sheets) are drawn together
+                    if (batch.Texture != element.Texture)
+                    {
+                        Graphics::Flush(graphics, batch);
+
+                        batch.Texture = element.Texture;
+
+                        BloodSword::Size(batch.Texture, &batch.W, &batch.H);
+                    }
+
+                    SDL_Rect dst = {element.X, element.Y, element.W, std::min(element.Bounds, element.H)};
+
+                    SDL_Color color = {255, 255, 255, 255};
+
+                    SDL_GetTextureColorMod(element.Texture, &color.r, &color.g, &color.b);
+
+                    SDL_GetTextureAlphaMod(element.Texture, &color.a);
+
+                    batch.Add(element.Source, dst, batch.W, batch.H, color);
+                }
+                else if (!element.Texture && (element.Background != 0 || element.Border != 0))
+                {
+                    // filled rectangles and borders (e.g. fog, panels) are drawn together
+                    if (batch.Texture)
+                    {
+                        Graphics::Flush(graphics, batch);
+
+                        batch.Texture = nullptr;
+                    }
+
+                    SDL_Rect dst = {element.X, element.Y, element.W, std::min(element.Bounds, element.H)};
+
+                    if (element.Background != 0)
+                    {
+                        batch.Add(dst, Color::S(element.Background));
+                    }
+
+                    if (element.Border != 0 && element.BorderSize > 0)
+                    {
+                        batch.Frame(dst, element.BorderSize, Color::S(element.Border));
+                    }
+                }
+                else
+                {
+                    // preserve drawing order
+                    Graphics::Flush(graphics, batch);
+
+                    Graphics::Render(graphics, element);
+                }
+            }
+
+            Graphics::Flush(graphics, batch);
+        }
+    }
+
+    // draw scenes (background color of the first one), with a blur between the last scene and the rest
+    void Draw(Base &graphics, Graphics::Scenery &scenes, bool blur)
+    {
+        auto background = scenes.front().get().Background;
+
+        Graphics::Clip(graphics);
+
+        if (Graphics::Limit.w > 0 && Graphics::Limit.h > 0)
+        {
+            // clearing ignores the clipping area
+            SDL_SetRenderDrawBlendMode(graphics.Renderer, SDL_BLENDMODE_NONE);
+
+            Graphics::FillRect(graphics, Graphics::Limit.w, Graphics::Limit.h, Graphics::Limit.x, Graphics::Limit.y, background);
+
+            SDL_SetRenderDrawBlendMode(graphics.Renderer, SDL_BLENDMODE_BLEND);
+        }
+        else
+        {
+            Graphics::FillWindow(graphics, background);
+        }
+
+        for (auto it = scenes.begin(); it != scenes.end(); it++)
+        {
+            if ((it == (scenes.end() - 1)) && blur && SafeCast(scenes.size()) > 1)
+            {
+                Graphics::Clip(graphics);
+
+                auto rect = Graphics::CreateRect(graphics, graphics.Width, graphics.Height, 0, 0, Color::Blur);
+
+                Metrics::Draw(nullptr);
+
+                SDL_RenderFillRect(graphics.Renderer, &rect);
+            }
+
+            Graphics::Overlay(graphics, (*it).get());
+        }
+    }
+
+    // element as it was drawn
+    class Stamp
+    {
+    public:
+        SDL_Texture *Texture = nullptr;
+
+        // location on screen
+        SDL_Rect Target = {0, 0, 0, 0};
+
+        // portion of the texture
+        SDL_Rect Source = {0, 0, 0, 0};
+
+        Uint32 Background = 0;
+
+        Uint32 Border = 0;
+
+        int BorderSize = 0;
+
+        // color and alpha modulation of the texture
+        Uint32 Modulation = 0;
+
+        // blend mode of the texture
+        SDL_BlendMode Blend = SDL_BLENDMODE_NONE;
+
+        Stamp() {}
+
+        Stamp(Scene::Element &element) : Texture(element.Texture), Background(element.Background), Border(element.Border), BorderSize(element.BorderSize)
+        {
+            this->Target = {element.X, element.Y, element.W, std::min(element.Bounds, element.H)};
+
+            this->Source = Graphics::Source(element);
+
+            if (this->Texture)
+            {
+                Uint8 r = 0;
+
+                Uint8 g = 0;
+
+                Uint8 b = 0;
+
+                Uint8 a = 0;
+
+                SDL_GetTextureColorMod(this->Texture, &r, &g, &b);
+
+                SDL_GetTextureAlphaMod(this->Texture, &a);
+
+                this->Modulation = (Uint32(r) << 24) | (Uint32(g) << 16) | (Uint32(b) << 8) | Uint32(a);
+
+                SDL_GetTextureBlendMode(this->Texture, &this->Blend);
+            }
+        }
+
+        bool operator==(const Stamp &other) const
+        {
+            return this->Texture == other.Texture && this->Background == other.Background && this->Border == other.Border && this->BorderSize == other.BorderSize && this->Modulation == other.Modulation && this->Blend == other.Blend && this->Target.x == other.Target.x && this->Target.y == other.Target.y && this->Target.w == other.Target.w && this->Target.h == other.Target.h && this->Source.x == other.Source.x && this->Source.y == other.Source.y && this->Source.w == other.Source.w && this->Source.h == other.Source.h;
+        }
+
+        bool operator!=(const Stamp &other) const
+        {
+            return !(*this == other);
+        }
+
+        // area covered on screen (including borders)
+        SDL_Rect Area() const
+        {
+            auto border = this->Border != 0 ? this->BorderSize : 0;
+
+            return {this->Target.x - border, this->Target.y - border, this->Target.w + border * 2, this->Target.h + border * 2};
+        }
+    };
+
+    // scene as it was drawn
+    class Imprint
+    {
+    public:
+        Uint32 Background = 0;
+
+        Point Clip = Point(-1, -1);
+
+        int ClipW = 0;
+
+        int ClipH = 0;
+
+        // blurred background drawn under this scene
+        bool Blur = false;
+
+        std::vector<Graphics::Stamp> Stamps = {};
+
+        // check if settings other than the elements are the same
+        bool Matches(const Imprint &other) const
+        {
+            return this->Background == other.Background && this->Clip.X == other.Clip.X && this->Clip.Y == other.Clip.Y && this->ClipW == other.ClipW && this->ClipH == other.ClipH && this->Blur == other.Blur && this->Stamps.size() == other.Stamps.size();
+        }
+    };
+
+    // scenes composed in a render target, redrawn only where they changed
+    class Retained
+    {
+    public:
+        // composed scenes
+        SDL_Texture *Target = nullptr;
+
+        int W = 0;
+
+        int H = 0;
+
+        // contents of the target can be re-used
+        bool Valid = false;
+
+        // number of times the contents of the target changed
+        Uint64 Draws = 0;
+
+        // scenes in the target
+        std::vector<Graphics::Imprint> Layers = {};
+
+        // scenes to be drawn (re-used every frame)
+        std::vector<Graphics::Imprint> Next = {};
+    };
+
+    // keep composed scenes in a render target and redraw only what changed
+    bool RetainScenes = true;
+
+    // composed scenes
+    Graphics::Retained Composition = Graphics::Retained();
+
+    // blurred backgrounds of pop-up dialogs (indexed by the number of scenes under the dialog less one)
+    std::vector<Graphics::Retained> Backdrops = {};
+
+    // release the composition's render targets
+    void FreeComposition()
+    {
+        BloodSword::Free(&Graphics::Composition.Target);
+
+        Graphics::Composition.Valid = false;
+
+        for (auto &backdrop : Graphics::Backdrops)
+        {
+            BloodSword::Free(&backdrop.Target);
+        }
+
+        Graphics::Backdrops.clear();
+
+        BloodSword::RetainedTextures.clear();
+    }
+
+    // check if the texture of a stamp was destroyed or changed since it was drawn
+    bool Changed(const Graphics::Stamp &stamp)
+    {
+        return stamp.Texture && !BloodSword::ChangedTextures.empty() && BloodSword::ChangedTextures.count(stamp.Texture) > 0;
+    }
+
+    // check if a composition draws textures that were destroyed or changed
+    bool Changed(Graphics::Retained &retained)
+    {
+        for (auto &layer : retained.Layers)
+        {
+            for (auto &stamp : layer.Stamps)
+            {
+                if (Graphics::Changed(stamp))
+                {
+                    return true;
+                }
+            }
+        }
+
+        return false;
+    }
+
+    // remember the textures drawn in a composition (only changes to these are tracked)
+    void Reference(Graphics::Retained &retained)
+    {
+        for (auto &layer : retained.Layers)
+        {
+            for (auto &stamp : layer.Stamps)
+            {
+                if (stamp.Texture)
+                {
+                    BloodSword::RetainedTextures.insert(stamp.Texture);
+                }
+            }
+        }
+    }
+
+    // after composing: invalidate backdrops that draw changed textures, then remember the textures drawn (if the composition changed)
+    void Track(bool changed)
+    {
+        if (!BloodSword::ChangedTextures.empty())
+        {
+            for (auto &backdrop : Graphics::Backdrops)
+            {
+                if (backdrop.Valid && Graphics::Changed(backdrop))
+                {
+                    backdrop.Valid = false;
+                }
+            }
+
+            BloodSword::ChangedTextures.clear();
+        }
+
+        if (changed)
+        {
+            BloodSword::RetainedTextures.clear();
+
+            Graphics::Reference(Graphics::Composition);
+
+            for (auto &backdrop : Graphics::Backdrops)
+            {
+                Graphics::Reference(backdrop);
+            }
+        }
+    }
+
+    // record scenes as they will be drawn
+    void Capture(Graphics::Scenery &scenes, bool blur, std::vector<Graphics::Imprint> &layers)
+    {
+        layers.resize(scenes.size());
+
+        for (auto layer = 0; layer < SafeCast(scenes.size()); layer++)
+        {
+            auto &scene = scenes[layer].get();
+
+            auto &imprint = layers[layer];
+
+            imprint.Background = scene.Background;
+
+            imprint.Clip = scene.Clip;
+
+            imprint.ClipW = scene.ClipW;
+
+            imprint.ClipH = scene.ClipH;
+
+            imprint.Blur = (blur && layer == SafeCast(scenes.size()) - 1 && layer > 0);
+
+            imprint.Stamps.clear();
+
+            for (auto &element : scene.Elements)
+            {
+                imprint.Stamps.push_back(Graphics::Stamp(element));
+            }
+        }
+    }
+
+    // find area that changed between two compositions (false if everything must be redrawn)
+    bool Compare(std::vector<Graphics::Imprint> &previous, std::vector<Graphics::Imprint> &next, int w, int h, SDL_Rect &dirty)
+    {
+        dirty = {0, 0, 0, 0};
+
+        if (previous.size() != next.size())
+        {
+            return false;
+        }
+
+        for (auto layer = 0; layer < SafeCast(next.size()); layer++)
+        {
+            if (!previous[layer].Matches(next[layer]))
+            {
+                return false;
+            }
+
+            auto &before = previous[layer].Stamps;
+
+            auto &after = next[layer].Stamps;
+
+            for (auto stamp = 0; stamp < SafeCast(after.size()); stamp++)
+            {
+                if (before[stamp] != after[stamp] || Graphics::Changed(before[stamp]))
+                {
+                    for (auto area : {before[stamp].Area(), after[stamp].Area()})
+                    {
+                        if (dirty.w > 0 && dirty.h > 0)
+                        {
+                            SDL_UnionRect(&dirty, &area, &dirty);
+                        }
+                        else
+                        {
+                            dirty = area;
+                        }
+                    }
+                }
+            }
+        }
+
+        SDL_Rect screen = {0, 0, w, h};
+
+        if (dirty.w > 0 && dirty.h > 0 && !SDL_IntersectRect(&dirty, &screen, &dirty))
+        {
+            dirty = {0, 0, 0, 0};
+        }
+
+        // large changes are cheaper to redraw in full
+        return (dirty.w * dirty.h) <= (w * h) / 2;
+    }
+
+    // check if the first few scenes will be drawn exactly as before
+    bool Same(std::vector<Graphics::Imprint> &previous, std::vector<Graphics::Imprint> &next, int count)
+    {
+        if (SafeCast(previous.size()) != count || SafeCast(next.size()) < count)
+        {
+            return false;
+        }
+
+        for (auto layer = 0; layer < count; layer++)
+        {
+            if (!previous[layer].Matches(next[layer]))
+            {
+                return false;
+            }
+
+            for (auto stamp = 0; stamp < SafeCast(next[layer].Stamps.size()); stamp++)
+            {
+                if (previous[layer].Stamps[stamp] != next[layer].Stamps[stamp] || Graphics::Changed(previous[layer].Stamps[stamp]))
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    // background of a pop-up dialog (all scenes but the last, blurred), drawn only when it changes
+    SDL_Texture *Backdrop(Base &graphics, Graphics::Scenery &scenes, std::vector<Graphics::Imprint> &layers, int w, int h)
+    {
+        auto depth = SafeCast(scenes.size()) - 1;
+
+        if (depth < 1)
+        {
+            return nullptr;
+        }
+
+        // nested dialogs keep the backgrounds of the dialogs under them
+        if (SafeCast(Graphics::Backdrops.size()) < depth)
+        {
+            Graphics::Backdrops.resize(depth);
+        }
+
+        auto &backdrop = Graphics::Backdrops[depth - 1];
+
+        if (!backdrop.Target || backdrop.W != w || backdrop.H != h)
+        {
+            BloodSword::Free(&backdrop.Target);
+
+            backdrop.Valid = false;
+
+            backdrop.Target = BloodSword::CreateTexture(graphics.Renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_TARGET, w, h);
+
+            if (backdrop.Target)
+            {
+                SDL_SetTextureBlendMode(backdrop.Target, SDL_BLENDMODE_NONE);
+            }
+
+            backdrop.W = w;
+
+            backdrop.H = h;
+        }
+
+        if (!backdrop.Target)
+        {
+            return nullptr;
+        }
+
+        if (!backdrop.Valid || !Graphics::Same(backdrop.Layers, layers, depth))
+        {
+            auto below = Graphics::Scenery(scenes.begin(), scenes.end() - 1);
+
+            SDL_SetRenderTarget(graphics.Renderer, backdrop.Target);
+
+            Graphics::Draw(graphics, below, false);
+
+            Graphics::Clip(graphics);
+
+            auto rect = Graphics::CreateRect(graphics, graphics.Width, graphics.Height, 0, 0, Color::Blur);
+
+            Metrics::Draw(nullptr);
+
+            SDL_RenderFillRect(graphics.Renderer, &rect);
+
+            SDL_SetRenderTarget(graphics.Renderer, nullptr);
+
+            backdrop.Layers.assign(layers.begin(), layers.begin() + depth);
+
+            backdrop.Valid = true;
+
+            backdrop.Draws++;
+        }
+
+        return backdrop.Target;
+    }
+
+    // draw scenes into the composition (only the areas that changed), then copy it on screen
+    void Compose(Base &graphics, Graphics::Scenery &scenes, bool blur)
+    {
+        if (!graphics.Renderer || SafeCast(scenes.size()) == 0)
+        {
+            return;
+        }
+
+        if (Metrics::Running == Metrics::Phase::BUILD)
+        {
+            Metrics::Start(Metrics::Phase::RENDER);
+        }
+
+        auto &retained = Graphics::Composition;
+
+        auto w = 0;
+
+        auto h = 0;
+
+        SDL_GetRendererOutputSize(graphics.Renderer, &w, &h);
+
+        if (Graphics::RetainScenes && SDL_RenderTargetSupported(graphics.Renderer) && (!retained.Target || retained.W != w || retained.H != h))
+        {
+            Graphics::FreeComposition();
+
+            retained.Target = BloodSword::CreateTexture(graphics.Renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_TARGET, w, h);
+
+            if (retained.Target)
+            {
+                SDL_SetTextureBlendMode(retained.Target, SDL_BLENDMODE_NONE);
+            }
+
+            retained.W = w;
+
+            retained.H = h;
+        }
+
+        if (!Graphics::RetainScenes || !retained.Target)
+        {
+            // draw directly on screen
+            Graphics::Draw(graphics, scenes, blur);
+
+            return;
+        }
+
+        Graphics::Capture(scenes, blur, retained.Next);
+
+        auto dirty = SDL_Rect{0, 0, 0, 0};
+
+        if (Graphics::TargetsReset)
+        {
+            retained.Valid = false;
+
+            for (auto &backdrop : Graphics::Backdrops)
+            {
+                backdrop.Valid = false;
+            }
+
+            Graphics::TargetsReset = false;
+        }
+
+        auto full = !retained.Valid || !Graphics::Compare(retained.Layers, retained.Next, w, h, dirty);
+
+        auto changed = full || (dirty.w > 0 && dirty.h > 0);
+
+        if (changed)
+        {
+            // pop-up dialogs are drawn over a snapshot of their background
+            auto backdrop = (blur && SafeCast(scenes.size()) > 1) ? Graphics::Backdrop(graphics, scenes, retained.Next, w, h) : nullptr;
+
+            SDL_SetRenderTarget(graphics.Renderer, retained.Target);
+
+            Graphics::Limit = full ? SDL_Rect{0, 0, 0, 0} : dirty;
+
+            if (backdrop)
+            {
+                Graphics::Clip(graphics);
+
+                Metrics::Draw(backdrop);
+
+                SDL_RenderCopy(graphics.Renderer, backdrop, nullptr, nullptr);
+
+                Graphics::Overlay(graphics, scenes.back().get());
+            }
+            else
+            {
+                Graphics::Draw(graphics, scenes, blur);
+            }
+
+            Graphics::Limit = {0, 0, 0, 0};
+
+            SDL_SetRenderTarget(graphics.Renderer, nullptr);
+
+            retained.Draws++;
+        }
+
+        std::swap(retained.Layers, retained.Next);
+
+        retained.Valid = true;
+
+        Graphics::Track(changed);
+
+        Graphics::Clip(graphics);
+
+        Metrics::Draw(retained.Target);
+
+        SDL_RenderCopy(graphics.Renderer, retained.Target, nullptr, nullptr);
+    }
+
+    // scenes rendered together (re-used every frame)
+    Graphics::Scenery Layers = {};
+
+    // render scene (set backgroud color)
+    void Render(Base &graphics, Scene::Base &scene)
+    {
+        Graphics::Layers.clear();
+
+        Graphics::Layers.push_back(scene);
+
+        Graphics::Compose(graphics, Graphics::Layers, false);
+    }
+
+    // render scenes
+    void Render(Base &graphics, Graphics::Scenery scenes)
+    {
+        Graphics::Compose(graphics, scenes, false);
+    }
+
+    // render controls
+    void Render(Graphics::Base &graphics, Controls::Collection &controls, Controls::User input)
+    {
+        for (auto &control : controls)
+        {
+            if (control.Id == input.Current)
+            {
+                if (!input.Blink || !control.OnMap)
+                {
+                    Graphics::ThickRect(graphics, control.W - 4 * control.Pixels, control.H - 4 * control.Pixels, control.X + 2 * control.Pixels, control.Y + 2 * control.Pixels, control.Highlight, control.Pixels);
+                }
+            }
+        }
+    }
+
+    // area highlighted on the control currently in focus (empty if none)
+    SDL_Rect Highlighted(Controls::Collection &controls, Controls::User &input)
+    {
+        auto area = SDL_Rect{0, 0, 0, 0};
+
+        for (auto &control : controls)
+        {
+            if (control.Id == input.Current && (!input.Blink || !control.OnMap))
+            {
+                area = {control.X, control.Y, control.W, control.H};
+            }
+        }
+
+        return area;
+    }
+
+    // what was on screen when the last frame was presented
+    class Shown
+    {
+    public:
+        // frames presented at the time
+        Uint64 Presents = 0;
+
+        // changes to the composition at the time
+        Uint64 Draws = 0;
+
+        // highlighted control
+        SDL_Rect Highlight = {0, 0, 0, 0};
+
+        bool ScanLines = false;
+
+        SDL_Texture *Version = nullptr;
+
+        // statistics shown
+        bool Metrics = false;
+
+        // a frame has been recorded
+        bool Valid = false;
+
+        // check if the screen would look the same
+        bool Matches(const Shown &other) const
+        {
+            return this->Valid && other.Valid && this->Presents == other.Presents && this->Draws == other.Draws && this->ScanLines == other.ScanLines && this->Version == other.Version && this->Metrics == other.Metrics && this->Highlight.x == other.Highlight.x && this->Highlight.y == other.Highlight.y && this->Highlight.w == other.Highlight.w && this->Highlight.h == other.Highlight.h;
+        }
+    };
+
+    // last frame presented by an idle-aware loop
+    Graphics::Shown OnScreen = Graphics::Shown();
+
+    // state of the screen as it is now
+    Graphics::Shown Current(Controls::Collection &controls, Controls::User &input)
+    {
+        auto shown = Graphics::Shown();
+
+        shown.Presents = Graphics::Presents;
+
+        shown.Draws = Graphics::Composition.Draws;
+
+        shown.Highlight = Graphics::Highlighted(controls, input);
+
+        shown.ScanLines = Graphics::ScanLinesEnabled;
+
+        shown.Version = Graphics::VersionOverlay;
+
+        shown.Metrics = Metrics::Enabled;
+
+        shown.Valid = true;
+
+        return shown;
+    }
+
+    // check if rendering the scenes would present the same frame that is already on screen
+    bool IsIdle(Base &graphics, Graphics::Scenery scenes, Controls::Collection &controls, Controls::User input, bool blur)
+    {
+        auto &retained = Graphics::Composition;
+
+        if (!Graphics::SkipIdleFrames || !Graphics::RetainScenes || !graphics.Renderer || !retained.Target || !retained.Valid || Graphics::TargetsReset || !BloodSword::ChangedTextures.empty() || SafeCast(scenes.size()) == 0)
+        {
+            return false;
+        }
+
+        if (!Graphics::OnScreen.Matches(Graphics::Current(controls, input)))
+        {
+            return false;
+        }
+
+        Graphics::Capture(scenes, blur, retained.Next);
+
+        auto dirty = SDL_Rect{0, 0, 0, 0};
+
+        return Graphics::Compare(retained.Layers, retained.Next, retained.W, retained.H, dirty) && (dirty.w <= 0 || dirty.h <= 0);
+    }
+
+    // record the frame that has just been presented
+    void Settle(Controls::Collection &controls, Controls::User input)
+    {
+        Graphics::OnScreen = Graphics::Current(controls, input);
+    }
+
+    // render scene and highlight the control currently in focus (if any)
+    void Overlay(Base &graphics, Scene::Base &scene, Controls::User input)
+    {
+        Graphics::Overlay(graphics, scene);
+
+        Graphics::Render(graphics, scene.Controls, input);
+    }
+
+    // render scenes and highlight the control currently in focus (if any)
+    void Render(Base &graphics, Graphics::Scenery scenes, Controls::Collection &controls, Controls::User input)
+    {
+        if (graphics.Renderer && SafeCast(scenes.size()) > 0)
+        {
+            Graphics::Render(graphics, scenes);
+
+            Graphics::Render(graphics, controls, input);
+        }
+    }
+
+    // render scenes and highlight the control currently in focus (if any)
     void Render(Base &graphics, Graphics::Scenery scenes, Controls::User input)
     {
         Graphics::Render(graphics, scenes, scenes.back().get().Controls, input);
@@ -552,6 +1654,45 @@ namespace BloodSword::Graphics
         }
     }
 
+    // frame time and draw call statistics (see Metrics)
+    SDL_Texture *MetricsOverlay = nullptr;
+
+    // render frame time and draw call statistics on screen
+    void DisplayMetrics(Base &graphics)
+    {
+        if (Metrics::Updated)
+        {
+            Metrics::Updated = false;
+
+            BloodSword::Free(&Graphics::MetricsOverlay);
+
+            if (Metrics::Enabled && Fonts::Fixed && !Metrics::Report.empty())
+            {
+                auto surface = TTF_RenderUTF8_Blended_Wrapped(Fonts::Fixed, Metrics::Report.c_str(), Color::S(Color::Active), 0);
+
+                if (surface)
+                {
+                    Graphics::MetricsOverlay = BloodSword::CreateTexture(graphics.Renderer, surface);
+
+                    BloodSword::Free(&surface);
+                }
+            }
+        }
+
+        if (Metrics::Enabled && Graphics::MetricsOverlay)
+        {
+            auto w = 0;
+
+            auto h = 0;
+
+            BloodSword::Size(Graphics::MetricsOverlay, &w, &h);
+
+            SDL_RenderSetClipRect(graphics.Renderer, nullptr);
+
+            Graphics::Render(graphics, Graphics::MetricsOverlay, w, h, BloodSword::Pad, BloodSword::Pad, h, 0, w, h, Color::O(Color::Background, 0xC0));
+        }
+    }
+
     // render scene and highlight the control currently in focus (if any)
     void Render(Base &graphics, Scene::Base &scene, Controls::User input)
     {
@@ -566,22 +1707,7 @@ namespace BloodSword::Graphics
     // render scenes and highlight the control currently in focus (if any)
     void Dialog(Base &graphics, Graphics::Scenery scenes, bool blur = true)
     {
-        if (graphics.Renderer && SafeCast(scenes.size()) > 0)
-        {
-            Graphics::FillWindow(graphics, scenes.front().get().Background);
-
-            for (auto it = scenes.begin(); it != scenes.end(); it++)
-            {
-                if ((it == (scenes.end() - 1)) && blur)
-                {
-                    auto rect = Graphics::CreateRect(graphics, graphics.Width, graphics.Height, 0, 0, Color::Blur);
-
-                    SDL_RenderFillRect(graphics.Renderer, &rect);
-                }
-
-                Graphics::Overlay(graphics, (*it).get());
-            }
-        }
+        Graphics::Compose(graphics, scenes, blur);
     }
 
     // render scene and highlight the control currently in focus (if any)
@@ -601,6 +1727,35 @@ namespace BloodSword::Graphics
         Graphics::Dialog(graphics, {background, dialog}, input, blur);
     }
 
+    // set vertical sync and the frame rate limit
+    void Pacing(Base &graphics, bool vsync, int cap)
+    {
+        Graphics::VSync = vsync;
+
+        Graphics::FrameCap = std::max(0, cap);
+
+        if (graphics.Renderer)
+        {
+            SDL_RenderSetVSync(graphics.Renderer, vsync ? 1 : 0);
+        }
+    }
+
+    // wait until the next frame can be presented (frame rate limit)
+    void Pace()
+    {
+        if (Graphics::FrameCap > 0)
+        {
+            auto interval = Uint64(BloodSword::OneSecond / Graphics::FrameCap);
+
+            auto elapsed = SDL_GetTicks64() - Graphics::LastPresent;
+
+            if (elapsed < interval)
+            {
+                SDL_Delay(Uint32(interval - elapsed));
+            }
+        }
+    }
+
     // render scene now without waiting for user input
     void RenderNow(Base &graphics)
     {
@@ -610,7 +1765,22 @@ namespace BloodSword::Graphics
 
             Graphics::Scanlines(graphics);
 
+            Graphics::DisplayMetrics(graphics);
+
+            Metrics::Start(Metrics::Phase::PRESENT);
+
+            Graphics::Pace();
+
             SDL_RenderPresent(graphics.Renderer);
+
+            Graphics::LastPresent = SDL_GetTicks64();
+
+            Graphics::Presents++;
+
+            Metrics::Presented();
+
+            // fill in textures whose images were decoded in the background
+            Asset::Upload();
         }
     }
 
@@ -631,34 +1801,96 @@ namespace BloodSword::Graphics
     {
         if (graphics.Renderer)
         {
-            Graphics::Render(graphics, {background, foreground});
+            Graphics::Layers.clear();
+
+            Graphics::Layers.push_back(background);
+
+            Graphics::Layers.push_back(foreground);
+
+            Graphics::Compose(graphics, Graphics::Layers, false);
 
             Graphics::RenderNow(graphics);
         }
     }
 
+    // save the frame to an image file (png): the last frame presented in headless mode, otherwise the frame being drawn
+    bool Snapshot(Base &graphics, const char *image_file)
+    {
+        auto saved = false;
+
+        if (graphics.IsHeadless())
+        {
+            saved = (IMG_SavePNG(graphics.Canvas, image_file) == 0);
+        }
+        else if (graphics.Renderer)
+        {
+            auto w = 0;
+
+            auto h = 0;
+
+            SDL_GetRendererOutputSize(graphics.Renderer, &w, &h);
+
+            auto surface = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, SDL_PIXELFORMAT_RGBA32);
+
+            if (surface)
+            {
+                if (SDL_RenderReadPixels(graphics.Renderer, nullptr, SDL_PIXELFORMAT_RGBA32, surface->pixels, surface->pitch) == 0)
+                {
+                    saved = (IMG_SavePNG(surface, image_file) == 0);
+                }
+
+                BloodSword::Free(&surface);
+            }
+        }
+
+        if (!saved)
+        {
+            SDL_LogCritical(SDL_LOG_CATEGORY_APPLICATION, "Unable to save frame to [%s]: %s", image_file, SDL_GetError());
+        }
+
+        return saved;
+    }
+
+    // animated objects (re-used every frame)
+    Scene::Base Foreground = Scene::Base();
+
     // process through all animations
     bool Animate(Base &graphics, Scene::Base &background, Animations::Base &animations, bool trail = false)
     {
-        auto foreground = Scene::Base();
+        auto &foreground = Graphics::Foreground;
+
+        foreground.Reset();
 
         auto done = Animations::Step(foreground, animations, trail);
 
         Graphics::RenderNow(graphics, background, foreground);
 
-        Graphics::WaitForWindowEvent(graphics);
+        // without vertical sync or a frame rate limit, sleep until the next step instead of interpolating
+        auto paced = (Graphics::VSync || Graphics::FrameCap > 0);
+
+        Graphics::WaitForWindowEvent(graphics, (done || paced) ? 1 : SafeCast(Animations::Remaining(animations)));
 
         return done;
     }
 
-    // process single animation
-    bool Animate(Base &graphics, Scene::Base &background, Animation::Base &movement, Uint64 delay, bool trail = false)
+    // process a collection of animations, stepped and drawn together, until all of them are done
+    bool Play(Base &graphics, Scene::Base &background, Animations::Base &animations, Uint64 delay, bool trail = false)
     {
-        auto animations = Animations::Base(movement);
+        if (Graphics::Instant())
+        {
+            for (auto &animation : animations.List)
+            {
+                animation.Finish();
+            }
+
+            return true;
+        }
 
         animations.SetupClipping();
 
-        animations.Delay = delay;
+        animations.Delay = Graphics::FastForward() ? delay / Graphics::TurboSpeed : delay;
+
+        animations.Stop();
 
         auto done = false;
 
@@ -667,11 +1899,143 @@ namespace BloodSword::Graphics
             done = Graphics::Animate(graphics, background, animations, trail);
         }
 
+        return done;
+    }
+
+    // process single animation
+    bool Animate(Base &graphics, Scene::Base &background, Animation::Base &movement, Uint64 delay, bool trail = false)
+    {
+        auto animations = Animations::Base(movement);
+
+        auto done = Graphics::Play(graphics, background, animations, delay, trail);
+
         movement = *(animations.List.begin());
 
         return done;
     }
 
+    // text rendered earlier (most recently used first), kept within a memory budget
+    class TextCache
+    {
+    private:
+        // rendered text and its key
+        std::list<std::pair<std::string, SDL_Surface *>> Recent = {};
+
+        // location of each key in the list
+        BloodSword::UnorderedMap<std::string, std::list<std::pair<std::string, SDL_Surface *>>::iterator> Index = {};
+
+        // bytes used by the surfaces
+        size_t Bytes = 0;
+
+        // memory used by a surface
+        size_t Size(SDL_Surface *surface)
+        {
+            return surface ? size_t(surface->pitch) * size_t(surface->h) : 0;
+        }
+
+        // remove least recently used text (the most recent one is always kept)
+        void Evict()
+        {
+            while (this->Bytes > this->Budget && SafeCast(this->Recent.size()) > 1)
+            {
+                auto &oldest = this->Recent.back();
+
+                this->Bytes -= this->Size(oldest.second);
+
+                BloodSword::Free(&oldest.second);
+
+                this->Index.erase(oldest.first);
+
+                this->Recent.pop_back();
+            }
+        }
+
+    public:
+        // maximum bytes used (0 to disable the cache)
+        size_t Budget = 16 * 1024 * 1024;
+
+        // key describing the text and how it was rendered
+        std::string Key(const char *text, TTF_Font *font, SDL_Color color, int style, int wrap, char mode)
+        {
+            auto key = std::string(text);
+
+            auto pointer = reinterpret_cast<uintptr_t>(font);
+
+            key.push_back('\0');
+
+            key.push_back(mode);
+
+            key.append(reinterpret_cast<const char *>(&pointer), sizeof(pointer));
+
+            key.append(reinterpret_cast<const char *>(&color), sizeof(color));
+
+            key.append(reinterpret_cast<const char *>(&style), sizeof(style));
+
+            key.append(reinterpret_cast<const char *>(&wrap), sizeof(wrap));
+
+            return key;
+        }
+
+        // find rendered text (owned by the cache)
+        SDL_Surface *Find(const std::string &key)
+        {
+            auto search = this->Index.find(key);
+
+            if (search == this->Index.end())
+            {
+                return nullptr;
+            }
+
+            // move to front (most recently used)
+            this->Recent.splice(this->Recent.begin(), this->Recent, search->second);
+
+            return search->second->second;
+        }
+
+        // keep rendered text (the cache owns the surface)
+        void Keep(const std::string &key, SDL_Surface *surface)
+        {
+            if (!surface || this->Budget == 0 || this->Index.count(key) > 0 || this->Size(surface) > this->Budget)
+            {
+                BloodSword::Free(&surface);
+
+                return;
+            }
+
+            this->Recent.push_front({key, surface});
+
+            this->Index[key] = this->Recent.begin();
+
+            this->Bytes += this->Size(surface);
+
+            this->Evict();
+        }
+
+        // release all rendered text (e.g. fonts or colors changed)
+        void Clear()
+        {
+            for (auto &text : this->Recent)
+            {
+                BloodSword::Free(&text.second);
+            }
+
+            this->Recent.clear();
+
+            this->Index.clear();
+
+            this->Bytes = 0;
+        }
+
+        // number of texts kept
+        int Count()
+        {
+            return SafeCast(this->Recent.size());
+        }
+    };
+
+    // rendered text cache
+    Graphics::TextCache Texts = Graphics::TextCache();
+
     // estimate texture dimensions of a string
     void Estimate(TTF_Font *font, const char *text, int *width, int *height)
     {
@@ -690,62 +2054,86 @@ namespace BloodSword::Graphics
         }
     }
 
-    // create a SDL_Surface representation of a string
-    SDL_Surface *CreateSurfaceText(const char *text, TTF_Font *font, SDL_Color text_color, int style, int wrap)
+    // render a string (see CreateSurfaceText)
+    SDL_Surface *RenderText(const char *text, TTF_Font *font, SDL_Color text_color, int style, int wrap)
     {
         SDL_Surface *surface = nullptr;
 
         if (font)
         {
-            TTF_SetFontStyle(font, style);
+            TextLayout::Style(font, style);
 
             if (wrap == 0 && strchr(text, '\n') == nullptr)
             {
                 surface = TTF_RenderUTF8_Blended(font, text, text_color);
+
+                Metrics::Rasterize();
             }
             else
             {
-                // TODO: Find better code to working with TTF_RenderUTF8_Blended_Wrapped on wraplength = 0
                 auto estimate = wrap;
 
-                if (wrap == 0 && strchr(text, '\n') != nullptr)
+                if (wrap == 0)
                 {
-                    auto max_length = 0;
+                    // wrap only at line breaks: use the width of the widest line
+                    estimate = TextLayout::Widest(font, style, text) + BloodSword::Pad;
+                }
 
-                    auto current = 0;
+                surface = TTF_RenderUTF8_Blended_Wrapped(font, text, text_color, estimate);
 
-                    for (auto i = 0; i < strlen(text); i++)
-                    {
-                        if (text[i] != '\n')
-                        {
-                            current++;
-                        }
-                        else
-                        {
-                            if (current > max_length)
-                            {
-                                max_length = current;
-                            }
+                Metrics::Rasterize();
+            }
+        }
 
-                            current = 0;
-                        }
-                    }
+        return surface;
+    }
 
-                    if (current > max_length)
-                    {
-                        max_length = current;
-                    }
+    // create a SDL_Surface representation of a string (text rendered earlier is copied from the cache)
+    SDL_Surface *CreateSurfaceText(const char *text, TTF_Font *font, SDL_Color text_color, int style, int wrap)
+    {
+        auto key = Graphics::Texts.Key(text, font, text_color, style, wrap, 'S');
 
-                    if (max_length > 0)
-                    {
-                        auto temp = std::string(max_length, 'M') + ' ';
+        auto cached = Graphics::Texts.Find(key);
 
-                        Graphics::Estimate(font, temp.c_str(), &estimate, nullptr);
-                    }
-                }
+        if (cached)
+        {
+            return SDL_DuplicateSurface(cached);
+        }
 
-                surface = TTF_RenderUTF8_Blended_Wrapped(font, text, text_color, estimate);
-            }
+        auto surface = Graphics::RenderText(text, font, text_color, style, wrap);
+
+        if (surface)
+        {
+            Graphics::Texts.Keep(key, SDL_DuplicateSurface(surface));
+        }
+
+        return surface;
+    }
+
+    // render text wrapped only at line breaks, in the current font style (same as TTF_RenderUTF8_Blended_Wrapped with no wrap length)
+    SDL_Surface *CreateSurfaceLines(const char *text, TTF_Font *font, SDL_Color text_color)
+    {
+        if (!font)
+        {
+            return nullptr;
+        }
+
+        auto key = Graphics::Texts.Key(text, font, text_color, TTF_GetFontStyle(font), 0, 'L');
+
+        auto cached = Graphics::Texts.Find(key);
+
+        if (cached)
+        {
+            return SDL_DuplicateSurface(cached);
+        }
+
+        auto surface = TTF_RenderUTF8_Blended_Wrapped(font, text, text_color, 0);
+
+        Metrics::Rasterize();
+
+        if (surface)
+        {
+            Graphics::Texts.Keep(key, SDL_DuplicateSurface(surface));
         }
 
         return surface;
@@ -762,11 +2150,19 @@ namespace BloodSword::Graphics
     {
         SDL_Texture *texture = nullptr;
 
+        // upload text rendered earlier without copying it
+        auto cached = Graphics::Texts.Find(Graphics::Texts.Key(text, font, text_color, style, wrap, 'S'));
+
+        if (cached)
+        {
+            return BloodSword::CreateTexture(graphics.Renderer, cached);
+        }
+
         auto surface = Graphics::CreateSurfaceText(text, font, text_color, style, wrap);
 
         if (surface)
         {
-            texture = SDL_CreateTextureFromSurface(graphics.Renderer, surface);
+            texture = BloodSword::CreateTexture(graphics.Renderer, surface);
 
             BloodSword::Free(&surface);
         }
@@ -780,6 +2176,116 @@ namespace BloodSword::Graphics
         return Graphics::CreateText(graphics, text, font, text_color, style, 0);
     }
 
+    // text broken into lines, of which only the visible ones are rendered
+    class TextView
+    {
+    public:
+        TextLayout::Lines Lines = TextLayout::Lines();
+
+        TTF_Font *Font = nullptr;
+
+        SDL_Color Color = {0, 0, 0, 0};
+
+        int Style = TTF_STYLE_NORMAL;
+
+        // rendered lines (line, texture), released when they scroll out of view
+        std::vector<std::pair<int, SDL_Texture *>> Ring = {};
+
+        TextView(TTF_Font *font, const std::string &text, SDL_Color color, int style, int width) : Font(font), Color(color), Style(style)
+        {
+            this->Lines = TextLayout::Break(font, style, text, width);
+        }
+
+        TextView() {}
+
+        // height of the entire text
+        int Height()
+        {
+            return this->Lines.Height();
+        }
+
+        // release rendered lines
+        void Free()
+        {
+            for (auto &line : this->Ring)
+            {
+                BloodSword::Free(&line.second);
+            }
+
+            this->Ring.clear();
+        }
+
+        // texture of a line (rendered on first use)
+        SDL_Texture *Line(Graphics::Base &graphics, int line)
+        {
+            for (auto &rendered : this->Ring)
+            {
+                if (rendered.first == line)
+                {
+                    return rendered.second;
+                }
+            }
+
+            auto &text = this->Lines.Text[line];
+
+            auto texture = text.empty() ? nullptr : Graphics::CreateText(graphics, text.c_str(), this->Font, this->Color, this->Style);
+
+            this->Ring.push_back({line, texture});
+
+            return texture;
+        }
+
+        // add lines visible in a h-pixel tall window, scrolled down by offset pixels, to the scene
+        void Add(Graphics::Base &graphics, Scene::Base &scene, int x, int y, int h, int offset)
+        {
+            auto skip = this->Lines.Skip;
+
+            if (skip <= 0 || this->Lines.Count() == 0)
+            {
+                return;
+            }
+
+            auto first = std::max(0, offset / skip);
+
+            auto last = std::min(this->Lines.Count() - 1, (offset + h - 1) / skip);
+
+            // release lines that scrolled out of view
+            for (auto line = this->Ring.begin(); line != this->Ring.end();)
+            {
+                if (line->first < first || line->first > last)
+                {
+                    BloodSword::Free(&line->second);
+
+                    line = this->Ring.erase(line);
+                }
+                else
+                {
+                    line++;
+                }
+            }
+
+            for (auto line = first; line <= last; line++)
+            {
+                auto texture = this->Line(graphics, line);
+
+                if (texture)
+                {
+                    auto line_y = line * skip - offset;
+
+                    // portions of lines outside the window are not drawn
+                    auto top = std::max(0, -line_y);
+
+                    auto bottom = std::min(BloodSword::Height(texture), h - line_y);
+
+                    if (bottom > top)
+                    {
+                        scene.Add(Scene::Element(texture, x, y + line_y + top, bottom - top, top));
+                    }
+                }
+            }
+        }
+    };
+
     // create a texture representation of a rich text
     SDL_Texture *CreateText(Graphics::Base &graphics, Graphics::RichText &text)
     {
@@ -879,11 +2385,24 @@ namespace BloodSword::Graphics
     void FreeTextures()
     {
         BloodSword::Free(&VersionOverlay);
+
+        // text is rendered again in the new colors
+        Graphics::Texts.Clear();
     }
 
     // close graphics system
     void Quit(Base &graphics)
     {
+        SDL_DelEventWatch(Graphics::WatchTargets, nullptr);
+
+        Graphics::FreeComposition();
+
+        Graphics::Texts.Clear();
+
+        BloodSword::Free(&Graphics::ScanlinePattern);
+
+        BloodSword::Free(&Graphics::MetricsOverlay);
+
         if (graphics.Renderer != nullptr)
         {
             SDL_DestroyRenderer(graphics.Renderer);
@@ -898,6 +2417,8 @@ namespace BloodSword::Graphics
             graphics.Window = nullptr;
         }
 
+        BloodSword::Free(&graphics.Canvas);
+
         IMG_Quit();
 
         if (SDL_WasInit(SDL_INIT_GAMECONTROLLER))
@@ -29,19 +29,19 @@ namespace BloodSword::Help
     };
 
     // font face style to string mapping
-    BloodSword::ConstStrings<Help::Face> FaceMapping = {
+    constexpr auto FaceMapping = BloodSword::Tabulate<Help::Face>({
         {Help::Face::NONE, "NONE"},
         {Help::Face::NORMAL, "NORMAL"},
         {Help::Face::BOLD, "BOLD"},
         {Help::Face::ITALIC, "ITALIC"},
-        {Help::Face::BOLD_ITALIC, "BOLD-ITALIC"}};
+        {Help::Face::BOLD_ITALIC, "BOLD-ITALIC"}});
 
     // text alignment to string mapping
-    BloodSword::ConstStrings<Help::Align> AlignMapping = {
+    constexpr auto AlignMapping = BloodSword::Tabulate<Help::Align>({
         {Help::Align::NONE, "NONE"},
         {Help::Align::LEFT, "LEFT"},
         {Help::Align::CENTER, "CENTER"},
-        {Help::Align::RIGHT, "RIGHT"}};
+        {Help::Align::RIGHT, "RIGHT"}});
 
     // map string to font face style
     Help::Face MapFace(const char *face)
@@ -210,7 +210,7 @@ namespace BloodSword::Help
                 }
             }
 
-            texture = SDL_CreateTextureFromSurface(graphics.Renderer, surface);
+            texture = BloodSword::CreateTexture(graphics.Renderer, surface);
 
             BloodSword::Free(&surface);
         }
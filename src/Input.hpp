@@ -91,9 +91,23 @@ namespace BloodSword::Input
     {
         SDL_Event result;
 
+        auto controls = Controls::Collection();
+
+        auto input = Controls::User();
+
         while (true)
         {
-            Graphics::RenderNow(graphics, scene);
+            // present only when the screen changes (e.g. window events, images decoded in the background)
+            if (!Graphics::IsIdle(graphics, {scene}, controls, input, false))
+            {
+                Graphics::RenderNow(graphics, scene);
+
+                Graphics::Settle(controls, input);
+            }
+            else
+            {
+                Asset::Upload();
+            }
 
             SDL_WaitEventTimeout(&result, BloodSword::StandardDelay);
 
@@ -132,22 +146,51 @@ namespace BloodSword::Input
         }
     }
 
-    // render all scenes without blurring
-    void RenderWhileWaiting(Graphics::Base &graphics, Graphics::Scenery scenes)
+    // render all scenes while waiting for input (false if the frame on screen did not change)
+    bool RenderWhileWaiting(Graphics::Base &graphics, Graphics::Scenery scenes, Controls::Collection &controls, Controls::User input, bool blur = true)
     {
-        Graphics::Render(graphics, scenes);
+        if (Graphics::IsIdle(graphics, scenes, controls, input, blur))
+        {
+            // fill in textures whose images were decoded in the background
+            Asset::Upload();
 
-        Graphics::RenderNow(graphics);
-    }
+            return false;
+        }
 
-    // render all scenes while waiting for input
-    void RenderWhileWaiting(Graphics::Base &graphics, Graphics::Scenery scenes, Controls::Collection &controls, Controls::User input, bool blur = true)
-    {
         Graphics::Dialog(graphics, scenes, blur);
 
         Graphics::Render(graphics, controls, input);
 
         Graphics::RenderNow(graphics);
+
+        Graphics::Settle(controls, input);
+
+        return true;
+    }
+
+    // render all scenes without blurring (false if the frame on screen did not change)
+    bool RenderWhileWaiting(Graphics::Base &graphics, Graphics::Scenery scenes)
+    {
+        auto controls = Controls::Collection();
+
+        return Input::RenderWhileWaiting(graphics, scenes, controls, Controls::User(), false);
+    }
+
+    // wait for an event. loops that poll (no delay) wait a little while nothing changes on screen
+    void WaitForEvent(SDL_Event &result, int delay, bool presented)
+    {
+        if (delay > 0 || !presented)
+        {
+            auto start = Metrics::Now();
+
+            SDL_WaitEventTimeout(&result, delay > 0 ? delay : BloodSword::FrameDelay);
+
+            Metrics::Waited(start);
+        }
+        else
+        {
+            SDL_PollEvent(&result);
+        }
     }
 
     // render background and overlay while waiting for input
@@ -178,18 +221,11 @@ namespace BloodSword::Input
     // wait for text input from user
     Controls::User WaitForText(Graphics::Base &graphics, Graphics::Scenery scenes, Controls::Collection &controls, Controls::User input, bool blur = true, int delay = BloodSword::StandardDelay)
     {
-        Input::RenderWhileWaiting(graphics, scenes, controls, input, blur);
+        auto presented = Input::RenderWhileWaiting(graphics, scenes, controls, input, blur);
 
         SDL_Event result;
 
-        if (delay > 0)
-        {
-            SDL_WaitEventTimeout(&result, delay);
-        }
-        else
-        {
-            SDL_PollEvent(&result);
-        }
+        Input::WaitForEvent(result, delay, presented);
 
         input.Selected = false;
 
@@ -262,6 +298,42 @@ namespace BloodSword::Input
         return Input::WaitForText(graphics, {background, scene}, controls, input, blur, delay);
     }
 
+    // during fast-forwarded NPC turns, select the only way out of a dialog (e.g. dice rolls, messages)
+    bool AutoConfirm(Graphics::Base &graphics, Graphics::Scenery scenes, Controls::Collection &controls, Controls::User &input, bool blur)
+    {
+        if (!Graphics::FastForward() || SafeCast(controls.size()) != 1)
+        {
+            return false;
+        }
+
+        auto &control = controls[0];
+
+        if (control.Type != Controls::Type::START && control.Type != Controls::Type::EXIT && control.Type != Controls::Type::CONFIRM)
+        {
+            return false;
+        }
+
+        if (!Graphics::Instant())
+        {
+            // show the dialog briefly
+            Input::RenderWhileWaiting(graphics, scenes, controls, input, blur);
+
+            SDL_Delay(BloodSword::StandardDelay / Graphics::TurboSpeed);
+        }
+
+        input.Current = control.Id;
+
+        input.Type = control.Type;
+
+        input.Selected = true;
+
+        input.Up = false;
+
+        input.Down = false;
+
+        return true;
+    }
+
     // render all scenes and wait for input from specified controls set
     Controls::User WaitForInput(Graphics::Base &graphics, Graphics::Scenery scenes, Controls::Collection &controls, Controls::User input, bool blur = true, int delay = BloodSword::StandardDelay)
     {
@@ -270,20 +342,18 @@ namespace BloodSword::Input
             return Input::WaitForText(graphics, scenes, controls, input, blur, delay);
         }
 
-        Input::RenderWhileWaiting(graphics, scenes, controls, input, blur);
+        if (Input::AutoConfirm(graphics, scenes, controls, input, blur))
+        {
+            return input;
+        }
+
+        auto presented = Input::RenderWhileWaiting(graphics, scenes, controls, input, blur);
 
         SDL_Event result;
 
         auto sensitivity = 32000;
 
-        if (delay > 0)
-        {
-            SDL_WaitEventTimeout(&result, delay);
-        }
-        else
-        {
-            SDL_PollEvent(&result);
-        }
+        Input::WaitForEvent(result, delay, presented);
 
         input.Selected = false;
 
@@ -303,6 +373,14 @@ namespace BloodSword::Input
         {
             Input::InitializeGamePads();
         }
+        else if (result.type == SDL_KEYDOWN && result.key.keysym.sym == SDLK_F5)
+        {
+            Graphics::ToggleTurbo();
+        }
+        else if (result.type == SDL_KEYDOWN && result.key.keysym.sym == SDLK_F3)
+        {
+            Metrics::Toggle();
+        }
         else if (result.type == SDL_KEYDOWN && !controls.empty())
         {
             if (result.key.keysym.sym == SDLK_PAGEUP)
@@ -593,20 +671,13 @@ namespace BloodSword::Input
     // render all scenes and wait for input (Rogue Mode)
     Controls::User RogueInput(Graphics::Base &graphics, Graphics::Scenery scenes, int delay = BloodSword::StandardDelay)
     {
-        Input::RenderWhileWaiting(graphics, scenes);
+        auto presented = Input::RenderWhileWaiting(graphics, scenes);
 
         SDL_Event result;
 
         auto sensitivity = 32000;
 
-        if (delay > 0)
-        {
-            SDL_WaitEventTimeout(&result, delay);
-        }
-        else
-        {
-            SDL_PollEvent(&result);
-        }
+        Input::WaitForEvent(result, delay, presented);
 
         auto input = Controls::User();
 
@@ -672,6 +743,10 @@ namespace BloodSword::Input
             {
                 input.Type = Controls::Type::BATTLE_ORDER;
             }
+            else if (result.key.keysym.sym == SDLK_F3)
+            {
+                Metrics::Toggle();
+            }
         }
         else if (result.type == SDL_CONTROLLERAXISMOTION)
         {
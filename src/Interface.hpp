@@ -5,6 +5,7 @@
 #include <ctime>
 #include <filesystem>
 #include <fstream>
+#include <functional>
 #include <numeric>
 #include <string>
 #include <utility>
@@ -125,7 +126,7 @@ namespace BloodSword::Interface
     Controls::Mapped<Asset::Type> BattleControls = {};
 
     // battle controls asset names
-    BloodSword::ConstStrings<Controls::Type> BattleControlsAssetNames = {
+    constexpr auto BattleControlsAssetNames = BloodSword::Tabulate<Controls::Type>({
         {Controls::Type::MOVE, "MOVE"},
         {Controls::Type::FIGHT, "FIGHT"},
         {Controls::Type::SHOOT, "SHOOT"},
@@ -135,10 +136,10 @@ namespace BloodSword::Interface
         {Controls::Type::DEFEND, "DEFEND"},
         {Controls::Type::FLEE, "FLEE"},
         {Controls::Type::ITEMS, "ITEMS"},
-        {Controls::Type::BACK, "BACK"}};
+        {Controls::Type::BACK, "BACK"}});
 
     // battle controls text
-    BloodSword::ConstStrings<Controls::Type> BattleControlsText = {
+    constexpr auto BattleControlsText = BloodSword::Tabulate<Controls::Type>({
         {Controls::Type::MOVE, "MOVE"},
         {Controls::Type::FIGHT, "FIGHT"},
         {Controls::Type::SHOOT, "SHOOT"},
@@ -148,18 +149,18 @@ namespace BloodSword::Interface
         {Controls::Type::FLEE, "FLEE"},
         {Controls::Type::ITEMS, "ITEMS"},
         {Controls::Type::SHURIKEN, "SHOOT SHURIKEN"},
-        {Controls::Type::BACK, "BACK"}};
+        {Controls::Type::BACK, "BACK"}});
 
     // character class to asset type mapping
     Asset::Lookup<Character::Class> ClassAssets = {};
 
     // character class to asset name mapping
-    BloodSword::ConstStrings<Character::Class> ClassAssetsNames = {
+    constexpr auto ClassAssetsNames = BloodSword::Tabulate<Character::Class>({
         {Character::Class::WARRIOR, "WARRIOR"},
         {Character::Class::TRICKSTER, "TRICKSTER"},
         {Character::Class::SAGE, "SAGE"},
         {Character::Class::ENCHANTER, "ENCHANTER"},
-        {Character::Class::IMRAGARN, "PERSON"}};
+        {Character::Class::IMRAGARN, "PERSON"}});
 
     // skill to character status mapping
     Skills::Mapped<Character::Status> SkillEffects = {
@@ -344,15 +345,15 @@ namespace BloodSword::Interface
         }
         else
         {
-            auto ifs = ZipFile::Read(zip_file, settings);
+            auto ifs = ZipFile::Open(zip_file, settings);
 
-            if (!ifs.empty())
+            if (!ifs.IsEmpty())
             {
-                auto data = nlohmann::json::parse(ifs);
+                auto data = nlohmann::json::parse(ifs.View());
 
                 Interface::Initialize(data);
 
-                ifs.clear();
+                ifs.Clear();
             }
         }
     }
@@ -363,9 +364,9 @@ namespace BloodSword::Interface
         // create skill captions and textures
         for (auto &skill : Skills::TypeMapping)
         {
-            SkillCaptionsActive[skill.first] = Graphics::CreateText(graphics, skill.second.c_str(), Fonts::Caption, Color::S(Color::Active), TTF_STYLE_NORMAL, 0);
+            SkillCaptionsActive[skill.first] = Graphics::CreateText(graphics, skill.second, Fonts::Caption, Color::S(Color::Active), TTF_STYLE_NORMAL, 0);
 
-            SkillCaptionsInactive[skill.first] = Graphics::CreateText(graphics, skill.second.c_str(), Fonts::Caption, Color::S(Color::Inactive), TTF_STYLE_NORMAL, 0);
+            SkillCaptionsInactive[skill.first] = Graphics::CreateText(graphics, skill.second, Fonts::Caption, Color::S(Color::Inactive), TTF_STYLE_NORMAL, 0);
 
             SkillsTexturesInactive[skill.first] = Asset::Copy(graphics.Renderer, Skills::Assets[skill.first], Color::Inactive);
         }
@@ -373,9 +374,9 @@ namespace BloodSword::Interface
         // create spell captions and textures
         for (auto &spell : Spells::TypeMapping)
         {
-            auto active = Graphics::CreateText(graphics, spell.second.c_str(), Fonts::Caption, Color::S(Color::Active), TTF_STYLE_NORMAL, 0);
+            auto active = Graphics::CreateText(graphics, spell.second, Fonts::Caption, Color::S(Color::Active), TTF_STYLE_NORMAL, 0);
 
-            auto inactive = Graphics::CreateText(graphics, spell.second.c_str(), Fonts::Caption, Color::S(Color::Inactive), TTF_STYLE_NORMAL, 0);
+            auto inactive = Graphics::CreateText(graphics, spell.second, Fonts::Caption, Color::S(Color::Inactive), TTF_STYLE_NORMAL, 0);
 
             SpellCaptionsActive[spell.first] = active;
 
@@ -517,6 +518,9 @@ namespace BloodSword::Interface
     // load all textures
     void LoadTextures(Graphics::Base &graphics)
     {
+        // pack tiles and icons into texture atlases unless disabled in settings
+        Asset::UseAtlas = !Interface::Settings["atlas"].is_boolean() || bool(Interface::Settings["atlas"]);
+
         // load all assets, initialize asset type ids
         if (Interface::Zipped)
         {
@@ -561,96 +565,144 @@ namespace BloodSword::Interface
         Interface::InitCursor();
     }
 
-    // switch texture and reload all textures
+    // switch palette and re-create textures that depend on it (assets are not reloaded)
     void ReloadTextures(Graphics::Base &graphics, int palette = 0, bool override = true)
     {
-        // unload all textures
-        Interface::UnloadTextures();
-
         // set palette
         Palette::Switch(palette, override);
 
-        // re-load textures
-        Interface::LoadTextures(graphics);
+        // assets are tinted with the new palette
+        Asset::Tint(Color::Active);
 
-        // initialize system messages
-        Interface::InitializeMessages(graphics);
+        // captions and copies of assets in other colors are re-created from memory
+        Interface::FreeTextures();
+
+        Graphics::FreeTextures();
+
+        Interface::FreeCursor();
+
+        Graphics::InitializeTextures(graphics);
+
+        Interface::InitializeTextures(graphics);
+
+        Interface::InitCursor();
     }
 
-    // load settings from file
-    void LoadSettings(Graphics::Base &graphics, std::string settings_file)
+    // load settings, assets and game data (zip_file is empty if not zipped)
+    void LoadSettings(Graphics::Base &graphics, const char *settings_file, const char *zip_file)
     {
-        // game settings
-        Interface::Initialize(settings_file.c_str());
+        auto timer = BloodSword::Stopwatch();
 
-        // load sound assets
-        Sound::Load(Interface::Settings["sounds"]);
+        auto total = BloodSword::Stopwatch();
 
-        // load fonts
-        Fonts::Load(Interface::Settings["fonts"]);
+        auto zip = std::string(zip_file != nullptr ? zip_file : "");
 
-        // palette definitions
-        Palette::Load(Interface::Settings["palettes"]);
+        // game settings
+        Interface::Initialize(settings_file, zip_file);
 
-        // set default palette
-        Palette::Switch(int(Interface::Settings["palette"]));
+        timer.Log("SETTINGS");
 
-        // load textures
-        Interface::LoadTextures(graphics);
+        // vertical sync (on by default) and frame rate limit (none by default)
+        auto vsync = !Interface::Settings["vsync"].is_boolean() || bool(Interface::Settings["vsync"]);
 
-        // initialize gamepads
-        Input::InitializeGamePads();
+        // fast-forward of NPC turns (true/"fast" or "instant")
+        auto &turbo = Interface::Settings["turbo"];
 
-        // load item defaults
-        Items::LoadDefaults(Interface::Settings["items"]);
+        if (turbo.is_boolean())
+        {
+            Graphics::TurboMode = bool(turbo) ? Graphics::Turbo::FAST : Graphics::Turbo::NORMAL;
+        }
+        else if (turbo.is_string())
+        {
+            auto mode = std::string(turbo);
 
-        // load item descriptions
-        Items::LoadDescriptions(Interface::Settings["item_descriptions"]);
+            Graphics::TurboMode = (mode == "instant") ? Graphics::Turbo::INSTANT : ((mode == "fast") ? Graphics::Turbo::FAST : Graphics::Turbo::NORMAL);
+        }
 
-        // load characters
-        Party::Characters = Party::Load(Interface::Settings["characters"], "characters");
-    }
+        auto frame_cap = Interface::Settings["frame_cap"].is_number_integer() ? int(Interface::Settings["frame_cap"]) : 0;
 
-    // load settings from file
-    void LoadSettings(Graphics::Base &graphics, std::string settings_file, std::string zip_file)
-    {
-        if (zip_file.empty())
+        Graphics::Pacing(graphics, vsync, frame_cap);
+
+        // memory used by rendered text (in megabytes, 0 to disable)
+        if (Interface::Settings["text_cache"].is_number_integer())
         {
-            // load settings from file
-            Interface::LoadSettings(graphics, settings_file);
+            Graphics::Texts.Budget = size_t(std::max(0, int(Interface::Settings["text_cache"]))) * 1024 * 1024;
         }
-        else
-        {
-            // game settings
-            Interface::Initialize(settings_file.c_str(), zip_file.empty() ? nullptr : zip_file.c_str());
 
-            // load sound assets
-            Sound::Load(Interface::Settings["sounds"], zip_file);
+        // load sound assets
+        Sound::Load(Interface::Settings["sounds"], zip);
 
-            // load fonts
-            Fonts::Load(Interface::Settings["fonts"], zip_file);
+        timer.Log("SOUNDS");
 
-            // palette definitions
-            Palette::Load(Interface::Settings["palettes"], zip_file);
+        // load fonts (text rendered or measured with the previous fonts is discarded)
+        Graphics::Texts.Clear();
 
-            // set default palette
-            Palette::Switch(int(Interface::Settings["palette"]));
+        TextLayout::Clear();
 
-            // load textures
-            Interface::LoadTextures(graphics);
+        Fonts::Load(Interface::Settings["fonts"], zip);
 
-            // initialize gamepads
-            Input::InitializeGamePads();
+        timer.Log("FONTS");
 
-            // load item defaults
-            Items::LoadDefaults(Interface::Settings["items"], zip_file);
+        // palette definitions
+        Palette::Load(Interface::Settings["palettes"], zip);
 
-            // load item descriptions
-            Items::LoadDescriptions(Interface::Settings["item_descriptions"], zip_file);
+        // set default palette
+        Palette::Switch(int(Interface::Settings["palette"]));
 
-            // load characters
-            Party::Characters = Party::Load(Interface::Settings["characters"], "characters", zip_file);
-        }
+        timer.Log("PALETTES");
+
+        // load textures (images are decoded on worker threads)
+        Interface::LoadTextures(graphics);
+
+        timer.Log("TEXTURES");
+
+        // item and character data only need the asset types, parse them on worker threads
+        auto items = std::string(Interface::Settings["items"]);
+
+        auto item_descriptions = std::string(Interface::Settings["item_descriptions"]);
+
+        auto characters = std::string(Interface::Settings["characters"]);
+
+        auto party = Party::Base();
+
+        BloodSword::Parallel(3, [&](int task)
+                             {
+                                 if (task == 0)
+                                 {
+                                     // load item defaults
+                                     Items::LoadDefaults(items, zip);
+                                 }
+                                 else if (task == 1)
+                                 {
+                                     // load item descriptions
+                                     Items::LoadDescriptions(item_descriptions, zip);
+                                 }
+                                 else
+                                 {
+                                     // load characters
+                                     party = Party::Load(characters, "characters", zip);
+                                 } });
+
+        Party::Characters = party;
+
+        timer.Log("ITEMS AND CHARACTERS");
+
+        // initialize gamepads
+        Input::InitializeGamePads();
+
+        total.Log("MODULE");
+    }
+
+    // load settings from file
+    void LoadSettings(Graphics::Base &graphics, std::string settings_file)
+    {
+        Interface::LoadSettings(graphics, settings_file.c_str(), nullptr);
+    }
+
+    // load settings from file
+    void LoadSettings(Graphics::Base &graphics, std::string settings_file, std::string zip_file)
+    {
+        Interface::LoadSettings(graphics, settings_file.c_str(), zip_file.empty() ? nullptr : zip_file.c_str());
     }
 
     // unload sound, fonts, texture assets
@@ -758,13 +810,13 @@ namespace BloodSword::Interface
     // render texture for a fixed time
     void FlashTexture(Graphics::Base &graphics, Scene::Base &scene, SDL_Texture *texture, Uint32 background, Uint32 border, int border_size, int delay = BloodSword::StandardDelay)
     {
-        if (texture)
+        if (texture && !Graphics::Instant())
         {
             auto message = Interface::Boxed(graphics, texture, background, border, border_size);
 
             Input::RenderWhileWaiting(graphics, {scene, message});
 
-            SDL_Delay(delay);
+            SDL_Delay(Graphics::FastForward() ? delay / Graphics::TurboSpeed : delay);
         }
     }
 
@@ -1021,68 +1073,83 @@ namespace BloodSword::Interface
         }
     }
 
-    // draws a scrollable image box
-    void ScrollableImageBox(Graphics::Base &graphics, Scene::Base &background, SDL_Texture *texture, int width, int height, int x, int y, Uint32 bg_color, Uint32 border, int border_size, Uint32 highlight, Asset::Type asset, Asset::Type left, Asset::Type right, bool blur = true, int offset = 0)
+    // draws a scrollable box, content_h pixels tall, and scrolls it until closed (content adds anything not in the texture)
+    void ScrollableBox(Graphics::Base &graphics, Scene::Base &background, SDL_Texture *texture, int content_h, int width, int height, int x, int y, Uint32 bg_color, Uint32 border, int border_size, Asset::Type asset, Asset::Type left, Asset::Type right, bool blur, int offset, std::function<void(Scene::Base &, int, int, int, int)> content)
     {
-        if (texture)
-        {
-            auto text_h = height - (BloodSword::TileSize + BloodSword::TriplePad);
+        auto text_h = height - (BloodSword::TileSize + BloodSword::TriplePad);
 
-            auto texture_h = BloodSword::Height(texture);
+        auto text_x = x + BloodSword::Pad;
 
-            auto text_x = x + BloodSword::Pad;
+        auto text_y = y + BloodSword::Pad;
 
-            auto text_y = y + BloodSword::Pad;
+        auto input = Controls::User();
 
-            auto input = Controls::User();
+        auto controls_x = x + (width - (BloodSword::TripleTile + BloodSword::LargePad)) / 2;
 
-            auto controls_x = x + (width - (BloodSword::TripleTile + BloodSword::LargePad)) / 2;
+        auto controls_y = y + text_h + BloodSword::LargePad;
 
-            auto controls_y = y + text_h + BloodSword::LargePad;
+        auto scroll_speed = BloodSword::ScrollSpeed;
 
-            auto scroll_speed = BloodSword::ScrollSpeed;
+        auto done = false;
 
-            auto done = false;
+        while (!done)
+        {
+            auto scene = Scene::Base();
 
-            while (!done)
-            {
-                auto scene = Scene::Base();
+            Interface::AddScrollableTextureBox(scene, x, y, width, height, bg_color, border, border_size, texture, content_h, text_x, text_y, text_h, offset, controls_x, controls_y, asset, left, right, scroll_speed);
 
-                Interface::AddScrollableTextureBox(scene, x, y, width, height, bg_color, border, border_size, texture, texture_h, text_x, text_y, text_h, offset, controls_x, controls_y, asset, left, right, scroll_speed);
+            if (content)
+            {
+                content(scene, text_x, text_y, text_h, offset);
+            }
 
-                input = Input::WaitForInput(graphics, {background, scene}, scene.Controls, input, blur);
+            input = Input::WaitForInput(graphics, {background, scene}, scene.Controls, input, blur);
 
-                if (Input::Validate(input))
+            if (Input::Validate(input))
+            {
+                if (input.Type == Controls::Type::LEFT || input.Up)
                 {
-                    if (input.Type == Controls::Type::LEFT || input.Up)
-                    {
-                        Interface::TextUp(scene, input, Controls::Type::LEFT, input.Up, offset, texture_h, text_h, scroll_speed);
-                    }
-                    else if (input.Type == Controls::Type::RIGHT || input.Down)
-                    {
-                        Interface::TextDown(scene, input, Controls::Type::RIGHT, input.Down, offset, texture_h, text_h, scroll_speed);
-                    }
-                    else if (input.Type == Controls::Type::CONFIRM)
-                    {
-                        done = true;
-                    }
-
-                    input.Selected = false;
+                    Interface::TextUp(scene, input, Controls::Type::LEFT, input.Up, offset, content_h, text_h, scroll_speed);
+                }
+                else if (input.Type == Controls::Type::RIGHT || input.Down)
+                {
+                    Interface::TextDown(scene, input, Controls::Type::RIGHT, input.Down, offset, content_h, text_h, scroll_speed);
                 }
+                else if (input.Type == Controls::Type::CONFIRM)
+                {
+                    done = true;
+                }
+
+                input.Selected = false;
             }
         }
     }
 
+    // draws a scrollable image box
+    void ScrollableImageBox(Graphics::Base &graphics, Scene::Base &background, SDL_Texture *texture, int width, int height, int x, int y, Uint32 bg_color, Uint32 border, int border_size, Uint32 highlight, Asset::Type asset, Asset::Type left, Asset::Type right, bool blur = true, int offset = 0)
+    {
+        if (texture)
+        {
+            Interface::ScrollableBox(graphics, background, texture, BloodSword::Height(texture), width, height, x, y, bg_color, border, border_size, asset, left, right, blur, offset, nullptr);
+        }
+    }
+
     // draws a scrollable text box (multi-line)
     void ScrollableTextBox(Graphics::Base &graphics, Scene::Base &background, TTF_Font *font, std::string text, int width, int height, int x, int y, SDL_Color color, int style, Uint32 bg_color, Uint32 border, int border_size, Uint32 highlight, Asset::Type asset, bool blur = true)
     {
-        auto texture = Graphics::CreateText(graphics, text.c_str(), font, color, style, width - BloodSword::LargePad);
+        // only the visible lines are rendered
+        auto view = Graphics::TextView(font, text, color, style, width - BloodSword::LargePad);
 
-        if (texture)
+        if (view.Lines.Count() > 0)
         {
-            Interface::ScrollableImageBox(graphics, background, texture, width, height, x, y, bg_color, border, border_size, highlight, asset, Asset::Map("LEFT"), Asset::Map("RIGHT"), blur);
+            auto add = [&](Scene::Base &scene, int text_x, int text_y, int text_h, int offset)
+            {
+                view.Add(graphics, scene, text_x, text_y, text_h, offset);
+            };
 
-            BloodSword::Free(&texture);
+            Interface::ScrollableBox(graphics, background, nullptr, view.Height(), width, height, x, y, bg_color, border, border_size, asset, Asset::Map("LEFT"), Asset::Map("RIGHT"), blur, 0, add);
+
+            view.Free();
         }
     }
 
@@ -1145,10 +1212,10 @@ namespace BloodSword::Interface
         Interface::TextBox(graphics, scene, message, Color::Active, wrap, blur);
     }
 
-    // add map to the scene
-    Scene::Base Map(Map::Base &map, Party::Base &party, Party::Base &enemies, int num_bottom_buttons)
+    // fill scene with the map (re-uses the scene's memory)
+    void Map(Scene::Base &scene, Map::Base &map, Party::Base &party, Party::Base &enemies, int num_bottom_buttons)
     {
-        auto scene = Scene::Base();
+        scene.Reset();
 
         auto num_controls = 0;
 
@@ -1306,6 +1373,14 @@ namespace BloodSword::Interface
                 num_controls++;
             }
         }
+    }
+
+    // add map to the scene
+    Scene::Base Map(Map::Base &map, Party::Base &party, Party::Base &enemies, int num_bottom_buttons)
+    {
+        auto scene = Scene::Base();
+
+        Interface::Map(scene, map, party, enemies, num_bottom_buttons);
 
         return scene;
     }
@@ -1542,7 +1617,7 @@ namespace BloodSword::Interface
                     }
                 }
 
-                texture = SDL_CreateTextureFromSurface(graphics.Renderer, surface);
+                texture = BloodSword::CreateTexture(graphics.Renderer, surface);
 
                 BloodSword::Free(&surface);
             }
@@ -1862,7 +1937,7 @@ namespace BloodSword::Interface
     // generate texture of the character's stats
     SDL_Surface *GenerateCharacterStats(Graphics::Base &graphics, Character::Base &character, int w)
     {
-        auto surface_labels = TTF_RenderUTF8_Blended_Wrapped(Fonts::Normal, StatsLabels().c_str(), Color::S(Color::Active), 0);
+        auto surface_labels = Graphics::CreateSurfaceLines(StatsLabels().c_str(), Fonts::Normal, Color::S(Color::Active));
 
         // surface
         SDL_Surface *surface = nullptr;
@@ -1906,7 +1981,7 @@ namespace BloodSword::Interface
                 auto stats = stats_1 + stats_2 + stats_3;
 
                 // create and convert SDL surface to appropriate format
-                auto surface_stats = TTF_RenderUTF8_Blended_Wrapped(Fonts::Normal, stats.c_str(), Color::S(Color::Highlight), 0);
+                auto surface_stats = Graphics::CreateSurfaceLines(stats.c_str(), Fonts::Normal, Color::S(Color::Highlight));
 
                 SDL_Rect stats_rect;
 
@@ -1950,7 +2025,7 @@ namespace BloodSword::Interface
         // final texture
         SDL_Texture *texture = nullptr;
 
-        auto surface_labels = TTF_RenderUTF8_Blended_Wrapped(Fonts::Normal, StatsLabels().c_str(), Color::S(Color::Active), 0);
+        auto surface_labels = Graphics::CreateSurfaceLines(StatsLabels().c_str(), Fonts::Normal, Color::S(Color::Active));
 
         if (surface_labels)
         {
@@ -1985,7 +2060,7 @@ namespace BloodSword::Interface
                 }
 
                 // create final texture
-                texture = SDL_CreateTextureFromSurface(graphics.Renderer, surface);
+                texture = BloodSword::CreateTexture(graphics.Renderer, surface);
 
                 // cleanup
                 BloodSword::Free(&surface);
@@ -2007,7 +2082,7 @@ namespace BloodSword::Interface
 
         if (surface)
         {
-            texture = SDL_CreateTextureFromSurface(graphics.Renderer, surface);
+            texture = BloodSword::CreateTexture(graphics.Renderer, surface);
 
             BloodSword::Free(&surface);
         }
@@ -3836,9 +3911,9 @@ namespace BloodSword::Interface
     {
         auto description = Story::CurrentBook.Find(location);
 
-        if (description >= 0 && description < SafeCast(Story::CurrentBook.Sections.size()) && !Story::CurrentBook.Sections[description].Text.empty())
+        if (description >= 0 && description < SafeCast(Story::CurrentBook.Sections.size()) && !Story::CurrentBook[description].Text.empty())
         {
-            auto text_description = Story::CurrentBook.Sections[description].Text;
+            auto text_description = Story::CurrentBook[description].Text;
 
             Interface::TextBox(graphics, background, text_description, Color::Active, BloodSword::DescriptionSize);
         }
@@ -7058,6 +7133,9 @@ namespace BloodSword::Interface
         }
         else
         {
+            // keep only this module's archive open
+            ZipFile::Retain(Interface::ZipFile);
+
             SDL_Log("[LOADED] [MODULE %s]", load.c_str());
         }
     }
@@ -8072,11 +8150,11 @@ namespace BloodSword::Interface
 
                         if (current >= 0 && current < SafeCast(Story::CurrentBook.Sections.size()))
                         {
-                            if (Story::CurrentBook.Sections[current].Has(Feature::Type::BAD_ENDING))
+                            if (Story::CurrentBook[current].Has(Feature::Type::BAD_ENDING))
                             {
                                 Interface::ErrorMessage(graphics, background, Interface::MSG_OVER);
                             }
-                            else if (!Story::CurrentBook.Sections[current].Battle.IsDefined())
+                            else if (!Story::CurrentBook[current].Battle.IsDefined())
                             {
                                 if (party.Count() > 1)
                                 {
@@ -8140,22 +8218,36 @@ namespace BloodSword::Interface
         return update;
     }
 
-    // adds text to scene using cache
+    // adds text to scene using cache (all glyphs come from the same texture and are drawn in one batch)
     void AddText(Scene::Base &scene, FontCache::Base &cache, std::string &text, int x, int y)
     {
-        if (cache.Has(text))
+        if (!cache.Atlas)
+        {
+            return;
+        }
+
+        if (SafeCast(text.size()) > 1 && cache.Has(text))
         {
-            scene.VerifyAndAdd(Scene::Element(cache[text].Texture, Point(x, y)));
+            scene.Add(Scene::Element(cache.Atlas, cache[text].Bounds, x, y));
         }
         else
         {
-            for (auto c = 0; c < SafeCast(text.size()); c++)
+            auto previous = char(0);
+
+            for (auto chr : text)
             {
-                auto glyph = cache[std::string(1, text[c])];
+                auto &glyph = cache[chr];
+
+                x += cache.Kerning(previous, chr);
+
+                if (glyph.Width > 0)
+                {
+                    scene.Add(Scene::Element(cache.Atlas, glyph.Bounds, x, y));
+                }
 
-                scene.VerifyAndAdd(Scene::Element(glyph.Texture, Point(x, y)));
+                x += glyph.Advance;
 
-                x += glyph.Width;
+                previous = chr;
             }
         }
     }
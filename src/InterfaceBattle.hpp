@@ -1437,6 +1437,9 @@ namespace BloodSword::Interface
                                 // enemy action (fight/shoot/cast/move)
                                 if (is_enemy && !character.Is(Character::Status::ENTHRALLED))
                                 {
+                                    // fast-forward enemy actions (if enabled)
+                                    Graphics::Autoplay = true;
+
                                     // enemy combatant is not paralyzed
                                     if (has_actions)
                                     {
@@ -1546,6 +1549,8 @@ namespace BloodSword::Interface
                                         }
                                     }
 
+                                    Graphics::Autoplay = false;
+
                                     if (!animating)
                                     {
                                         performed_action = true;
@@ -2457,9 +2462,13 @@ namespace BloodSword::Interface
                         }
                         else
                         {
-                            // animate movement
+                            // animate movement (enemy movement may be fast-forwarded)
+                            Graphics::Autoplay = (is_enemy && !character.Is(Character::Status::ENTHRALLED));
+
                             animating = !Graphics::Animate(graphics, scene, movement, BloodSword::FrameDelay);
 
+                            Graphics::Autoplay = false;
+
                             if (!animating)
                             {
                                 // cancel fleeing status
@@ -2497,7 +2506,7 @@ namespace BloodSword::Interface
                         else if (regenerate_scene)
                         {
                             // regenerate scene (on map movement, movement, etc.)
-                            scene = Interface::BattleScene(battle, party, character, character_id, origin, shot_ambush);
+                            Interface::BattleScene(scene, battle, party, character, character_id, origin, shot_ambush);
                         }
                     }
 
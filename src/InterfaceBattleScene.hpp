@@ -402,12 +402,12 @@ namespace BloodSword::Interface
         }
     }
 
-    // setup battle scene
-    Scene::Base BattleScene(Battle::Base &battle, Party::Base &party, Scene::Elements &assets, Controls::Collection &controls, Point location)
+    // fill scene with the battle map (re-uses the scene's memory)
+    void BattleScene(Scene::Base &scene, Battle::Base &battle, Party::Base &party, Scene::Elements &assets, Controls::Collection &controls, Point location)
     {
         auto num = (SafeCast(assets.size()) == SafeCast(controls.size()) ? SafeCast(controls.size()) : 0);
 
-        auto scene = Interface::Map(battle.Map, party, battle.Opponents, num);
+        Interface::Map(scene, battle.Map, party, battle.Opponents, num);
 
         if (num > 0)
         {
@@ -423,6 +423,14 @@ namespace BloodSword::Interface
         }
 
         Interface::MapControls(scene, battle);
+    }
+
+    // setup battle scene
+    Scene::Base BattleScene(Battle::Base &battle, Party::Base &party, Scene::Elements &assets, Controls::Collection &controls, Point location)
+    {
+        auto scene = Scene::Base();
+
+        Interface::BattleScene(scene, battle, party, assets, controls, location);
 
         return scene;
     }
@@ -443,8 +451,8 @@ namespace BloodSword::Interface
         return Interface::BattleScene(battle, party, Point(battle.Map.DrawX, battle.Map.DrawY + BloodSword::TileSize + BloodSword::Pad));
     }
 
-    // regenerate battle map (starting at point location)
-    Scene::Base BattleScene(Battle::Base &battle, Party::Base &party, Point location, Character::Base &character, int id, Point origin, bool ranged = false)
+    // regenerate battle map starting at point location (re-uses the scene's memory)
+    void BattleScene(Scene::Base &scene, Battle::Base &battle, Party::Base &party, Point location, Character::Base &character, int id, Point origin, bool ranged = false)
     {
         auto map = int(battle.Map.ViewX * battle.Map.ViewY);
 
@@ -600,13 +608,33 @@ namespace BloodSword::Interface
             }
         }
 
-        return Interface::BattleScene(battle, party, elements, controls, location);
+        Interface::BattleScene(scene, battle, party, elements, controls, location);
+    }
+
+    // regenerate battle map (starting at point location)
+    Scene::Base BattleScene(Battle::Base &battle, Party::Base &party, Point location, Character::Base &character, int id, Point origin, bool ranged = false)
+    {
+        auto scene = Scene::Base();
+
+        Interface::BattleScene(scene, battle, party, location, character, id, origin, ranged);
+
+        return scene;
+    }
+
+    // setup battle scene (re-uses the scene's memory)
+    void BattleScene(Scene::Base &scene, Battle::Base &battle, Party::Base &party, Character::Base &character, int id, Point origin, bool ranged = false)
+    {
+        Interface::BattleScene(scene, battle, party, Point(battle.Map.DrawX, battle.Map.DrawY + BloodSword::TileSize + BloodSword::Pad), character, id, origin, ranged);
     }
 
     // setup battle scene
     Scene::Base BattleScene(Battle::Base &battle, Party::Base &party, Character::Base &character, int id, Point origin, bool ranged = false)
     {
-        return Interface::BattleScene(battle, party, Point(battle.Map.DrawX, battle.Map.DrawY + BloodSword::TileSize + BloodSword::Pad), character, id, origin, ranged);
+        auto scene = Scene::Base();
+
+        Interface::BattleScene(scene, battle, party, character, id, origin, ranged);
+
+        return scene;
     }
 
     // drop any droppable items upon character's death
@@ -1070,7 +1098,7 @@ namespace BloodSword::Interface
 
             if (regenerate_scene)
             {
-                map = Interface::BattleScene(battle, party, assets, controls, location);
+                Interface::BattleScene(map, battle, party, assets, controls, location);
 
                 if (input.Type == Controls::Type::MAP_DOWN || input.Type == Controls::Type::MAP_UP || input.Type == Controls::Type::MAP_LEFT || input.Type == Controls::Type::MAP_RIGHT)
                 {
@@ -1282,7 +1310,7 @@ namespace BloodSword::Interface
 
             if (regenerate_scene)
             {
-                map = Interface::BattleScene(battle, party, assets, controls, location);
+                Interface::BattleScene(map, battle, party, assets, controls, location);
 
                 if (input.Type == Controls::Type::MAP_DOWN || input.Type == Controls::Type::MAP_UP || input.Type == Controls::Type::MAP_LEFT || input.Type == Controls::Type::MAP_RIGHT)
                 {
@@ -1504,7 +1532,7 @@ namespace BloodSword::Interface
 
             if (regenerate_scene)
             {
-                map = Interface::BattleScene(battle, party, assets, controls, location);
+                Interface::BattleScene(map, battle, party, assets, controls, location);
 
                 if (input.Type == Controls::Type::MAP_DOWN || input.Type == Controls::Type::MAP_UP || input.Type == Controls::Type::MAP_LEFT || input.Type == Controls::Type::MAP_RIGHT)
                 {
@@ -22,7 +22,7 @@ namespace BloodSword::Interface
             auto current = Story::CurrentBook.Find(party.Location);
 
             // select destination for dropped items
-            auto &destination = (current != -1 && current >= 0 && current < SafeCast(Story::CurrentBook.Sections.size())) ? Story::CurrentBook.Sections[current].Items : ether;
+            auto &destination = (current != -1 && current >= 0 && current < SafeCast(Story::CurrentBook.Sections.size())) ? Story::CurrentBook[current].Items : ether;
 
             auto assets = Asset::List();
 
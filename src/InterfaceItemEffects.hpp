@@ -194,7 +194,7 @@ namespace BloodSword::Interface
 
             if (random >= 0 && random < SafeCast(Story::CurrentBook.Sections.size()))
             {
-                auto &section = Story::CurrentBook.Sections[random];
+                auto &section = Story::CurrentBook[random];
 
                 auto text = Engine::MapTokens(party, section.Text);
 
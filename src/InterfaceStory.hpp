@@ -161,9 +161,7 @@ namespace BloodSword::Interface
     // process background events
     Book::Location ProcessBackground(Graphics::Base &graphics, Scene::Base &background, Party::Base &party)
     {
-        auto current = Story::CurrentBook.Find(party.Location);
-
-        auto &section = (current >= 0 && current < SafeCast(Story::CurrentBook.Sections.size())) ? Story::CurrentBook.Sections[current] : Story::CurrentBook.Sections[0];
+        auto &section = Story::CurrentBook.Get(party.Location);
 
         Book::Location next = Book::Undefined;
 
@@ -215,9 +213,7 @@ namespace BloodSword::Interface
     // process real-time events
     std::vector<Conditions::Evaluation> ProcessEvents(Graphics::Base &graphics, Scene::Base &background, Party::Base &party)
     {
-        auto current = Story::CurrentBook.Find(party.Location);
-
-        auto &section = (current >= 0 && current < SafeCast(Story::CurrentBook.Sections.size())) ? Story::CurrentBook.Sections[current] : Story::CurrentBook.Sections[0];
+        auto &section = Story::CurrentBook.Get(party.Location);
 
         auto results = std::vector<Conditions::Evaluation>();
 
@@ -256,9 +252,7 @@ namespace BloodSword::Interface
     {
         auto next = Book::Undefined;
 
-        auto current = Story::CurrentBook.Find(party.Location);
-
-        auto &section = (current >= 0 && current < SafeCast(Story::CurrentBook.Sections.size())) ? Story::CurrentBook.Sections[current] : Story::CurrentBook.Sections[0];
+        auto &section = Story::CurrentBook.Get(party.Location);
 
         if (SafeCast(section.BattleEvents.size()) > 0)
         {
@@ -303,9 +297,7 @@ namespace BloodSword::Interface
     // get next location (story jump)
     Book::Location NextSection(Graphics::Base &graphics, Scene::Base &background, Party::Base &party)
     {
-        auto current = Story::CurrentBook.Find(party.Location);
-
-        auto &section = (current >= 0 && current < SafeCast(Story::CurrentBook.Sections.size())) ? Story::CurrentBook.Sections[current] : Story::CurrentBook.Sections[0];
+        auto &section = Story::CurrentBook.Get(party.Location);
 
         Book::Location next = Book::Undefined;
 
@@ -435,9 +427,7 @@ namespace BloodSword::Interface
     // when character is in a task / alone
     void CharacterStoryControls(Party::Base &party, Scene::Base &overlay, Point buttons, Point scroll_top, Point scroll_bot, bool arrow_up, bool arrow_dn, Character::Class character)
     {
-        auto current = Story::CurrentBook.Find(party.Location);
-
-        auto &section = (current >= 0 && current < SafeCast(Story::CurrentBook.Sections.size())) ? Story::CurrentBook.Sections[current] : Story::CurrentBook.Sections[0];
+        auto &section = Story::CurrentBook.Get(party.Location);
 
         auto elements = SafeCast(overlay.Elements.size());
 
@@ -589,9 +579,7 @@ namespace BloodSword::Interface
     // generate (default) story controls
     void StoryControls(Party::Base &party, Scene::Base &overlay, Point buttons, Point scroll_top, Point scroll_bot, bool arrow_up, bool arrow_dn)
     {
-        auto current = Story::CurrentBook.Find(party.Location);
-
-        auto &section = (current >= 0 && current < SafeCast(Story::CurrentBook.Sections.size())) ? Story::CurrentBook.Sections[current] : Story::CurrentBook.Sections[0];
+        auto &section = Story::CurrentBook.Get(party.Location);
 
         auto elements = SafeCast(overlay.Elements.size());
 
@@ -788,9 +776,7 @@ namespace BloodSword::Interface
     // generate story controls when processing an item effect
     void ItemControls(Party::Base &party, Scene::Base &overlay, Point buttons, Point scroll_top, Point scroll_bot, bool arrow_up, bool arrow_dn)
     {
-        auto current = Story::CurrentBook.Find(party.Location);
-
-        auto &section = (current >= 0 && current < SafeCast(Story::CurrentBook.Sections.size())) ? Story::CurrentBook.Sections[current] : Story::CurrentBook.Sections[0];
+        auto &section = Story::CurrentBook.Get(party.Location);
 
         auto elements = SafeCast(overlay.Elements.size());
 
@@ -1191,15 +1177,10 @@ namespace BloodSword::Interface
     // render story section
     Book::Location RenderSection(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, Party::Base &saved_party, std::string &text)
     {
-        auto current = Story::CurrentBook.Find(party.Location);
-
-        auto &section = (current >= 0 && current < SafeCast(Story::CurrentBook.Sections.size())) ? Story::CurrentBook.Sections[current] : Story::CurrentBook.Sections[0];
+        auto &section = Story::CurrentBook.Get(party.Location);
 
         Book::Location next = Book::Undefined;
 
-        // texture for section text / default text
-        SDL_Texture *texture = nullptr;
-
         // texture for left panel (either party stats, or specific images)
         SDL_Texture *image = nullptr;
 
@@ -1224,22 +1205,11 @@ namespace BloodSword::Interface
 
         Interface::MapTokensInText(party, text);
 
-        if (text.length() > 0)
-        {
-            texture = Graphics::CreateText(graphics, text.c_str(), Fonts::Normal, Color::S(Color::Active), TTF_STYLE_NORMAL, text_w);
-        }
-        else
-        {
-            texture = Graphics::CreateText(graphics, "You decide what to do next.", Fonts::Normal, Color::S(Color::Active), TTF_STYLE_NORMAL, text_w);
-        }
+        // section text / default text (only the visible lines are rendered)
+        auto view = Graphics::TextView(Fonts::Normal, text.length() > 0 ? text : std::string("You decide what to do next."), Color::S(Color::Active), TTF_STYLE_NORMAL, text_w);
 
-        // texture dimensions
-        auto texture_w = 0;
-
-        auto texture_h = 0;
-
-        // get actual dimension
-        BloodSword::Size(texture, &texture_w, &texture_h);
+        // height of the entire text
+        auto texture_h = view.Height();
 
         auto image_location = origin + Point(BloodSword::Pad, BloodSword::Pad);
 
@@ -1308,9 +1278,12 @@ namespace BloodSword::Interface
         // global effects (based on FEATURES of this section)
         Interface::ApplyGlobalEffects(section, party);
 
+        // story panels (re-used on every iteration)
+        auto overlay = Scene::Base();
+
         while (!done)
         {
-            auto overlay = Scene::Base();
+            overlay.Reset();
 
             // left panel border
             overlay.Add(Scene::Element(origin.X, origin.Y, panel_w, panel_h, Color::Background, Color::Active, BloodSword::Border));
@@ -1325,11 +1298,7 @@ namespace BloodSword::Interface
             overlay.Add(Scene::Element(origin.X + panel_w + BloodSword::TileSize + BloodSword::LargePad, origin.Y, panel_w, panel_h, Color::Background, Color::Active, BloodSword::Border));
 
             // text panel
-            if (texture)
-            {
-                // text
-                overlay.VerifyAndAdd(Scene::Element(texture, origin_text.X, origin_text.Y, text_h, offset));
-            }
+            view.Add(graphics, overlay, origin_text.X, origin_text.Y, text_h, offset);
 
             auto arrow_up = offset > 0;
 
@@ -1628,7 +1597,7 @@ namespace BloodSword::Interface
 
         BloodSword::Free(&image);
 
-        BloodSword::Free(&texture);
+        view.Free();
 
         BloodSword::Free(textures);
 
@@ -1638,7 +1607,25 @@ namespace BloodSword::Interface
     // play current story section
     Book::Location ProcessSection(Graphics::Base &graphics, Scene::Base &background, Party::Base &party, int current)
     {
-        auto &section = (current >= 0 && current < SafeCast(Story::CurrentBook.Sections.size())) ? Story::CurrentBook.Sections[current] : Story::CurrentBook.Sections[0];
+        // the section stays in memory while it is played, whatever else is fetched
+        auto playing = (current >= 0 && current < SafeCast(Story::CurrentBook.Sections.size())) ? current : 0;
+
+        Story::CurrentBook.Pin(playing);
+
+        auto &section = Story::CurrentBook[playing];
+
+        // parse sections reachable from here ahead of time
+        auto reachable = Story::CurrentBook.Prefetch(current);
+
+        // decode illustrations in the background (current section first)
+        auto zip_file = Interface::Zipped ? Interface::ZipFile : std::string();
+
+        Asset::Preload(section.ImageAsset, zip_file);
+
+        for (auto next : reachable)
+        {
+            Asset::Preload(Story::CurrentBook.Sections[next].ImageAsset, zip_file);
+        }
 
         StoryLogger::LogSectionHeader("SECTION", section.Location);
 
@@ -1781,7 +1768,7 @@ namespace BloodSword::Interface
     void NewGame(Graphics::Base &graphics, Party::Base &party)
     {
         // reset internal variables
-        party.Variables.clear();
+        party.Variables.Clear();
 
         // reset all status
         party.ClearStatus();
@@ -966,15 +966,15 @@ namespace BloodSword::Items
         }
         else
         {
-            auto ifs = ZipFile::Read(zip_file, items);
+            auto ifs = ZipFile::Open(zip_file, items);
 
-            if (!ifs.empty())
+            if (!ifs.IsEmpty())
             {
-                auto data = nlohmann::json::parse(ifs);
+                auto data = nlohmann::json::parse(ifs.View());
 
                 Items::InitializeDefaults(data);
 
-                ifs.clear();
+                ifs.Clear();
             }
         }
     }
@@ -1007,7 +1007,7 @@ namespace BloodSword::Items
 
                 if (item != Item::Type::NONE)
                 {
-                    Items::Descriptions[item] = description;
+                    Items::Descriptions.Set(item, description);
                 }
             }
 
@@ -1045,15 +1045,15 @@ namespace BloodSword::Items
         }
         else
         {
-            auto ifs = ZipFile::Read(zip_file, items);
+            auto ifs = ZipFile::Open(zip_file, items);
 
-            if (!ifs.empty())
+            if (!ifs.IsEmpty())
             {
-                auto data = nlohmann::json::parse(ifs);
+                auto data = nlohmann::json::parse(ifs.View());
 
                 Items::InitializeDescriptions(data);
 
-                ifs.clear();
+                ifs.Clear();
             }
         }
     }
@@ -39,7 +39,7 @@ namespace BloodSword::Item
     typedef std::vector<Item::Property> Properties;
 
     // mapping of item properties to strings
-    BloodSword::ConstStrings<Item::Property> PropertyMapping = {
+    constexpr auto PropertyMapping = BloodSword::Tabulate<Item::Property>({
         {Item::Property::NONE, "NONE"},
         {Item::Property::NORMAL, "NORMAL"},
         {Item::Property::WEAPON, "WEAPON"},
@@ -63,7 +63,7 @@ namespace BloodSword::Item
         {Item::Property::CURSED, "CURSED"},
         {Item::Property::REQUIRES_TARGET, "REQUIRES TARGET"},
         {Item::Property::RESURRECTION, "RESURRECTION"},
-        {Item::Property::ALL_RANGES, "ALL RANGES"}};
+        {Item::Property::ALL_RANGES, "ALL RANGES"}});
 
     // invisible properties (hide from item description)
     Item::Properties Invisible = {
@@ -21,13 +21,13 @@ namespace BloodSword::Item
     typedef std::vector<Item::TargetEffect> TargetEffects;
 
     // mapping of item target effects to strings
-    BloodSword::ConstStrings<Item::TargetEffect> TargetEffectMapping = {
+    constexpr auto TargetEffectMapping = BloodSword::Tabulate<Item::TargetEffect>({
         {Item::TargetEffect::NONE, "NONE"},
         {Item::TargetEffect::KILL_TARGET, "KILL TARGET"},
         {Item::TargetEffect::DAMAGE_TARGET, "DAMAGE TARGET"},
         {Item::TargetEffect::THROW, "THROW"},
         {Item::TargetEffect::SELF_BURN, "SELF BURN"},
-        {Item::TargetEffect::IMMUNE, "IMMUNE"}};
+        {Item::TargetEffect::IMMUNE, "IMMUNE"}});
 
     // map string to item target effect
     Item::TargetEffect MapTargetEffect(const char *target_effect)
@@ -85,7 +85,7 @@ namespace BloodSword::Item
     };
 
     // mapping of item types to strings
-    BloodSword::StringMap<Item::Type> TypeMapping = {
+    constexpr auto TypeMapping = BloodSword::Tabulate<Item::Type, std::string>({
         {Item::Type::NONE, "NONE"},
         {Item::Type::SWORD, "SWORD"},
         {Item::Type::BOW, "BOW"},
@@ -158,7 +158,7 @@ namespace BloodSword::Item
         {Item::Type::ENCHANTED_BELT_OF_STRENGTH, "ENCHANTED BELT OF STRENGTH"},
         {Item::Type::SHIELDING_CHARM, "SHIELDING CHARM"},
         {Item::Type::MAGIC_BOW, "MAGIC BOW"},
-        {Item::Type::RING_OF_SORCERY, "RING OF SORCERY"}};
+        {Item::Type::RING_OF_SORCERY, "RING OF SORCERY"}});
 
     // item type mapping template
     template <typename T>
@@ -204,13 +204,13 @@ namespace BloodSword::Item
     };
 
     // mapping of kalugen card types to strings
-    BloodSword::ConstStrings<Item::CardType> CardMapping = {
+    constexpr auto CardMapping = BloodSword::Tabulate<Item::CardType>({
         {Item::CardType::NONE, "NONE"},
         {Item::CardType::KING_OF_SERPENTS, "KING OF SERPENTS"},
         {Item::CardType::ACE_OF_STARS, "ACE OF STARS"},
         {Item::CardType::ACE_OF_SWORDS, "ACE OF SWORDS"},
         {Item::CardType::ACE_OF_RINGS, "ACE OF RINGS"},
-        {Item::CardType::BUFFOON, "BUFFOON"}};
+        {Item::CardType::BUFFOON, "BUFFOON"}});
 
     // map string to kalugen card type
     Item::CardType MapCard(const char *item)
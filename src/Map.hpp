@@ -448,15 +448,15 @@ namespace BloodSword::Map
         {
             auto LoadError = false;
 
-            auto ifs = ZipFile::Read(zip_file, map);
+            auto ifs = ZipFile::Open(zip_file, map);
 
-            if (!ifs.empty())
+            if (!ifs.IsEmpty())
             {
-                auto data = nlohmann::json::parse(ifs);
+                auto data = nlohmann::json::parse(ifs.View());
 
                 LoadError = this->Setup(data);
 
-                ifs.clear();
+                ifs.Clear();
             }
             else
             {
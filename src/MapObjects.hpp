@@ -25,7 +25,7 @@ namespace BloodSword::Map
     };
 
     // mapping of map object types to strings
-    BloodSword::ConstStrings<Object> ObjectMapping = {
+    constexpr auto ObjectMapping = BloodSword::Tabulate<Object>({
         {Object::NONE, "NONE"},
         {Object::PLAYER, "PLAYER"},
         {Object::ENEMY, "ENEMY"},
@@ -38,7 +38,7 @@ namespace BloodSword::Map
         {Object::ITEMS, "ITEMS"},
         {Object::PARTY, "PARTY"},
         {Object::ENEMIES, "ENEMIES"},
-        {Object::TRIGGER, "TRIGGER"}};
+        {Object::TRIGGER, "TRIGGER"}});
 
     // get map object type from string
     Object MapObject(const char *object)
@@ -12,9 +12,9 @@ namespace BloodSword::MapRenderer
 
             rect.y = point.Y * BloodSword::TileSize + offset;
 
-            auto surface_sset = blur ? Asset::Surface(asset, 0x7F7F7F7F) : Asset::Surface(asset);
+            auto surface_asset = blur ? Asset::Cached(asset, 0x7F7F7F7F) : Asset::Cached(asset);
 
-            Graphics::RenderAssetThenFree(surface, surface_sset, rect);
+            Graphics::RenderAsset(surface, surface_asset, rect);
         }
     }
 
@@ -83,6 +83,11 @@ namespace BloodSword::MapRenderer
                 // fill entire map
                 SDL_FillRect(surface, nullptr, SDL_MapRGBA(surface->format, 255, 255, 255, 255));
 
+                // tile used for empty spaces
+                auto empty_space = Graphics::CreateSurface(BloodSword::TileSize, BloodSword::TileSize);
+
+                SDL_FillRect(empty_space, nullptr, SDL_MapRGBA(surface->format, 0, 0, 0, 255));
+
                 for (auto y = 0; y < battle.Map.Height; y++)
                 {
                     for (auto x = 0; x < battle.Map.Width; x++)
@@ -95,15 +100,15 @@ namespace BloodSword::MapRenderer
                         {
                             if (tile.Asset == Asset::Map("EMPTY SPACE"))
                             {
-                                surface_asset = Asset::Surface("SELECT");
+                                surface_asset = Asset::Cached("SELECT");
                             }
                             else if (tile.Asset != Asset::NONE)
                             {
-                                surface_asset = Asset::Surface(tile.Asset);
+                                surface_asset = Asset::Cached(tile.Asset);
                             }
                             else if (tile.Type == Map::Object::EXIT)
                             {
-                                surface_asset = Asset::Surface("SELECT");
+                                surface_asset = Asset::Cached("SELECT");
                             }
                         }
                         else
@@ -114,7 +119,7 @@ namespace BloodSword::MapRenderer
 
                                 if (tile.Id >= 0 && tile.Id < party.Count() && party.Count() > 0)
                                 {
-                                    surface_asset = Asset::Surface("SELECT");
+                                    surface_asset = Asset::Cached("SELECT");
                                 }
 
                                 break;
@@ -123,7 +128,7 @@ namespace BloodSword::MapRenderer
 
                                 if (tile.Id >= 0 && tile.Id < battle.Opponents.Count() && battle.Opponents.Count() > 0)
                                 {
-                                    surface_asset = Asset::Surface(battle.Opponents[tile.Id].Asset);
+                                    surface_asset = Asset::Cached(battle.Opponents[tile.Id].Asset);
                                 }
 
                                 break;
@@ -134,12 +139,12 @@ namespace BloodSword::MapRenderer
                                 {
                                     if (tile.TemporaryAsset != Asset::NONE)
                                     {
-                                        surface_asset = Asset::Surface(tile.TemporaryAsset);
+                                        surface_asset = Asset::Cached(tile.TemporaryAsset);
                                     }
                                 }
                                 else if (tile.Asset != Asset::NONE)
                                 {
-                                    surface_asset = Asset::Surface(tile.Asset);
+                                    surface_asset = Asset::Cached(tile.Asset);
                                 }
 
                                 break;
@@ -153,19 +158,19 @@ namespace BloodSword::MapRenderer
                         if (surface_asset == nullptr)
                         {
                             // fill empty space
-                            surface_asset = Graphics::CreateSurface(BloodSword::TileSize, BloodSword::TileSize);
-
-                            SDL_FillRect(surface_asset, nullptr, SDL_MapRGBA(surface->format, 0, 0, 0, 255));
+                            surface_asset = empty_space;
                         }
 
                         rect.x = x * BloodSword::TileSize + offset;
 
                         rect.y = y * BloodSword::TileSize + offset;
 
-                        Graphics::RenderAssetThenFree(surface, surface_asset, rect);
+                        Graphics::RenderAsset(surface, surface_asset, rect);
                     }
                 }
 
+                BloodSword::Free(&empty_space);
+
                 // away players
                 MapRenderer::RenderPoints(surface, battle.Map.AwayPlayers, rect, offset, Asset::Map("CIRCLE"), true);
 
@@ -184,9 +189,9 @@ namespace BloodSword::MapRenderer
 
                     rect.y = origin.Y * BloodSword::TileSize + offset;
 
-                    auto character_asset = Asset::Surface(Interface::Numbers[number]);
+                    auto character_asset = Asset::Cached(Interface::Numbers[number]);
 
-                    Graphics::RenderAssetThenFree(surface, character_asset, rect);
+                    Graphics::RenderAsset(surface, character_asset, rect);
 
                     number++;
                 }
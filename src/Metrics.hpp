@@ -0,0 +1,305 @@
+#ifndef __METRICS_HPP__
+#define __METRICS_HPP__
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+#ifndef SDL_MAIN_HANDLED
+#define SDL_MAIN_HANDLED
+#endif
+
+#include <SDL.h>
+
+// frame time and draw call instrumentation (shown on screen and logged when enabled)
+namespace BloodSword::Metrics
+{
+    // parts of a frame: BUILD (scenes are set up), RENDER (scenes are drawn), PRESENT (frame is shown, including pacing)
+    enum class Phase
+    {
+        BUILD = 0,
+        RENDER,
+        PRESENT
+    };
+
+    // counts and times of one or more frames
+    class Frame
+    {
+    public:
+        // time (in milliseconds) spent setting up scenes
+        double Build = 0.0;
+
+        // time (in milliseconds) spent drawing scenes
+        double Render = 0.0;
+
+        // time (in milliseconds) spent presenting
+        double Present = 0.0;
+
+        // render calls
+        Uint64 DrawCalls = 0;
+
+        // render calls that use a different texture than the previous one
+        Uint64 Switches = 0;
+
+        // strings rasterized by the font renderer
+        Uint64 Rasterized = 0;
+
+        // add counts and times of another frame
+        void Add(Metrics::Frame &frame)
+        {
+            this->Build += frame.Build;
+
+            this->Render += frame.Render;
+
+            this->Present += frame.Present;
+
+            this->DrawCalls += frame.DrawCalls;
+
+            this->Switches += frame.Switches;
+
+            this->Rasterized += frame.Rasterized;
+        }
+    };
+
+    // show and log the measurements
+    bool Enabled = false;
+
+    // number of textures alive
+    Sint64 Textures = 0;
+
+    // memory (estimated) used by the textures alive
+    Sint64 TextureBytes = 0;
+
+    // frame being measured
+    Metrics::Frame Current = Metrics::Frame();
+
+    // frames measured since the last report
+    Metrics::Frame Total = Metrics::Frame();
+
+    // number of frames measured since the last report
+    Uint64 Frames = 0;
+
+    // phase being measured
+    Metrics::Phase Running = Metrics::Phase::BUILD;
+
+    // performance counter when the phase started
+    Uint64 Mark = 0;
+
+    // time (in milliseconds) spent waiting for events during the phase
+    double Idle = 0.0;
+
+    // performance counter of the last report
+    Uint64 Reported = 0;
+
+    // last report
+    std::string Report = std::string();
+
+    // report changed since it was last shown
+    bool Updated = false;
+
+    // last texture drawn
+    SDL_Texture *Last = nullptr;
+
+    // current time (performance counter)
+    Uint64 Now()
+    {
+        return SDL_GetPerformanceCounter();
+    }
+
+    // milliseconds since a time (performance counter)
+    double Since(Uint64 start)
+    {
+        return double(SDL_GetPerformanceCounter() - start) * 1000.0 / double(SDL_GetPerformanceFrequency());
+    }
+
+    // texture memory (estimated at 4 bytes per pixel)
+    Sint64 Bytes(SDL_Texture *texture)
+    {
+        auto w = 0;
+
+        auto h = 0;
+
+        SDL_QueryTexture(texture, nullptr, nullptr, &w, &h);
+
+        return Sint64(w) * Sint64(h) * 4;
+    }
+
+    // record a new texture
+    void Created(SDL_Texture *texture)
+    {
+        if (texture)
+        {
+            Metrics::Textures++;
+
+            Metrics::TextureBytes += Metrics::Bytes(texture);
+        }
+    }
+
+    // record a texture about to be destroyed
+    void Destroyed(SDL_Texture *texture)
+    {
+        if (texture)
+        {
+            Metrics::Textures--;
+
+            Metrics::TextureBytes -= Metrics::Bytes(texture);
+
+            if (Metrics::Last == texture)
+            {
+                Metrics::Last = nullptr;
+            }
+        }
+    }
+
+    // record a render call
+    void Draw(SDL_Texture *texture)
+    {
+        Metrics::Current.DrawCalls++;
+
+        if (texture != Metrics::Last)
+        {
+            Metrics::Current.Switches++;
+
+            Metrics::Last = texture;
+        }
+    }
+
+    // record text rasterized by the font renderer
+    void Rasterize()
+    {
+        Metrics::Current.Rasterized++;
+    }
+
+    // record time spent waiting for events (excluded from the frame)
+    void Waited(Uint64 start)
+    {
+        Metrics::Idle += Metrics::Since(start);
+    }
+
+    // end the phase being measured and start another
+    void Start(Metrics::Phase phase)
+    {
+        auto now = Metrics::Now();
+
+        if (Metrics::Mark != 0)
+        {
+            auto elapsed = std::max(0.0, double(now - Metrics::Mark) * 1000.0 / double(SDL_GetPerformanceFrequency()) - Metrics::Idle);
+
+            switch (Metrics::Running)
+            {
+            case Metrics::Phase::BUILD:
+                Metrics::Current.Build += elapsed;
+
+                break;
+            case Metrics::Phase::RENDER:
+                Metrics::Current.Render += elapsed;
+
+                break;
+            default:
+                Metrics::Current.Present += elapsed;
+
+                break;
+            }
+        }
+
+        Metrics::Running = phase;
+
+        Metrics::Mark = now;
+
+        Metrics::Idle = 0.0;
+    }
+
+    // frame was presented: summarize the frames every second
+    void Presented()
+    {
+        Metrics::Start(Metrics::Phase::BUILD);
+
+        Metrics::Total.Add(Metrics::Current);
+
+        Metrics::Current = Metrics::Frame();
+
+        Metrics::Frames++;
+
+        if (Metrics::Reported == 0)
+        {
+            Metrics::Reported = Metrics::Mark;
+        }
+
+        auto elapsed = double(Metrics::Mark - Metrics::Reported) / double(SDL_GetPerformanceFrequency());
+
+        if (elapsed >= 1.0)
+        {
+            auto frames = double(Metrics::Frames);
+
+            char report[256];
+
+            SDL_snprintf(report, sizeof(report), "FPS: %.1f\nBUILD: %.2f ms RENDER: %.2f ms PRESENT: %.2f ms\nDRAW CALLS: %.0f TEXTURE SWITCHES: %.0f TEXT: %.1f\nTEXTURES: %lld (%.1f MB)",
+                         frames / elapsed,
+                         Metrics::Total.Build / frames,
+                         Metrics::Total.Render / frames,
+                         Metrics::Total.Present / frames,
+                         double(Metrics::Total.DrawCalls) / frames,
+                         double(Metrics::Total.Switches) / frames,
+                         double(Metrics::Total.Rasterized) / frames,
+                         (long long)Metrics::Textures,
+                         double(Metrics::TextureBytes) / (1024.0 * 1024.0));
+
+            Metrics::Report = std::string(report);
+
+            Metrics::Updated = true;
+
+            if (Metrics::Enabled)
+            {
+                SDL_Log("[METRICS] %s", Metrics::Report.c_str());
+            }
+
+            Metrics::Total = Metrics::Frame();
+
+            Metrics::Frames = 0;
+
+            Metrics::Reported = Metrics::Mark;
+        }
+    }
+
+    // let the report through while measuring, even if logging is disabled (priorities set here take precedence over SDL_HINT_LOGGING)
+    void Sink()
+    {
+        if (Metrics::Enabled)
+        {
+            SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+        }
+        else
+        {
+            SDL_LogResetPriorities();
+        }
+    }
+
+    // toggle on-screen display and logging
+    void Toggle()
+    {
+        Metrics::Enabled = !Metrics::Enabled;
+
+        Metrics::Updated = true;
+
+        Metrics::Sink();
+    }
+
+    // enable measurements if requested on the command line (--metrics)
+    void Options(int argc, char **argv)
+    {
+        for (auto arg = 1; arg < argc; arg++)
+        {
+            if (argv[arg] && std::strcmp(argv[arg], "--metrics") == 0)
+            {
+                Metrics::Enabled = true;
+            }
+        }
+
+        if (Metrics::Enabled)
+        {
+            Metrics::Sink();
+        }
+    }
+}
+
+#endif
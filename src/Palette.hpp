@@ -121,15 +121,15 @@ namespace BloodSword::Palette
         }
         else
         {
-            auto ifs = ZipFile::Read(zip_file, palettes);
+            auto ifs = ZipFile::Open(zip_file, palettes);
 
-            if (!ifs.empty())
+            if (!ifs.IsEmpty())
             {
-                auto data = nlohmann::json::parse(ifs);
+                auto data = nlohmann::json::parse(ifs.View());
 
                 Palette::Initialize(data);
 
-                ifs.clear();
+                ifs.Clear();
             }
         }
     }
@@ -8,6 +8,7 @@
 #include "BattleResults.hpp"
 #include "Book.hpp"
 #include "Character.hpp"
+#include "Variables.hpp"
 #include "ZipFileLibrary.hpp"
 
 // functions for managing the party of characters
@@ -55,7 +56,7 @@ namespace BloodSword::Party
         Items::Deck Cards = {};
 
         // variables
-        BloodSword::UnorderedMap<std::string, std::string> Variables = {};
+        Variables::Store Variables = Variables::Store();
 
         // location on map: room, x, y (rogue mode)
         int Room = -1;
@@ -531,17 +532,17 @@ namespace BloodSword::Party
                 this->Cards = Items::LoadHand(data["cards"]);
             }
 
-            this->Variables.clear();
+            this->Variables.Clear();
 
             if (!data["variables"].is_null() && data["variables"].is_object())
             {
                 for (auto &[key, val] : data["variables"].items())
                 {
-                    auto variable = std::string(key);
+                    auto variable = Variables::Intern(std::string(key));
 
                     auto value = std::string(val);
 
-                    this->Variables[key] = value;
+                    this->Variables.Set(variable, value);
                 }
             }
 
@@ -557,80 +558,104 @@ namespace BloodSword::Party
         // check if string is a number
         bool IsANumber(const std::string &variable)
         {
-            // check if first character is a sign (-/+)
-            auto offset = (SafeCast(variable.size()) > 1 && (variable[0] == '-' || variable[0] == '+') ? 1 : 0);
-
-            // SEE: https://stackoverflow.com/questions/4654636/how-to-determine-if-a-string-is-a-number-with-c
-            auto result = !variable.empty() && std::find_if(variable.begin() + offset, variable.end(), [](unsigned char c)
-                                                            { return !std::isdigit(c); }) == variable.end();
-
-            SDL_Log("[VARIABLE %s] IS %s A NUMBER", variable.c_str(), (!result ? "NOT" : ""));
+            return Variables::IsNumber(variable);
+        }
 
-            return result;
+        // check if variable is in internal table
+        bool IsPresent(Variables::Operand &variable)
+        {
+            return !variable.IsEmpty() && this->Variables.Has(variable.Id);
         }
 
         // check if variable is in internal table
         bool IsPresent(std::string variable)
         {
-            auto result = !variable.empty() && BloodSword::Has(this->Variables, variable);
+            auto operand = Variables::Operand(variable);
+
+            return this->IsPresent(operand);
+        }
 
-            SDL_Log("[VARIABLE %s] IS %sSENT", variable.c_str(), (result ? "PRE" : "AB"));
+        // resolve variable (or literal) to a number, returns false if it does not resolve to one
+        bool Resolve(Variables::Operand &variable, int &value)
+        {
+            auto result = true;
+
+            if (variable.Id == Variables::PartySize)
+            {
+                value = this->Count();
+            }
+            else if (variable.Id == Variables::ChosenNumber)
+            {
+                value = this->ChosenNumber;
+            }
+            else if (variable.Numeric)
+            {
+                value = variable.Number;
+            }
+            else if (this->Variables.Has(variable.Id) && this->Variables[variable.Id].Numeric)
+            {
+                value = this->Variables[variable.Id].Number;
+            }
+            else
+            {
+                result = false;
+            }
 
             return result;
         }
 
         // get value of the variable stored in internal table (and/or return literal value)
-        std::string Get(std::string variable)
+        std::string Get(Variables::Operand &variable)
         {
             auto value = std::string();
 
-            if (!variable.empty())
+            if (!variable.IsEmpty())
             {
-                if (variable == "PARTY")
+                if (variable.Id == Variables::PartySize)
                 {
                     value = std::to_string(this->Count());
-
-                    SDL_Log("[PARTY] ---> %s", value.c_str());
                 }
-                else if (variable == "CHOSEN")
+                else if (variable.Id == Variables::ChosenNumber)
                 {
                     value = std::to_string(this->ChosenNumber);
-
-                    SDL_Log("[CHOSEN NUMBER] ---> %s", value.c_str());
                 }
-                else if (this->IsPresent(variable))
+                else if (this->Variables.Has(variable.Id))
                 {
-                    value = this->Variables[variable];
-
-                    SDL_Log("[VARIABLE %s] ---> %s", variable.c_str(), value.c_str());
+                    value = this->Variables[variable.Id].Text;
                 }
                 else
                 {
-                    SDL_Log("[LITERAL] %s", variable.c_str());
-
                     // may be a number or a string literal
-                    value = variable;
+                    value = variable.Text;
                 }
             }
 
             return value;
         }
 
+        // get value of the variable stored in internal table (and/or return literal value)
+        std::string Get(std::string variable)
+        {
+            auto operand = Variables::Operand(variable);
+
+            return this->Get(operand);
+        }
+
         // set variable
-        void Set(std::string variable, std::string value)
+        void Set(Variables::Operand &variable, std::string value)
         {
-            if (!variable.empty())
+            if (!variable.IsEmpty())
             {
-                if (variable == "CHOSEN")
+                if (variable.Id == Variables::ChosenNumber)
                 {
-                    if (this->IsANumber(value))
+                    if (Variables::IsNumber(value))
                     {
                         this->ChosenNumber = std::stoi(value, nullptr, 10);
 
                         SDL_Log("[CHOSEN NUMBER] <--- %s", value.c_str());
                     }
                 }
-                else if (variable == "PLAYER")
+                else if (variable.Id == Variables::ChosenPlayer)
                 {
                     auto index = this->Index(this->ChosenCharacter);
 
@@ -638,75 +663,77 @@ namespace BloodSword::Party
                     {
                         value = this->Members[index].Name;
 
-                        this->Variables[variable] = value;
+                        this->Variables.Set(variable.Id, value);
 
                         SDL_Log("[VARIABLE PLAYER] <--- %s", value.c_str());
                     }
                 }
-                else if (!this->IsANumber(variable))
+                else if (!variable.Numeric)
                 {
-                    this->Variables[variable] = value;
+                    this->Variables.Set(variable.Id, value);
 
-                    SDL_Log("[VARIABLE %s] <--- %s", variable.c_str(), value.c_str());
+                    SDL_Log("[VARIABLE %s] <--- %s", variable.Text.c_str(), value.c_str());
                 }
             }
         }
 
+        // set variable
+        void Set(std::string variable, std::string value)
+        {
+            auto operand = Variables::Operand(variable);
+
+            this->Set(operand, value);
+        }
+
         // set numerical value of a variable
-        void Set(std::string variable, int value)
+        void Set(Variables::Operand &variable, int value)
         {
-            if (!variable.empty())
+            if (!variable.IsEmpty())
             {
-                if (variable == "CHOSEN")
+                if (variable.Id == Variables::ChosenNumber)
                 {
                     this->ChosenNumber = value;
 
                     SDL_Log("[CHOSEN NUMBER] <--- %d", value);
                 }
-                else if (!this->IsANumber(variable))
+                else if (!variable.Numeric)
                 {
-                    this->Variables[variable] = std::to_string(value);
+                    this->Variables.Set(variable.Id, value);
 
-                    SDL_Log("[VARIABLE %s] <--- %d", variable.c_str(), value);
+                    SDL_Log("[VARIABLE %s] <--- %d", variable.Text.c_str(), value);
                 }
             }
         }
 
+        // set numerical value of a variable
+        void Set(std::string variable, int value)
+        {
+            auto operand = Variables::Operand(variable);
+
+            this->Set(operand, value);
+        }
+
         // get numeric value of a variable
-        int Number(std::string variable)
+        int Number(Variables::Operand &variable)
         {
             auto value = 0;
 
-            if (!variable.empty())
+            if (!variable.IsEmpty() && !this->Resolve(variable, value))
             {
-                if (variable == "PARTY")
-                {
-                    value = this->Count();
-                }
-                else if (variable != "CHOSEN")
-                {
-                    if (this->IsANumber(variable))
-                    {
-                        value = std::stoi(variable, nullptr, 10);
-                    }
-                    else
-                    {
-                        auto search = this->Get(variable);
-
-                        value = (!search.empty() && this->IsANumber(search)) ? std::stoi(search, nullptr, 10) : 0;
-                    }
-                }
-                else
-                {
-                    value = this->ChosenNumber;
-                }
+                value = 0;
             }
 
-            SDL_Log("[NUMBER %s] ---> %d", variable.c_str(), value);
-
             return value;
         }
 
+        // get numeric value of a variable
+        int Number(std::string variable)
+        {
+            auto operand = Variables::Operand(variable);
+
+            return this->Number(operand);
+        }
+
         // check if item is in the list
         bool IsValid(std::vector<std::string> list, std::string item)
         {
@@ -718,145 +745,168 @@ namespace BloodSword::Party
         }
 
         // math operations
-        void Math(std::string operation, std::string first, std::string second, bool clamp = true)
+        void Math(Variables::Operator operation, Variables::Operand &first, Variables::Operand &second, bool clamp = true)
         {
             // first = (first) (operation) (second)
-            if (!operation.empty() && !first.empty() && !this->IsANumber(first) && !second.empty())
+            if (Variables::IsMath(operation) && !first.IsEmpty() && !first.Numeric && !second.IsEmpty())
             {
-                // check if operation is valid
-                if (this->IsValid({"+", "-", "*"}, operation))
+                if (first.Id != Variables::ChosenNumber && !this->Variables.Has(first.Id))
                 {
-                    if (first != "CHOSEN" && !this->IsPresent(first) && !this->IsANumber(first))
-                    {
-                        // initialize first variable if not present
-                        this->Set(first, 0);
-                    }
+                    // initialize first variable if not present
+                    this->Set(first, 0);
+                }
 
-                    if ((!this->IsANumber(first) || this->IsANumber(this->Get(first))) && (this->IsANumber(second) || this->IsANumber(this->Get(second))))
-                    {
-                        auto value_first = this->Number(first);
+                auto value_first = 0;
 
-                        auto value_second = this->Number(second);
+                auto value_second = 0;
 
-                        if (operation == "+")
-                        {
-                            value_first += value_second;
-                        }
-                        else if (operation == "-")
-                        {
-                            value_first -= value_second;
-                        }
-                        else if (operation == "*")
-                        {
-                            value_first *= value_second;
-                        }
+                if (this->Resolve(second, value_second))
+                {
+                    value_first = this->Number(first);
 
-                        value_first = clamp ? std::max(0, value_first) : value_first;
+                    if (operation == Variables::Operator::ADD)
+                    {
+                        value_first += value_second;
+                    }
+                    else if (operation == Variables::Operator::SUBTRACT)
+                    {
+                        value_first -= value_second;
+                    }
+                    else if (operation == Variables::Operator::MULTIPLY)
+                    {
+                        value_first *= value_second;
+                    }
 
-                        SDL_Log("[MATH] %s %s %s = %d", first.c_str(), operation.c_str(), second.c_str(), value_first);
+                    value_first = clamp ? std::max(0, value_first) : value_first;
 
-                        // set variable
-                        this->Set(first, value_first);
-                    }
+                    SDL_Log("[MATH] %s %s %s = %d", first.Text.c_str(), Variables::OperatorMapping[operation].c_str(), second.Text.c_str(), value_first);
+
+                    // set variable
+                    this->Set(first, value_first);
                 }
             }
         }
 
+        // math operations
+        void Math(Variables::Operand &operation, Variables::Operand &first, Variables::Operand &second, bool clamp = true)
+        {
+            this->Math(operation.Operation, first, second, clamp);
+        }
+
+        // math operations
+        void Math(std::string operation, std::string first, std::string second, bool clamp = true)
+        {
+            auto operand_first = Variables::Operand(first);
+
+            auto operand_second = Variables::Operand(second);
+
+            this->Math(Variables::MapOperator(operation), operand_first, operand_second, clamp);
+        }
+
         // logical operations (on non-numeric)
-        bool Is(std::string operation, std::string first, std::string second)
+        bool Is(Variables::Operator operation, Variables::Operand &first, Variables::Operand &second)
         {
             auto result = false;
 
             // (first) (logical operiation) (second)
-            if (!operation.empty() && !first.empty() && !second.empty())
+            if (!first.IsEmpty() && !second.IsEmpty() && (operation == Variables::Operator::EQUAL || operation == Variables::Operator::NOT_EQUAL))
             {
-                // check if operation is valid
-                if (this->IsValid({"=", "!=", "<>"}, operation))
-                {
-                    auto value_first = this->Get(first);
+                auto value_first = this->Get(first);
 
-                    auto value_second = this->Get(second);
+                auto value_second = this->Get(second);
 
-                    if (operation == "=")
-                    {
-                        result = (value_first == value_second);
-                    }
-                    else if (operation == "!=" || operation == "<>")
-                    {
-                        result = (value_first != value_second);
-                    }
+                result = (operation == Variables::Operator::EQUAL) ? (value_first == value_second) : (value_first != value_second);
 
-                    SDL_Log("[IF] %s %s %s IS %s", first.c_str(), operation.c_str(), second.c_str(), (result ? "TRUE" : "FALSE"));
-                }
+                SDL_Log("[IF] %s %s %s IS %s", first.Text.c_str(), Variables::OperatorMapping[operation].c_str(), second.Text.c_str(), (result ? "TRUE" : "FALSE"));
             }
 
             return result;
         }
 
+        // logical operations (on non-numeric)
+        bool Is(std::string operation, std::string first, std::string second)
+        {
+            auto operand_first = Variables::Operand(first);
+
+            auto operand_second = Variables::Operand(second);
+
+            return this->Is(Variables::MapOperator(operation), operand_first, operand_second);
+        }
+
         // logical operations
-        bool If(std::string operation, std::string first, std::string second)
+        bool If(Variables::Operator operation, Variables::Operand &first, Variables::Operand &second)
         {
             auto result = false;
 
             // (first) (logical operiation) (second)
-            if (!operation.empty() && !first.empty() && !second.empty())
+            if (Variables::IsLogical(operation) && !first.IsEmpty() && !second.IsEmpty())
             {
-                // check if operation is valid
-                if (this->IsValid({"=", "!=", "<>", "<", ">", "<=", ">="}, operation))
-                {
-                    // check if both are numbers and/or resolve to numbers
-                    if ((!this->IsANumber(this->Get(first)) && !this->IsANumber(first)) || (!this->IsANumber(this->Get(second)) && !this->IsANumber(second)))
-                    {
-                        return this->Is(operation, first, second);
-                    }
-
-                    auto value_first = this->Number(first);
+                auto value_first = 0;
 
-                    auto value_second = this->Number(second);
+                auto value_second = 0;
 
-                    if (operation == "=")
-                    {
-                        result = (value_first == value_second);
-                    }
-                    else if (operation == "!=" || operation == "<>")
-                    {
-                        result = (value_first != value_second);
-                    }
-                    else if (operation == "<")
-                    {
-                        result = (value_first < value_second);
-                    }
-                    else if (operation == "<=")
-                    {
-                        result = (value_first <= value_second);
-                    }
-                    else if (operation == ">")
-                    {
-                        result = (value_first > value_second);
-                    }
-                    else if (operation == ">=")
-                    {
-                        result = (value_first > value_second);
-                    }
+                // check if both are numbers and/or resolve to numbers
+                if (!this->Resolve(first, value_first) || !this->Resolve(second, value_second))
+                {
+                    return this->Is(operation, first, second);
+                }
 
-                    SDL_Log("[IF] %s %s %s IS %s", first.c_str(), operation.c_str(), second.c_str(), (result ? "TRUE" : "FALSE"));
+                switch (operation)
+                {
+                case Variables::Operator::EQUAL:
+                    result = (value_first == value_second);
+                    break;
+                case Variables::Operator::NOT_EQUAL:
+                    result = (value_first != value_second);
+                    break;
+                case Variables::Operator::LESS:
+                    result = (value_first < value_second);
+                    break;
+                case Variables::Operator::LESS_EQUAL:
+                    result = (value_first <= value_second);
+                    break;
+                case Variables::Operator::GREATER:
+                    result = (value_first > value_second);
+                    break;
+                case Variables::Operator::GREATER_EQUAL:
+                    result = (value_first >= value_second);
+                    break;
+                default:
+                    break;
                 }
+
+                SDL_Log("[IF] %s %s %s IS %s", first.Text.c_str(), Variables::OperatorMapping[operation].c_str(), second.Text.c_str(), (result ? "TRUE" : "FALSE"));
             }
 
             return result;
         }
 
+        // logical operations
+        bool If(Variables::Operand &operation, Variables::Operand &first, Variables::Operand &second)
+        {
+            return this->If(operation.Operation, first, second);
+        }
+
+        // logical operations
+        bool If(std::string operation, std::string first, std::string second)
+        {
+            auto operand_first = Variables::Operand(first);
+
+            auto operand_second = Variables::Operand(second);
+
+            return this->If(Variables::MapOperator(operation), operand_first, operand_second);
+        }
+
         // erase variable
         void Remove(std::string variable)
         {
-            if (this->IsPresent(variable))
+            auto operand = Variables::Operand(variable);
+
+            if (this->IsPresent(operand))
             {
-                this->Variables.erase(variable);
+                this->Variables.Remove(operand.Id);
 
-                if (!this->IsPresent(variable))
-                {
-                    SDL_Log("[VARIABLE %s] REMOVED", variable.c_str());
-                }
+                SDL_Log("[VARIABLE %s] REMOVED", variable.c_str());
             }
         }
     };
@@ -938,13 +988,16 @@ namespace BloodSword::Party
             data["cards"] = Items::HandData(party.Cards);
         }
 
-        if (SafeCast(party.Variables.size()) > 0)
+        if (party.Variables.Count() > 0)
         {
             nlohmann::json variables;
 
-            for (auto &variable : party.Variables)
+            for (auto variable = 0; variable < party.Variables.Size(); variable++)
             {
-                variables.emplace(variable.first, variable.second);
+                if (party.Variables.Has(variable))
+                {
+                    variables.emplace(Variables::Name(variable), party.Variables[variable].Text);
+                }
             }
 
             data["variables"] = variables;
@@ -1017,15 +1070,15 @@ namespace BloodSword::Party
         }
         else
         {
-            auto ifs = ZipFile::Read(zip_file, filename);
+            auto ifs = ZipFile::Open(zip_file, filename);
 
-            if (!ifs.empty())
+            if (!ifs.IsEmpty())
             {
-                auto data = nlohmann::json::parse(ifs);
+                auto data = nlohmann::json::parse(ifs.View());
 
                 party = Party::Initialize(data[std::string(name)]);
 
-                ifs.clear();
+                ifs.Clear();
 
                 SDL_Log("[LOADED] %d characters", party.Count());
             }
@@ -18,12 +18,12 @@ namespace BloodSword::Position
     };
 
     // mapping of position types to strings
-    BloodSword::ConstStrings<Position::Type> TypeMapping = {
+    constexpr auto TypeMapping = BloodSword::Tabulate<Position::Type>({
         {Position::Type::NONE, "NONE"},
         {Position::Type::TOP, "TOP"},
         {Position::Type::LEFT, "LEFT"},
         {Position::Type::RIGHT, "RIGHT"},
-        {Position::Type::BOTTOM, "BOTTOM"}};
+        {Position::Type::BOTTOM, "BOTTOM"}});
 
     // map string to position type
     Position::Type Map(const char *position)
@@ -7,9 +7,17 @@
 #undef max
 #endif
 
+#include <atomic>
+#include <cstdlib>
+#include <exception>
 #include <fstream>
+#include <functional>
 #include <iomanip>
 #include <iostream>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <unordered_set>
 #include <vector>
 
 #ifndef SDL_MAIN_HANDLED
@@ -22,6 +30,7 @@
 #include <SDL_mouse.h>
 #include <SDL_ttf.h>
 
+#include "Metrics.hpp"
 #include "Version.hpp"
 #include "ZipFileLibrary.hpp"
 
@@ -243,14 +252,13 @@ namespace BloodSword
     // load an image in a zip file as an SDL surface
     SDL_Surface *Surface(const char *image, const char *zip_file)
     {
-        // read file from zip archive
-        auto asset = ZipFile::Read(zip_file, image);
+        // get file from zip archive (no copy if stored)
+        auto asset = ZipFile::Open(zip_file, image);
 
-        // create a modifiable buffer
-        auto buffer = asset.data();
+        auto buffer = asset.View();
 
         // create surface from memory buffer
-        auto rw = SDL_RWFromMem((void *)buffer, SafeCast(asset.size()));
+        auto rw = SDL_RWFromConstMem(buffer.data(), SafeCast(buffer.size()));
 
         if (!rw)
         {
@@ -260,7 +268,7 @@ namespace BloodSword
         // create surface and close SDL_RWops
         auto surface = IMG_Load_RW(rw, 1);
 
-        asset.clear();
+        asset.Clear();
 
         return surface;
     }
@@ -268,14 +276,13 @@ namespace BloodSword
     // load an image in a zip file as an SDL texture
     SDL_Texture *Texture(SDL_Renderer *renderer, const char *image, const char *zip_file)
     {
-        // read file from zip archive
-        auto asset = ZipFile::Read(zip_file, image);
+        // get file from zip archive (no copy if stored)
+        auto asset = ZipFile::Open(zip_file, image);
 
-        // create a modifiable buffer
-        auto buffer = asset.data();
+        auto buffer = asset.View();
 
         // create surface from memory buffer
-        auto rw = SDL_RWFromMem((void *)buffer, SafeCast(asset.size()));
+        auto rw = SDL_RWFromConstMem(buffer.data(), SafeCast(buffer.size()));
 
         if (!rw)
         {
@@ -285,7 +292,7 @@ namespace BloodSword
         // create surface and close SDL_RWops
         auto texture = IMG_LoadTexture_RW(renderer, rw, 1);
 
-        asset.clear();
+        asset.Clear();
 
         return texture;
     }
@@ -301,11 +308,50 @@ namespace BloodSword
         }
     }
 
+    // textures drawn in retained compositions (see Graphics::Compose)
+    std::unordered_set<SDL_Texture *> RetainedTextures = {};
+
+    // textures drawn in retained compositions that were destroyed or changed since (their areas are drawn again)
+    std::unordered_set<SDL_Texture *> ChangedTextures = {};
+
+    // record that a texture is about to be destroyed or its contents changed
+    void Touch(SDL_Texture *texture)
+    {
+        if (BloodSword::RetainedTextures.count(texture) > 0)
+        {
+            BloodSword::ChangedTextures.insert(texture);
+        }
+    }
+
+    // create texture from surface (see Metrics)
+    SDL_Texture *CreateTexture(SDL_Renderer *renderer, SDL_Surface *surface)
+    {
+        auto texture = SDL_CreateTextureFromSurface(renderer, surface);
+
+        Metrics::Created(texture);
+
+        return texture;
+    }
+
+    // create blank texture (see Metrics)
+    SDL_Texture *CreateTexture(SDL_Renderer *renderer, Uint32 format, int access, int w, int h)
+    {
+        auto texture = SDL_CreateTexture(renderer, format, access, w, h);
+
+        Metrics::Created(texture);
+
+        return texture;
+    }
+
     // free texture
     void Free(SDL_Texture **texture)
     {
         if (*texture != nullptr)
         {
+            Metrics::Destroyed(*texture);
+
+            BloodSword::Touch(*texture);
+
             SDL_DestroyTexture(*texture);
 
             *texture = nullptr;
@@ -435,6 +481,186 @@ namespace BloodSword
 
         return file_content;
     }
+
+    // number of worker threads to use for background work
+    int Workers()
+    {
+        return std::max(1, SDL_GetCPUCount() - 1);
+    }
+
+    // run task(i) for i = 0 ... count - 1 on worker threads, returns when all are done
+    void Parallel(int count, std::function<void(int)> task)
+    {
+        auto workers = std::min(count, BloodSword::Workers());
+
+        if (workers <= 1)
+        {
+            for (auto i = 0; i < count; i++)
+            {
+                task(i);
+            }
+        }
+        else
+        {
+            std::atomic<int> next(0);
+
+            // first exception thrown by a task (re-thrown on the calling thread)
+            std::exception_ptr error = nullptr;
+
+            std::mutex error_lock;
+
+            auto threads = std::vector<std::thread>();
+
+            for (auto worker = 0; worker < workers; worker++)
+            {
+                threads.emplace_back([&]()
+                                     {
+                                         for (auto i = next++; i < count; i = next++)
+                                         {
+                                             try
+                                             {
+                                                 task(i);
+                                             }
+                                             catch (...)
+                                             {
+                                                 std::lock_guard<std::mutex> guard(error_lock);
+
+                                                 if (!error)
+                                                 {
+                                                     error = std::current_exception();
+                                                 }
+
+                                                 // stop handing out tasks
+                                                 next = count;
+                                             }
+                                         } });
+            }
+
+            for (auto &thread : threads)
+            {
+                thread.join();
+            }
+
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+
+    // measure elapsed time (milliseconds)
+    class Stopwatch
+    {
+    public:
+        Uint64 Start = 0;
+
+        Stopwatch()
+        {
+            this->Reset();
+        }
+
+        // restart stopwatch
+        void Reset()
+        {
+            this->Start = SDL_GetPerformanceCounter();
+        }
+
+        // elapsed time since last reset
+        double Elapsed()
+        {
+            return double(SDL_GetPerformanceCounter() - this->Start) * 1000.0 / double(SDL_GetPerformanceFrequency());
+        }
+
+        // log elapsed time for a phase and restart
+        void Log(const char *phase)
+        {
+            SDL_Log("[TIMING] %s: %.2f ms", phase, this->Elapsed());
+
+            this->Reset();
+        }
+    };
+
+    // number of heap allocations so far (only counted in debug builds)
+    std::atomic<Uint64> Allocations(0);
+
+    // count heap allocations made during a phase (debug builds only)
+    class AllocationCounter
+    {
+    public:
+        Uint64 Start = 0;
+
+        AllocationCounter()
+        {
+            this->Reset();
+        }
+
+        // restart counter
+        void Reset()
+        {
+            this->Start = BloodSword::Allocations.load();
+        }
+
+        // allocations since last reset
+        Uint64 Count()
+        {
+            return BloodSword::Allocations.load() - this->Start;
+        }
+
+        // log allocations made during a phase (if any) and restart
+        void Log(const char *phase)
+        {
+            auto count = this->Count();
+
+            if (count > 0)
+            {
+                SDL_Log("[ALLOCATIONS] %s: %llu", phase, (unsigned long long)count);
+            }
+
+            this->Reset();
+        }
+    };
+}
+
+#if defined(DEBUG) || defined(_DEBUG)
+// count heap allocations (see BloodSword::AllocationCounter)
+void *operator new(std::size_t size)
+{
+    BloodSword::Allocations++;
+
+    auto pointer = std::malloc(size > 0 ? size : 1);
+
+    if (!pointer)
+    {
+        throw std::bad_alloc();
+    }
+
+    return pointer;
+}
+
+void *operator new[](std::size_t size)
+{
+    return ::operator new(size);
 }
 
+void operator delete(void *pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete[](void *pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void *pointer, std::size_t) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete[](void *pointer, std::size_t) noexcept
+{
+    std::free(pointer);
+}
+#endif
+
 #endif
@@ -0,0 +1,410 @@
+#include <functional>
+
+#include "InterfaceBattle.hpp"
+#include "Rogue.hpp"
+#include "System.hpp"
+
+// time the composition of representative screens (headless: frames are drawn offscreen by the software renderer)
+namespace BloodSword::RenderBenchmark
+{
+    // builds the scenes of a screen (called every frame)
+    typedef std::function<Graphics::Scenery()> Screen;
+
+    // text shown on the story screens
+    const char *StoryText = "Every thirteen lunar months the Magi of Krarth hold a desperate contest to see which of them will rule that bleak and icy land. Teams of daring adventurers are sent down into the labyrinths that lie beneath the tundra, each searching for the Emblem of Victory that will win power for their patron.\n\nOnly one team can prevail. The others must die.\n\nYou stand at the threshold of the Battlepits. Behind you, the iron gates grind shut. Ahead, a torchlit passage descends into darkness, and from somewhere far below comes the clash of steel and the screams of those who went before you.";
+
+    // measure one screen: build, compose and present its scenes (redraw: discard the retained composition every frame)
+    void Measure(Graphics::Base &graphics, const char *name, RenderBenchmark::Screen build, bool blur, int frames, bool redraw, const char *directory)
+    {
+        auto total = Metrics::Frame();
+
+        auto slowest = 0.0;
+
+        for (auto frame = 0; frame < frames; frame++)
+        {
+            if (redraw)
+            {
+                Graphics::TargetsReset = true;
+            }
+
+            Metrics::Current = Metrics::Frame();
+
+            auto start = Metrics::Now();
+
+            auto scenes = build();
+
+            auto build_time = Metrics::Since(start);
+
+            start = Metrics::Now();
+
+            Graphics::Compose(graphics, scenes, blur);
+
+            // draw queued render commands now so they are counted in the composition
+            SDL_RenderFlush(graphics.Renderer);
+
+            auto render_time = Metrics::Since(start);
+
+            // counts are reset once the frame is presented
+            auto counts = Metrics::Current;
+
+            start = Metrics::Now();
+
+            Graphics::RenderNow(graphics);
+
+            auto present_time = Metrics::Since(start);
+
+            counts.Build = build_time;
+
+            counts.Render = render_time;
+
+            counts.Present = present_time;
+
+            total.Add(counts);
+
+            slowest = std::max(slowest, build_time + render_time + present_time);
+
+            if (frame == 0 && directory && !redraw)
+            {
+                auto image_file = std::string(directory) + "/" + Engine::ToLower(std::string(name)) + ".png";
+
+                Graphics::Snapshot(graphics, image_file.c_str());
+            }
+        }
+
+        if (frames > 0)
+        {
+            auto count = double(frames);
+
+            SDL_Log("[BENCHMARK] %s (%s) %d FRAMES BUILD: %.3f ms RENDER: %.3f ms PRESENT: %.3f ms SLOWEST: %.3f ms DRAW CALLS: %.1f TEXTURE SWITCHES: %.1f TEXT: %.1f",
+                    name,
+                    redraw ? "FULL" : "RETAINED",
+                    frames,
+                    total.Build / count,
+                    total.Render / count,
+                    total.Present / count,
+                    slowest,
+                    double(total.DrawCalls) / count,
+                    double(total.Switches) / count,
+                    double(total.Rasterized) / count);
+        }
+    }
+
+    // measure one screen when every frame is redrawn in full and when the composition is retained
+    void Measure(Graphics::Base &graphics, const char *name, RenderBenchmark::Screen build, bool blur, int frames, const char *directory)
+    {
+        RenderBenchmark::Measure(graphics, name, build, blur, frames, true, directory);
+
+        RenderBenchmark::Measure(graphics, name, build, blur, frames, false, directory);
+    }
+
+    // party of all character classes
+    Party::Base Adventurers(int rank)
+    {
+        auto party = Party::Base();
+
+        for (auto &character_class : Character::All)
+        {
+            auto character = Generate::Character(character_class, rank);
+
+            party.Add(character);
+        }
+
+        return party;
+    }
+
+    // rogue mode: battlepits, party stats and map panel
+    void RogueScreen(Graphics::Base &graphics, int frames, const char *directory)
+    {
+        Rogue::TextCache.Create(graphics, Fonts::Normal, "0123456789(),", Color::S(Color::Active), TTF_STYLE_NORMAL);
+
+        auto rogue = Rogue::GenerateBattlepits(100, 100, 100, 2, 3);
+
+        rogue.Party = RenderBenchmark::Adventurers(8);
+
+        if (SafeCast(rogue.Rooms.size()) > 0 && rogue.Count() > 0)
+        {
+            Rogue::PlaceMonsters(rogue, SafeCast(rogue.Rooms.size()) / 2);
+
+            Rogue::PlaceBoss(rogue);
+
+            Rogue::PlaceLoot(rogue, SafeCast(rogue.Rooms.size()) / 4, 10, 50);
+
+            auto center = rogue.Rooms[0].Center();
+
+            rogue.Party.X = center.X;
+
+            rogue.Party.Y = center.Y;
+
+            // same layout as the rogue mode game loop
+            auto method = FieldOfView::Map(Engine::ToUpper(Interface::Settings["fov"]));
+
+            auto panel_w = (graphics.Width - BloodSword::TripleTile) / 2;
+
+            auto panel_h = (graphics.Height - BloodSword::DoubleTile);
+
+            rogue.Battlepits.ViewX = panel_w / rogue.Battlepits.TileSize;
+
+            rogue.Battlepits.ViewY = panel_h / rogue.Battlepits.TileSize;
+
+            rogue.Battlepits.DrawX = (BloodSword::DoubleTile + panel_w + (panel_w - rogue.Battlepits.ViewX * rogue.Battlepits.TileSize) / 2);
+
+            rogue.Battlepits.DrawY = (BloodSword::TileSize + (panel_h - rogue.Battlepits.ViewY * rogue.Battlepits.TileSize) / 2);
+
+            auto image = Interface::GeneratePartyStats(graphics, rogue.Party, panel_w - BloodSword::LargePad);
+
+            auto image_location = Point(BloodSword::TileSize + BloodSword::Pad, BloodSword::TileSize + BloodSword::Pad);
+
+            auto scene = Scene::Base();
+
+            auto build = [&]() -> Graphics::Scenery
+            {
+                Rogue::UpdateScene(scene, rogue, image, image_location, panel_w, panel_h, method, false);
+
+                return {scene};
+            };
+
+            RenderBenchmark::Measure(graphics, "ROGUE", build, false, frames, directory);
+
+            BloodSword::Free(&image);
+        }
+
+        Rogue::TextCache.Free();
+    }
+
+    // battle map with the party and opponents in their starting locations
+    void BattleScreen(Graphics::Base &graphics, const char *battle_file, int frames, const char *directory)
+    {
+        auto battle = Interface::Zipped ? Battle::Load(battle_file, Interface::ZipFile.c_str()) : Battle::Load(battle_file);
+
+        if (!battle.IsDefined())
+        {
+            SDL_LogCritical(SDL_LOG_CATEGORY_APPLICATION, "Unable to load battle [%s]", battle_file);
+
+            return;
+        }
+
+        auto party = RenderBenchmark::Adventurers(2);
+
+        // same layout and placement as the battle interface
+        auto total_w = graphics.Width - 12 * BloodSword::TileSize;
+
+        auto total_h = graphics.Height - 6 * BloodSword::TileSize;
+
+        battle.Map.ViewX = std::min(battle.Map.ViewX, (total_w / BloodSword::TileSize));
+
+        battle.Map.ViewY = std::min(battle.Map.ViewY, (total_h / BloodSword::TileSize));
+
+        battle.Map.DrawX = (graphics.Width - battle.Map.ViewX * battle.Map.TileSize) / 2;
+
+        battle.Map.DrawY = (graphics.Height - battle.Map.ViewY * battle.Map.TileSize) / 2;
+
+        battle.Map.X = 0;
+
+        battle.Map.Y = 0;
+
+        Interface::CloneCharacters(battle, party);
+
+        Interface::SetPlayerLocations(battle, party);
+
+        if (battle.Has(Battle::Condition::REPLICATE) && battle.Opponents.Count() == 1)
+        {
+            auto replicated = battle.Opponents[0];
+
+            for (auto i = 0; i < Engine::Combatants(party) - 1; i++)
+            {
+                battle.Opponents.Add(replicated);
+            }
+        }
+
+        Interface::SetEnemyLocations(battle, party);
+
+        Interface::FinalLocationChecks(battle, party);
+
+        // no extra assets or controls (as in Interface::BattleScene(battle, party))
+        auto assets = Scene::Elements();
+
+        auto controls = Controls::Collection();
+
+        auto location = Point(battle.Map.DrawX, battle.Map.DrawY + BloodSword::TileSize + BloodSword::Pad);
+
+        auto scene = Scene::Base();
+
+        auto build = [&]() -> Graphics::Scenery
+        {
+            // re-use the scene's memory, as the battle interface does
+            Interface::BattleScene(scene, battle, party, assets, controls, location);
+
+            return {scene};
+        };
+
+        RenderBenchmark::Measure(graphics, "BATTLE", build, false, frames, directory);
+    }
+
+    // story section (party stats and text panels), alone and under a pop-up message
+    void StoryScreens(Graphics::Base &graphics, int frames, const char *directory)
+    {
+        auto party = RenderBenchmark::Adventurers(2);
+
+        // same layout as the story interface
+        auto space = BloodSword::TripleTile + BloodSword::HugePad;
+
+        auto panel_w = (graphics.Width - BloodSword::DoubleTile - space) / 2;
+
+        auto panel_h = (graphics.Height - space);
+
+        auto text_w = panel_w - BloodSword::LargePad;
+
+        auto text_h = panel_h - BloodSword::LargePad;
+
+        auto origin = Point((graphics.Width - (panel_w * 2 + BloodSword::TileSize + BloodSword::LargePad)) / 2, BloodSword::TileSize + BloodSword::LargePad);
+
+        auto origin_text = origin + Point(panel_w + BloodSword::TileSize + BloodSword::TriplePad, BloodSword::Pad);
+
+        auto view = Graphics::TextView(Fonts::Normal, std::string(RenderBenchmark::StoryText), Color::S(Color::Active), TTF_STYLE_NORMAL, text_w);
+
+        auto image = Interface::GeneratePartyStats(graphics, party, panel_w - BloodSword::LargePad);
+
+        auto image_location = origin + Point(BloodSword::Pad, BloodSword::Pad);
+
+        auto overlay = Scene::Base();
+
+        auto story = [&]()
+        {
+            overlay.Reset();
+
+            overlay.Add(Scene::Element(origin.X, origin.Y, panel_w, panel_h, Color::Background, Color::Active, BloodSword::Border));
+
+            if (image)
+            {
+                overlay.VerifyAndAdd(Scene::Element(image, image_location));
+            }
+
+            overlay.Add(Scene::Element(origin.X + panel_w + BloodSword::TileSize + BloodSword::LargePad, origin.Y, panel_w, panel_h, Color::Background, Color::Active, BloodSword::Border));
+
+            view.Add(graphics, overlay, origin_text.X, origin_text.Y, text_h, 0);
+        };
+
+        auto build = [&]() -> Graphics::Scenery
+        {
+            story();
+
+            return {overlay};
+        };
+
+        RenderBenchmark::Measure(graphics, "STORY", build, false, frames, directory);
+
+        auto message = Graphics::CreateText(graphics, "The gates of the Battlepits close behind you.", Fonts::Normal, Color::S(Color::Active), TTF_STYLE_NORMAL, 0);
+
+        auto dialog = Interface::Boxed(graphics, message, Color::Background, Color::Active, BloodSword::Border);
+
+        auto build_dialog = [&]() -> Graphics::Scenery
+        {
+            story();
+
+            return {overlay, dialog};
+        };
+
+        RenderBenchmark::Measure(graphics, "DIALOG", build_dialog, true, frames, directory);
+
+        BloodSword::Free(&message);
+
+        BloodSword::Free(&image);
+
+        view.Free();
+    }
+
+    // show command line arguments
+    void Usage(const char *program)
+    {
+        std::cerr << "To run:" << std::endl
+                  << std::endl
+                  << program << " [module] [battle.json] [frames] [width (optional)] [height (optional)] [snapshot directory (optional)]"
+                  << std::endl;
+    }
+
+    // main loop
+    int Main(const char *module, const char *battle_file, int frames, int width, int height, const char *directory)
+    {
+        auto return_code = 0;
+
+        auto system = BloodSword::System();
+
+        try
+        {
+            system.Headless(module, width, height);
+
+            if (!system.graphics.Renderer)
+            {
+                throw std::runtime_error("Offscreen renderer not available");
+            }
+
+            // measure composition only (no frame rate limit)
+            Graphics::Pacing(system.graphics, false, 0);
+
+            RenderBenchmark::RogueScreen(system.graphics, frames, directory);
+
+            RenderBenchmark::BattleScreen(system.graphics, battle_file, frames, directory);
+
+            RenderBenchmark::StoryScreens(system.graphics, frames, directory);
+        }
+        catch (std::exception &e)
+        {
+            SDL_LogCritical(SDL_LOG_CATEGORY_APPLICATION, "BLOODSWORD RENDER BENCHMARK (%s) EXCEPTION: %s", Version().c_str(), e.what());
+
+            return_code = 1;
+        }
+
+        system.Shutdown();
+
+        return return_code;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 4)
+    {
+        BloodSword::RenderBenchmark::Usage(argv[0]);
+
+        return 1;
+    }
+
+    auto frames = 0;
+
+    auto width = 1280;
+
+    auto height = 800;
+
+    try
+    {
+        frames = std::stoi(argv[3], nullptr, 10);
+
+        if (argc > 4)
+        {
+            width = std::stoi(argv[4], nullptr, 10);
+        }
+
+        if (argc > 5)
+        {
+            height = std::stoi(argv[5], nullptr, 10);
+        }
+
+        if (frames <= 0 || width <= 0 || height <= 0)
+        {
+            throw std::out_of_range("frames, width and height must be positive");
+        }
+    }
+    catch (std::exception &e)
+    {
+        std::cerr << "Invalid number: " << e.what() << std::endl
+                  << std::endl;
+
+        BloodSword::RenderBenchmark::Usage(argv[0]);
+
+        return 1;
+    }
+
+    const char *directory = argc > 6 ? argv[6] : nullptr;
+
+    return BloodSword::RenderBenchmark::Main(argv[1], argv[2], frames, width, height, directory);
+}
@@ -513,10 +513,10 @@ namespace BloodSword::Rogue
     // create text cache
     FontCache::Base TextCache = FontCache::Base();
 
-    // update scene for rogue mode
-    Scene::Base UpdateScene(Rogue::Base &rogue, SDL_Texture *image, Point image_location, int panel_w, int panel_h, FieldOfView::Method method, bool animating)
+    // update scene for rogue mode (re-uses the scene's memory)
+    void UpdateScene(Scene::Base &scene, Rogue::Base &rogue, SDL_Texture *image, Point image_location, int panel_w, int panel_h, FieldOfView::Method method, bool animating)
     {
-        auto scene = Scene::Base();
+        scene.Reset();
 
         // left panel border
         scene.Add(Scene::Element(BloodSword::TileSize, BloodSword::TileSize, panel_w, panel_h, Color::Background, Color::Active, BloodSword::Border));
@@ -545,8 +545,6 @@ namespace BloodSword::Rogue
         auto coordinates = "(" + std::to_string(origin.X) + "," + std::to_string(origin.Y) + ")";
 
         Interface::AddText(scene, Rogue::TextCache, coordinates, bottom_x, BloodSword::TileSize + panel_h + BloodSword::Pad);
-
-        return scene;
     }
 
     // show explored areas of the map
@@ -606,7 +604,7 @@ namespace BloodSword::Rogue
                 }
             }
 
-            auto texture = SDL_CreateTextureFromSurface(graphics.Renderer, surface);
+            auto texture = BloodSword::CreateTexture(graphics.Renderer, surface);
 
             if (texture)
             {
@@ -1183,7 +1181,15 @@ namespace BloodSword::Rogue
 
             if (update.Scene || animating)
             {
-                scene = Rogue::UpdateScene(rogue, image, image_location, panel_w, panel_h, method, animating);
+#if defined(DEBUG) || defined(_DEBUG)
+                auto allocations = BloodSword::AllocationCounter();
+
+                Rogue::UpdateScene(scene, rogue, image, image_location, panel_w, panel_h, method, animating);
+
+                allocations.Log("SCENE");
+#else
+                Rogue::UpdateScene(scene, rogue, image, image_location, panel_w, panel_h, method, animating);
+#endif
 
                 update.Scene = false;
             }
@@ -1250,7 +1256,7 @@ namespace BloodSword::Rogue
                         else
                         {
                             // update scene
-                            Rogue::UpdateScene(rogue, image, image_location, panel_w, panel_h, method, true);
+                            Rogue::UpdateScene(scene, rogue, image, image_location, panel_w, panel_h, method, true);
 
                             // flash a message
                             Interface::FlashMessage(graphics, scene, "PARTY ATTACKED!", Color::Background, Color::Highlight, BloodSword::Border, BloodSword::OneSecond);
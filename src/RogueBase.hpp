@@ -104,7 +104,7 @@ namespace BloodSword::Rogue
     // generate texture of character stats
     SDL_Texture *Stats(Graphics::Base &graphics, Character::Base &character, int w)
     {
-        auto surface_labels = TTF_RenderUTF8_Blended_Wrapped(Fonts::Normal, Rogue::StatsLabels().c_str(), Color::S(Color::Active), 0);
+        auto surface_labels = Graphics::CreateSurfaceLines(Rogue::StatsLabels().c_str(), Fonts::Normal, Color::S(Color::Active));
 
         // texture
         SDL_Texture *texture = nullptr;
@@ -142,7 +142,7 @@ namespace BloodSword::Rogue
                 auto stats = stats_1 + stats_2 + stats_3;
 
                 // create and convert SDL surface to appropriate format
-                auto surface_stats = TTF_RenderUTF8_Blended_Wrapped(Fonts::Normal, stats.c_str(), Color::S(Color::Highlight), 0);
+                auto surface_stats = Graphics::CreateSurfaceLines(stats.c_str(), Fonts::Normal, Color::S(Color::Highlight));
 
                 SDL_Rect stats_rect;
 
@@ -228,7 +228,7 @@ namespace BloodSword::Rogue
 
                 BloodSword::Free(&surface_asset);
 
-                texture = SDL_CreateTextureFromSurface(graphics.Renderer, surface);
+                texture = BloodSword::CreateTexture(graphics.Renderer, surface);
 
                 BloodSword::Free(&surface);
             }
@@ -46,6 +46,9 @@ namespace BloodSword::Scene
         // thickness of the border in pixels
         int BorderSize = 0;
 
+        // portion of the texture to be rendered (Bounds and Offset are used if empty)
+        SDL_Rect Source = {0, 0, 0, 0};
+
         Element(SDL_Texture *texture,
                 int x, int y,
                 int bounds, int offset,
@@ -117,6 +120,11 @@ namespace BloodSword::Scene
 
         Element(SDL_Texture *texture, Point point) : Element(texture, point.X, point.Y) {}
 
+        // render a portion of the texture (e.g. a frame in a sprite sheet)
+        Element(SDL_Texture *texture, SDL_Rect source, int x, int y) : Texture(texture), X(x), Y(y), Bounds(source.h), Offset(0), W(source.w), H(source.h), Source(source) {}
+
+        Element(SDL_Texture *texture, SDL_Rect source, Point point) : Element(texture, source, point.X, point.Y) {}
+
         Element(int x, int y, int w, int h,
                 Uint32 background,
                 Uint32 border,
@@ -165,6 +173,18 @@ namespace BloodSword::Scene
             this->Controls.clear();
         }
 
+        // empty the scene so it can be filled again (allocated memory is kept)
+        void Reset()
+        {
+            this->Clear();
+
+            this->Clip = Point(-1, -1);
+
+            this->ClipW = 0;
+
+            this->ClipH = 0;
+        }
+
         // add element to the scene
         void Add(Scene::Element element)
         {
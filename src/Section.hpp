@@ -1,6 +1,10 @@
 #ifndef __SECTION_HPP__
 #define __SECTION_HPP__
 
+#include <algorithm>
+#include <iterator>
+#include <list>
+
 #include "nlohmann/json.hpp"
 #include "Book.hpp"
 #include "Choice.hpp"
@@ -235,15 +239,15 @@ namespace BloodSword::Section
     {
         auto section = Section::Base();
 
-        auto ifs = ZipFile::Read(zip_file, filename);
+        auto ifs = ZipFile::Open(zip_file, filename);
 
-        if (!ifs.empty())
+        if (!ifs.IsEmpty())
         {
-            auto data = nlohmann::json::parse(ifs);
+            auto data = nlohmann::json::parse(ifs.View());
 
-            Section::GenerateSection(data, zip_file);
+            section = Section::GenerateSection(data, zip_file);
 
-            ifs.clear();
+            ifs.Clear();
         }
 
         return section;
@@ -269,35 +273,272 @@ namespace BloodSword::Story
         // sections in the story
         Story::Sections Sections = Story::Sections();
 
+        // index of sections (book location key to index)
+        BloodSword::UnorderedMap<long long, int> Index = {};
+
+        // section files (only for sections loaded on demand)
+        std::vector<std::string> Files = {};
+
+        // zip archive containing the section files (if any)
+        std::string Archive = std::string();
+
+        // on-demand sections currently parsed
+        std::vector<bool> Loaded = {};
+
+        // on-demand sections parsed at least once
+        std::vector<bool> Visited = {};
+
+        // on-demand sections in memory (most recently used first)
+        std::list<int> Recent = {};
+
+        // maximum number of on-demand sections kept in memory
+        int CacheSize = 64;
+
+        // section being played (never evicted, callers hold references to it)
+        int Pinned = -1;
+
         Base() {}
 
+        // rebuild section index (first section with a given location wins)
+        void Reindex()
+        {
+            this->Index.clear();
+
+            this->Index.reserve(this->Sections.size());
+
+            for (auto i = 0; i < SafeCast(this->Sections.size()); i++)
+            {
+                this->Index.emplace(Book::Key(this->Sections[i].Location), i);
+            }
+
+            this->Files.resize(this->Sections.size());
+
+            this->Loaded.assign(this->Sections.size(), false);
+
+            this->Visited.assign(this->Sections.size(), false);
+
+            this->Recent.clear();
+
+            this->Pinned = -1;
+        }
+
         // find section by book and section number
         int Find(Book::Location location)
         {
             auto section = -1;
 
-            for (auto i = 0; i < SafeCast(this->Sections.size()); i++)
+            auto search = this->Index.find(Book::Key(location));
+
+            if (search != this->Index.end())
             {
-                if (Book::Equal(location, this->Sections[i].Location))
+                section = search->second;
+            }
+
+            return section;
+        }
+
+        // check if section is loaded on demand
+        bool OnDemand(int section)
+        {
+            return (section >= 0 && section < SafeCast(this->Files.size()) && !this->Files[section].empty());
+        }
+
+        // mark on-demand section as the most recently used
+        void Touch(int section)
+        {
+            this->Recent.remove(section);
+
+            this->Recent.push_front(section);
+        }
+
+        // keep section in memory until another one is pinned
+        void Pin(int section)
+        {
+            this->Pinned = section;
+        }
+
+        // release least recently used sections beyond the cache size (except the pinned section)
+        void Evict()
+        {
+            while (SafeCast(this->Recent.size()) > std::max(1, this->CacheSize))
+            {
+                auto oldest = std::prev(this->Recent.end());
+
+                if (*oldest == this->Pinned)
                 {
-                    section = i;
+                    if (oldest == this->Recent.begin())
+                    {
+                        break;
+                    }
 
-                    break;
+                    oldest--;
                 }
+
+                auto section = *oldest;
+
+                this->Recent.erase(oldest);
+
+                // keep location (for searches) and items (dropped / taken during play)
+                auto stub = Section::Base();
+
+                stub.Location = this->Sections[section].Location;
+
+                stub.Items = this->Sections[section].Items;
+
+                this->Sections[section] = stub;
+
+                this->Loaded[section] = false;
             }
+        }
 
-            return section;
+        // parse on-demand section (if not yet in memory)
+        void Fetch(int section)
+        {
+            if (this->OnDemand(section))
+            {
+                if (!this->Loaded[section])
+                {
+                    auto &file = this->Files[section];
+
+                    auto loaded = this->Archive.empty() ? Section::Load(file.c_str()) : Section::Load(file.c_str(), this->Archive.c_str());
+
+                    // the index is authoritative for the location
+                    loaded.Location = this->Sections[section].Location;
+
+                    // items in the section may have changed since it was last parsed
+                    if (this->Visited[section])
+                    {
+                        loaded.Items = this->Sections[section].Items;
+                    }
+
+                    this->Sections[section] = loaded;
+
+                    this->Loaded[section] = true;
+
+                    this->Visited[section] = true;
+                }
+
+                this->Touch(section);
+
+                this->Evict();
+            }
+        }
+
+        // parse sections reachable from this section (choices and next conditions), returns the sections found
+        std::vector<int> Prefetch(int section)
+        {
+            auto reachable = std::vector<int>();
+
+            if (section >= 0 && section < SafeCast(this->Sections.size()))
+            {
+                if (this->OnDemand(section))
+                {
+                    this->Touch(section);
+                }
+
+                auto destinations = Book::Locations();
+
+                for (auto &choice : this->Sections[section].Choices)
+                {
+                    destinations.push_back(choice.Condition.Location);
+
+                    destinations.push_back(choice.Condition.Failure);
+                }
+
+                for (auto &condition : this->Sections[section].Next)
+                {
+                    destinations.push_back(condition.Location);
+
+                    destinations.push_back(condition.Failure);
+                }
+
+                // use at most half of the cache so the current section is not pushed out
+                auto limit = this->CacheSize / 2;
+
+                auto fetched = 0;
+
+                for (auto &destination : destinations)
+                {
+                    auto next = Book::IsDefined(destination) ? this->Find(destination) : -1;
+
+                    if (next != -1 && next != section && this->OnDemand(next) && !this->Loaded[next] && fetched < limit)
+                    {
+                        this->Fetch(next);
+
+                        fetched++;
+                    }
+
+                    if (next != -1 && next != section && (!this->OnDemand(next) || this->Loaded[next]) && std::find(reachable.begin(), reachable.end(), next) == reachable.end())
+                    {
+                        reachable.push_back(next);
+                    }
+                }
+            }
+
+            return reachable;
+        }
+
+        // get section (parse if needed)
+        Section::Base &operator[](int section)
+        {
+            this->Fetch(section);
+
+            return this->Sections[section];
+        }
+
+        // get section by book and section number (first section if not found)
+        Section::Base &Get(Book::Location location)
+        {
+            auto section = this->Find(location);
+
+            return (section >= 0 && section < SafeCast(this->Sections.size())) ? (*this)[section] : (*this)[0];
         }
     };
 
     // global "book" variable to save on passing by reference all the time
     Story::Base CurrentBook = Story::Base();
 
+    // load section from an entry in the story's section list (file is set for sections loaded on demand)
+    Section::Base LoadEntry(nlohmann::json &data, const char *zip_file, std::string &file)
+    {
+        auto section = Section::Base();
+
+        if (!data.is_null() && data.is_object() && !data["file"].is_null())
+        {
+            // section index entry: parse section only when visited
+            if (!data["location"].is_null())
+            {
+                section.Location = Book::Load(data["location"]);
+            }
+
+            file = std::string(data["file"]);
+        }
+        else if (!data.is_null() && data.is_object())
+        {
+            section = Section::GenerateSection(data);
+        }
+        else if (!data.is_null() && data.is_string())
+        {
+            if (zip_file != nullptr)
+            {
+                section = Section::Load(std::string(data).c_str(), zip_file);
+            }
+            else
+            {
+                section = Section::Load(std::string(data).c_str());
+            }
+        }
+
+        return section;
+    }
+
     // load data from json data (and zip file)
     void GenerateStory(nlohmann::json &data, const char *zip_file)
     {
         auto is_zip = (zip_file != nullptr);
 
+        auto timer = BloodSword::Stopwatch();
+
         // re-initalize
         Story::CurrentBook = Story::Base();
 
@@ -310,44 +551,56 @@ namespace BloodSword::Story
 
             book.Description = !data["description"].is_null() ? std::string(data["description"]) : "Blood Sword gamebook";
 
+            // number of on-demand sections kept in memory
+            if (!data["cache"].is_null() && data["cache"].is_number_integer())
+            {
+                book.CacheSize = std::max(1, int(data["cache"]));
+            }
+
             if (!data["sections"].is_null() && data["sections"].is_array() && SafeCast(data["sections"].size()) > 0)
             {
                 auto sections = Story::Sections();
 
-                for (auto i = 0; i < SafeCast(data["sections"].size()); i++)
-                {
-                    auto section = Section::Base();
+                auto files = std::vector<std::string>();
 
-                    if (!data["sections"][i].is_null() && data["sections"][i].is_object())
-                    {
-                        section = Section::GenerateSection(data["sections"][i]);
-                    }
-                    else if (!data["sections"][i].is_null() && data["sections"][i].is_string())
-                    {
-                        if (is_zip)
-                        {
-                            section = Section::Load(std::string(data["sections"][i]).c_str(), zip_file);
-                        }
-                        else
-                        {
-                            section = Section::Load(std::string(data["sections"][i]).c_str());
-                        }
-                    }
+                auto &entries = data["sections"];
+
+                auto count = SafeCast(entries.size());
 
-                    if (Book::IsDefined(section.Location))
+                auto parsed = Story::Sections(count);
+
+                auto parsed_files = std::vector<std::string>(count);
+
+                // section files are independent of each other, parse them on worker threads
+                BloodSword::Parallel(count, [&](int i)
+                                     { parsed[i] = Story::LoadEntry(entries[i], zip_file, parsed_files[i]); });
+
+                for (auto i = 0; i < count; i++)
+                {
+                    if (Book::IsDefined(parsed[i].Location))
                     {
-                        sections.push_back(section);
+                        sections.push_back(parsed[i]);
+
+                        files.push_back(parsed_files[i]);
                     }
                 }
 
                 if (SafeCast(sections.size()) > 0)
                 {
                     book.Sections = sections;
+
+                    book.Reindex();
+
+                    book.Files = files;
+
+                    book.Archive = is_zip ? std::string(zip_file) : std::string();
                 }
             }
         }
 
         SDL_Log("[LOADED] %d SECTIONS", SafeCast(book.Sections.size()));
+
+        timer.Log("STORY");
     }
 
     // load story from json data
@@ -386,15 +639,15 @@ namespace BloodSword::Story
         }
         else
         {
-            auto ifs = ZipFile::Read(zip_file, story);
+            auto ifs = ZipFile::Open(zip_file, story);
 
-            if (!ifs.empty())
+            if (!ifs.IsEmpty())
             {
-                auto data = nlohmann::json::parse(ifs);
+                auto data = nlohmann::json::parse(ifs.View());
 
                 Story::GenerateStory(data, zip_file);
 
-                ifs.clear();
+                ifs.Clear();
             }
         }
     }
@@ -460,15 +713,15 @@ namespace BloodSword::Story
         }
         else
         {
-            auto ifs = ZipFile::Read(zip_file, ranks);
+            auto ifs = ZipFile::Open(zip_file, ranks);
 
-            if (!ifs.empty())
+            if (!ifs.IsEmpty())
             {
-                auto data = nlohmann::json::parse(ifs);
+                auto data = nlohmann::json::parse(ifs.View());
 
                 result = Story::InitializeRanks(data);
 
-                ifs.clear();
+                ifs.Clear();
             }
         }
 
@@ -41,7 +41,7 @@ namespace BloodSword::Skills
     using Mapped = BloodSword::UnorderedMap<Skills::Type, T>;
 
     // skill type to string mapping
-    BloodSword::StringMap<Skills::Type> TypeMapping = {
+    constexpr auto TypeMapping = BloodSword::Tabulate<Skills::Type, std::string>({
         {Skills::Type::NONE, "NONE"},
         {Skills::Type::ARCHERY, "ARCHERY"},
         {Skills::Type::DODGING, "DODGING"},
@@ -65,7 +65,7 @@ namespace BloodSword::Skills
         {Skills::Type::BROKEN_WEAPON, "BROKEN WEAPON"},
         {Skills::Type::POISONED_BITE, "POISONED BITE"},
         {Skills::Type::RETRIBUTIVE_FIRE, "RETRIBUTIVE FIRE"},
-        {Skills::Type::FORGET_SPELL, "FORGET SPELL"}};
+        {Skills::Type::FORGET_SPELL, "FORGET SPELL"}});
 
     // list of skills
     typedef std::vector<Skills::Type> List;
@@ -105,7 +105,7 @@ namespace BloodSword::Skills
     Asset::Lookup<Skills::Type> Assets = {};
 
     // mapping of skills to asset names
-    BloodSword::ConstStrings<Skills::Type> AssetNames = {
+    constexpr auto AssetNames = BloodSword::Tabulate<Skills::Type>({
         {Skills::Type::NONE, "NONE"},
         {Skills::Type::ARCHERY, "ARCHERY"},
         {Skills::Type::DODGING, "DODGING"},
@@ -126,7 +126,7 @@ namespace BloodSword::Skills
         {Skills::Type::RUSTY_WEAPON, "RUSTY WEAPON"},
         {Skills::Type::BROKEN_WEAPON, "BROKEN WEAPON"},
         {Skills::Type::POISONED_BITE, "FANGS"},
-        {Skills::Type::RETRIBUTIVE_FIRE, "FIRE SHIELD"}};
+        {Skills::Type::RETRIBUTIVE_FIRE, "FIRE SHIELD"}});
 
     // map all skill types to asset ids
     void MapAssets()
@@ -32,7 +32,7 @@ namespace BloodSword::Sound
     };
 
     // mapping of sound types to strings
-    BloodSword::ConstStrings<Sound::Type> Mapping = {
+    constexpr auto Mapping = BloodSword::Tabulate<Sound::Type>({
         {Sound::Type::NONE, "NONE"},
         {Sound::Type::BUTTON_CLICK, "BUTTON CLICK"},
         {Sound::Type::DICE_ROLL, "DICE ROLL"},
@@ -42,7 +42,7 @@ namespace BloodSword::Sound
         {Sound::Type::COMBAT_DAMAGE, "COMBAT DAMAGE"},
         {Sound::Type::BOW_RELEASE, "BOW RELEASE"},
         {Sound::Type::WEAPON_THROW, "WEAPON THROW"},
-        {Sound::Type::CAST_SPELL, "CAST SPELL"}};
+        {Sound::Type::CAST_SPELL, "CAST SPELL"}});
 
     // loaded sound assets
     BloodSword::UnorderedMap<Sound::Type, Mix_Chunk *> Assets = {};
@@ -60,9 +60,9 @@ namespace BloodSword::Sound
     }
 
     // create surface from buffer
-    Mix_Chunk *Load(char *buffer, size_t size)
+    Mix_Chunk *Load(const char *buffer, size_t size)
     {
-        auto rw = SDL_RWFromMem((void *)buffer, SafeCast(size));
+        auto rw = SDL_RWFromConstMem(buffer, SafeCast(size));
 
         if (!rw)
         {
@@ -78,16 +78,15 @@ namespace BloodSword::Sound
     // load sound from a file in zip
     Mix_Chunk *Load(const char *zip_file, const char *path)
     {
-        // read file from zip archive
-        auto sound = ZipFile::Read(zip_file, path);
+        // get file from zip archive (no copy if stored)
+        auto sound = ZipFile::Open(zip_file, path);
 
-        // create a modifiable buffer
-        auto buffer = sound.data();
+        auto buffer = sound.View();
 
         // load chunk
-        auto chunk = Sound::Load(buffer, SafeCast(sound.size()));
+        auto chunk = Sound::Load(buffer.data(), buffer.size());
 
-        sound.clear();
+        sound.Clear();
 
         return chunk;
     }
@@ -166,15 +165,15 @@ namespace BloodSword::Sound
             // initialize mixer
             Sound::Initialize();
 
-            auto ifs = ZipFile::Read(zip_file.c_str(), assets.c_str());
+            auto ifs = ZipFile::Open(zip_file.c_str(), assets.c_str());
 
-            if (!ifs.empty())
+            if (!ifs.IsEmpty())
             {
-                auto data = nlohmann::json::parse(ifs);
+                auto data = nlohmann::json::parse(ifs.View());
 
                 Sound::Load(data, zip_file.c_str());
 
-                ifs.clear();
+                ifs.Clear();
             }
         }
     }
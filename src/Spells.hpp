@@ -45,7 +45,7 @@ namespace BloodSword::Spells
     };
 
     // map string to spell type
-    BloodSword::StringMap<Spells::Type> TypeMapping = {
+    constexpr auto TypeMapping = BloodSword::Tabulate<Spells::Type, std::string>({
         {Spells::Type::NONE, "NONE"},
         {Spells::Type::VOLCANO_SPRAY, "VOLCANO SPRAY"},
         {Spells::Type::NIGHTHOWL, "NIGHTHOWL"},
@@ -62,13 +62,13 @@ namespace BloodSword::Spells
         {Spells::Type::SERVILE_ENTHRALMENT, "SERVILE ENTHRALMENT"},
         {Spells::Type::SUMMON_FALTYN, "SUMMON FALTYN"},
         {Spells::Type::PREDICTION, "PREDICTION"},
-        {Spells::Type::DETECT_ENCHANTMENT, "DETECT ENCHANTMENT"}};
+        {Spells::Type::DETECT_ENCHANTMENT, "DETECT ENCHANTMENT"}});
 
     // map spell types to asset ids
     Asset::Lookup<Spells::Type> Assets = {};
 
     // map spell types to asset names
-    BloodSword::ConstStrings<Spells::Type> AssetNames = {
+    constexpr auto AssetNames = BloodSword::Tabulate<Spells::Type>({
         {Spells::Type::VOLCANO_SPRAY, "VOLCANO SPRAY"},
         {Spells::Type::NIGHTHOWL, "NIGHTHOWL"},
         {Spells::Type::WHITE_FIRE, "WHITE FIRE"},
@@ -84,13 +84,13 @@ namespace BloodSword::Spells
         {Spells::Type::SERVILE_ENTHRALMENT, "SERVILE ENTHRALMENT"},
         {Spells::Type::SUMMON_FALTYN, "SUMMON FALTYN"},
         {Spells::Type::PREDICTION, "PREDICTION"},
-        {Spells::Type::DETECT_ENCHANTMENT, "DETECT ENCHANTMENT"}};
+        {Spells::Type::DETECT_ENCHANTMENT, "DETECT ENCHANTMENT"}});
 
     // spell class mapping to strings
-    BloodSword::StringMap<Spells::Class> ClassMapping = {
+    constexpr auto ClassMapping = BloodSword::Tabulate<Spells::Class, std::string>({
         {Spells::Class::NONE, "NONE"},
         {Spells::Class::BLASTING, "BLASTING"},
-        {Spells::Class::PSYCHIC, "PSYCHIC"}};
+        {Spells::Class::PSYCHIC, "PSYCHIC"}});
 
     // spells that do not need to be called to mind
     Spells::List Basic = {
@@ -43,7 +43,7 @@ namespace BloodSword::SpriteSheet
                 {
                     if (asset != Asset::NONE)
                     {
-                        auto surface_asset = Asset::Surface(asset);
+                        auto surface_asset = Asset::Cached(asset);
 
                         if (surface_asset == nullptr)
                         {
@@ -54,7 +54,7 @@ namespace BloodSword::SpriteSheet
 
                         rect.y = (reverse ? height - y - 1 : y) * BloodSword::TileSize;
 
-                        Graphics::RenderAssetThenFree(surface, surface_asset, rect);
+                        Graphics::RenderAsset(surface, surface_asset, rect);
 
                         x++;
 
@@ -14,18 +14,9 @@ namespace BloodSword
         // graphics system
         Graphics::Base graphics;
 
-        // initialize all subsytems
-        void Initialize(const char *session_name, const char *default_module = nullptr)
+        // load module settings and prepare the rest of the subsystems (after the graphics system)
+        void Configure()
         {
-            // initialize random number generator
-            Engine::InitializeRNG();
-
-            // load default module
-            Interface::LoadModules(default_module);
-
-            // initialize graphics system
-            this->graphics = Graphics::Initialize(session_name);
-
             // load settings of current module
             if (Interface::Zipped)
             {
@@ -43,6 +34,36 @@ namespace BloodSword
             Input::Flush();
         }
 
+        // initialize all subsytems
+        void Initialize(const char *session_name, const char *default_module = nullptr)
+        {
+            // initialize random number generator
+            Engine::InitializeRNG();
+
+            // load default module
+            Interface::LoadModules(default_module);
+
+            // initialize graphics system
+            this->graphics = Graphics::Initialize(session_name);
+
+            this->Configure();
+        }
+
+        // initialize all subsystems without a window (frames are drawn on an offscreen surface, width x height)
+        void Headless(const char *default_module, int width, int height)
+        {
+            // initialize random number generator
+            Engine::InitializeRNG();
+
+            // load default module
+            Interface::LoadModules(default_module);
+
+            // initialize graphics system
+            this->graphics = Graphics::Headless(width, height);
+
+            this->Configure();
+        }
+
         // initialize all subsystems with default session name
         void Initialize()
         {
@@ -55,6 +76,9 @@ namespace BloodSword
             // close all assets
             Interface::UnloadAssets();
 
+            // stop decoding images in the background
+            Asset::Background.Stop();
+
             // close subsystems
             Graphics::Quit(this->graphics);
         }
@@ -42,7 +42,7 @@ namespace BloodSword::Target
     using Mapped = BloodSword::UnorderedMap<Target::Type, T>;
 
     // mapping of target types to strings
-    BloodSword::StringMap<Target::Type> Mapping = {
+    constexpr auto Mapping = BloodSword::Tabulate<Target::Type, std::string>({
         {Target::Type::NONE, "NONE"},
         {Target::Type::PLAYER, "PLAYER"},
         {Target::Type::ENEMY, "ENEMY"},
@@ -60,7 +60,7 @@ namespace BloodSword::Target
         {Target::Type::GIANT_SPIDER, "GIANT SPIDER"},
         {Target::Type::GIANT, "GIANT"},
         {Target::Type::NEBULARON, "NEBULARON"},
-        {Target::Type::EIDOLON, "EIDOLON"}};
+        {Target::Type::EIDOLON, "EIDOLON"}});
 
     // map string to target type
     Target::Type Map(std::string target)
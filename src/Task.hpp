@@ -17,12 +17,12 @@ namespace BloodSword::Task
     };
 
     // task status to string mapping
-    BloodSword::StringMap<Task::Status> Mapping = {
+    constexpr auto Mapping = BloodSword::Tabulate<Task::Status, std::string>({
         {Task::Status::NONE, "NONE"},
         {Task::Status::START, "START"},
         {Task::Status::PROGRESS, "PROGRESS"},
         {Task::Status::INCOMPLETE, "INCOMPLETE"},
-        {Task::Status::COMPLETE, "COMPLETE"}};
+        {Task::Status::COMPLETE, "COMPLETE"}});
 
     // map string to task status
     Task::Status Map(std::string task)
@@ -1,7 +1,14 @@
 #ifndef __TEMPLATES_HPP__
 #define __TEMPLATES_HPP__
 
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 
@@ -20,46 +27,540 @@ namespace BloodSword
     template <typename T, typename R>
     using UnorderedMap = std::unordered_map<T, R>;
 
+    // bidirectional mapping (hashed in both directions) of objects/types to their names
+    template <typename T, typename R>
+    class Registry
+    {
+    public:
+        // names are indexed by their contents
+        typedef typename std::conditional<std::is_same<R, std::string>::value || std::is_same<R, const char *>::value, std::string_view, R>::type Key;
+
+        typedef typename BloodSword::UnorderedMap<T, R>::const_iterator const_iterator;
+
+    private:
+        // object/type to name
+        BloodSword::UnorderedMap<T, R> Forward = {};
+
+        // name to object/type (views point into Forward or to string literals)
+        BloodSword::UnorderedMap<Key, T> Reverse = {};
+
+        // name used as a reverse index key
+        static Key Index(const R &value)
+        {
+            if constexpr (std::is_same<R, const char *>::value)
+            {
+                return value != nullptr ? std::string_view(value) : std::string_view();
+            }
+            else
+            {
+                return Key(value);
+            }
+        }
+
+    public:
+        Registry() {}
+
+        Registry(std::initializer_list<std::pair<const T, R>> entries)
+        {
+            for (auto &entry : entries)
+            {
+                this->Set(entry.first, entry.second);
+            }
+        }
+
+        // the reverse index of a copy must refer to the copy's own names
+        Registry(const Registry &other)
+        {
+            for (auto &entry : other.Forward)
+            {
+                this->Set(entry.first, entry.second);
+            }
+        }
+
+        Registry &operator=(const Registry &other)
+        {
+            if (this != &other)
+            {
+                this->Clear();
+
+                for (auto &entry : other.Forward)
+                {
+                    this->Set(entry.first, entry.second);
+                }
+            }
+
+            return *this;
+        }
+
+        Registry(Registry &&other) = default;
+
+        Registry &operator=(Registry &&other) = default;
+
+        // add or replace the name of an object/type (the first object/type registered under a name is returned by Find)
+        void Set(const T &key, const R &value)
+        {
+            this->Remove(key);
+
+            auto &name = (this->Forward[key] = value);
+
+            this->Reverse.emplace(Registry::Index(name), key);
+        }
+
+        // remove object/type
+        void Remove(const T &key)
+        {
+            auto search = this->Forward.find(key);
+
+            if (search != this->Forward.end())
+            {
+                auto name = Registry::Index(search->second);
+
+                auto reverse = this->Reverse.find(name);
+
+                auto indexed = (reverse != this->Reverse.end() && reverse->second == key);
+
+                if (indexed)
+                {
+                    this->Reverse.erase(reverse);
+                }
+
+                this->Forward.erase(search);
+
+                // another object/type may share the name
+                if (indexed)
+                {
+                    for (auto &entry : this->Forward)
+                    {
+                        if (Registry::Index(entry.second) == name)
+                        {
+                            this->Reverse.emplace(Registry::Index(entry.second), entry.first);
+
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+
+        // remove everything
+        void Clear()
+        {
+            this->Reverse.clear();
+
+            this->Forward.clear();
+        }
+
+        // get object/type by name, return default value if not found
+        T Find(const Key &value, T default_value) const
+        {
+            auto search = this->Reverse.find(value);
+
+            return search != this->Reverse.end() ? search->second : default_value;
+        }
+
+        // get name of object/type (empty if not found)
+        const R &operator[](const T &key) const
+        {
+            static const R empty = R();
+
+            auto search = this->Forward.find(key);
+
+            return search != this->Forward.end() ? search->second : empty;
+        }
+
+        // get name of object/type (throws if not found)
+        const R &at(const T &key) const
+        {
+            return this->Forward.at(key);
+        }
+
+        const_iterator find(const T &key) const
+        {
+            return this->Forward.find(key);
+        }
+
+        size_t count(const T &key) const
+        {
+            return this->Forward.count(key);
+        }
+
+        size_t size() const
+        {
+            return this->Forward.size();
+        }
+
+        bool empty() const
+        {
+            return this->Forward.empty();
+        }
+
+        void clear()
+        {
+            this->Clear();
+        }
+
+        const_iterator begin() const
+        {
+            return this->Forward.begin();
+        }
+
+        const_iterator end() const
+        {
+            return this->Forward.end();
+        }
+    };
+
     // maps object/type to a basic string
     template <typename T>
-    using StringMap = BloodSword::UnorderedMap<T, std::string>;
+    using StringMap = BloodSword::Registry<T, std::string>;
 
     // maps object/type to a constant string
     template <typename T>
-    using ConstStrings = BloodSword::UnorderedMap<T, const char *>;
+    using ConstStrings = BloodSword::Registry<T, const char *>;
 
-    // maps object/type to an integer
+    // hashing for tables indexed at compile time
+    namespace Hashing
+    {
+        // 32-bit finalizer (from MurmurHash3)
+        constexpr uint32_t Mix(uint32_t hash)
+        {
+            hash ^= hash >> 16;
+
+            hash *= 0x85ebca6bu;
+
+            hash ^= hash >> 13;
+
+            hash *= 0xc2b2ae35u;
+
+            hash ^= hash >> 16;
+
+            return hash;
+        }
+
+        // hash of a name (FNV-1a)
+        constexpr uint32_t Name(std::string_view name)
+        {
+            uint32_t hash = 2166136261u;
+
+            for (auto character : name)
+            {
+                hash ^= static_cast<uint8_t>(character);
+
+                hash *= 16777619u;
+            }
+
+            return Hashing::Mix(hash);
+        }
+
+        // hash of an object/type
+        template <typename T>
+        constexpr uint32_t Key(T key)
+        {
+            return Hashing::Mix(static_cast<uint32_t>(static_cast<int>(key)));
+        }
+
+        // slot of a hash after displacement
+        constexpr std::size_t Slot(uint32_t hash, uint32_t displacement, std::size_t slots)
+        {
+            return Hashing::Mix(hash ^ (displacement * 0x9e3779b9u)) & (slots - 1);
+        }
+
+        // number of slots for a number of keys (power of two, at most half full)
+        constexpr std::size_t Slots(std::size_t keys)
+        {
+            std::size_t slots = 1;
+
+            while (slots < keys * 2)
+            {
+                slots <<= 1;
+            }
+
+            return slots;
+        }
+
+        // perfect hash ("hash and displace") of N keys into M slots
+        template <std::size_t N, std::size_t M>
+        class Index
+        {
+        public:
+            // displacement of each bucket of keys
+            std::array<uint32_t, N> Displacements = {};
+
+            // key in each slot (-1 if empty)
+            std::array<int, M> Slots = {};
+
+            // build index from the hashes of the keys (same(a, b): keys a and b are equal, only the first of equal keys is indexed)
+            template <typename Same>
+            constexpr Index(const std::array<uint32_t, N> &hashes, Same same)
+            {
+                for (std::size_t slot = 0; slot < M; slot++)
+                {
+                    this->Slots[slot] = -1;
+                }
+
+                // keys grouped by bucket (counting sort): keys of bucket b start at order[starts[b]]
+                std::array<std::size_t, N + 1> starts = {};
+
+                std::array<std::size_t, N> order = {};
+
+                for (std::size_t key = 0; key < N; key++)
+                {
+                    starts[hashes[key] % N + 1]++;
+                }
+
+                for (std::size_t bucket = 0; bucket < N; bucket++)
+                {
+                    starts[bucket + 1] += starts[bucket];
+                }
+
+                std::array<std::size_t, N> sizes = {};
+
+                for (std::size_t key = 0; key < N; key++)
+                {
+                    auto bucket = hashes[key] % N;
+
+                    order[starts[bucket] + sizes[bucket]++] = key;
+                }
+
+                // drop repeated keys (only keys in the same bucket can be equal)
+                std::size_t largest = 0;
+
+                for (std::size_t bucket = 0; bucket < N; bucket++)
+                {
+                    auto first = starts[bucket];
+
+                    std::size_t count = 0;
+
+                    for (auto key = first; key < starts[bucket + 1]; key++)
+                    {
+                        auto repeated = false;
+
+                        for (auto other = first; other < first + count && !repeated; other++)
+                        {
+                            if (hashes[order[key]] == hashes[order[other]])
+                            {
+                                if (!same(order[key], order[other]))
+                                {
+                                    throw std::logic_error("Hash collision in table!");
+                                }
+
+                                repeated = true;
+                            }
+                        }
+
+                        if (!repeated)
+                        {
+                            order[first + count++] = order[key];
+                        }
+                    }
+
+                    sizes[bucket] = count;
+
+                    largest = count > largest ? count : largest;
+                }
+
+                // slots tried for the keys of a bucket
+                std::array<std::size_t, N> slots = {};
+
+                // place larger buckets first
+                for (auto size = largest; size > 0; size--)
+                {
+                    for (std::size_t bucket = 0; bucket < N; bucket++)
+                    {
+                        if (sizes[bucket] != size)
+                        {
+                            continue;
+                        }
+
+                        auto first = starts[bucket];
+
+                        auto last = first + size;
+
+                        auto placed = false;
+
+                        for (uint32_t displacement = 0; displacement < 65536 && !placed; displacement++)
+                        {
+                            auto free = true;
+
+                            for (auto key = first; key < last && free; key++)
+                            {
+                                auto slot = Hashing::Slot(hashes[order[key]], displacement, M);
+
+                                free = (this->Slots[slot] == -1);
+
+                                for (auto other = first; other < key && free; other++)
+                                {
+                                    free = (slots[other] != slot);
+                                }
+
+                                slots[key] = slot;
+                            }
+
+                            if (free)
+                            {
+                                for (auto key = first; key < last; key++)
+                                {
+                                    this->Slots[slots[key]] = static_cast<int>(order[key]);
+                                }
+
+                                this->Displacements[bucket] = displacement;
+
+                                placed = true;
+                            }
+                        }
+
+                        if (!placed)
+                        {
+                            throw std::logic_error("Unable to index table!");
+                        }
+                    }
+                }
+            }
+
+            // get key in the slot of a hash (-1 if none, the key found must still be compared)
+            constexpr int Find(uint32_t hash) const
+            {
+                return this->Slots[Hashing::Slot(hash, this->Displacements[hash % N], M)];
+            }
+        };
+    }
+
+    // object/type and its name
     template <typename T>
-    using IntegerMap = BloodSword::UnorderedMap<T, int>;
+    class Named
+    {
+    public:
+        T first;
 
-    // search for key (using its value), return default value if not found
-    template <typename T, typename R>
-    T Find(BloodSword::UnorderedMap<T, R> &unordered_map, R key, T default_value)
+        const char *second;
+    };
+
+    // fixed table of objects/types and their names, indexed in both directions at compile time
+    // (R is the type returned for names, e.g. const char * or std::string)
+    template <typename T, typename R, std::size_t N>
+    class Table
     {
-        auto result = default_value;
+    public:
+        typedef typename std::array<BloodSword::Named<T>, N>::const_iterator const_iterator;
 
-        for (auto &keys : unordered_map)
+        // number of slots in the indices
+        static constexpr std::size_t M = Hashing::Slots(N);
+
+    private:
+        // hashes of objects/types
+        static constexpr std::array<uint32_t, N> Keys(const std::array<BloodSword::Named<T>, N> &entries)
         {
-            if (keys.second == key)
+            std::array<uint32_t, N> hashes = {};
+
+            for (std::size_t entry = 0; entry < N; entry++)
             {
-                result = keys.first;
+                hashes[entry] = Hashing::Key(entries[entry].first);
+            }
 
-                break;
+            return hashes;
+        }
+
+        // hashes of names
+        static constexpr std::array<uint32_t, N> Names(const std::array<BloodSword::Named<T>, N> &entries)
+        {
+            std::array<uint32_t, N> hashes = {};
+
+            for (std::size_t entry = 0; entry < N; entry++)
+            {
+                hashes[entry] = Hashing::Name(entries[entry].second);
             }
+
+            return hashes;
         }
 
-        return result;
+    public:
+        // entries in the order they were defined
+        std::array<BloodSword::Named<T>, N> Entries = {};
+
+        // object/type to entry
+        Hashing::Index<N, M> KeyIndex;
+
+        // name to entry
+        Hashing::Index<N, M> NameIndex;
+
+        constexpr Table(const std::array<BloodSword::Named<T>, N> &entries) : Entries(entries),
+                                                                              KeyIndex(Table::Keys(entries), [&entries](std::size_t a, std::size_t b)
+                                                                                       { return entries[a].first == entries[b].first; }),
+                                                                              NameIndex(Table::Names(entries), [&entries](std::size_t a, std::size_t b)
+                                                                                        { return std::string_view(entries[a].second) == std::string_view(entries[b].second); }) {}
+
+        // get entry of an object/type (-1 if not found)
+        constexpr int Entry(T key) const
+        {
+            auto entry = this->KeyIndex.Find(Hashing::Key(key));
+
+            return (entry >= 0 && this->Entries[entry].first == key) ? entry : -1;
+        }
+
+        // get object/type by name, return default value if not found
+        constexpr T Find(std::string_view name, T default_value) const
+        {
+            auto entry = this->NameIndex.Find(Hashing::Name(name));
+
+            return (entry >= 0 && name == this->Entries[entry].second) ? this->Entries[entry].first : default_value;
+        }
+
+        // get name of object/type (empty if not found)
+        R operator[](T key) const
+        {
+            auto entry = this->Entry(key);
+
+            return entry >= 0 ? R(this->Entries[entry].second) : R();
+        }
+
+        constexpr std::size_t count(T key) const
+        {
+            return this->Entry(key) >= 0 ? 1 : 0;
+        }
+
+        constexpr std::size_t size() const
+        {
+            return N;
+        }
+
+        constexpr const_iterator begin() const
+        {
+            return this->Entries.begin();
+        }
+
+        constexpr const_iterator end() const
+        {
+            return this->Entries.end();
+        }
+    };
+
+    // create a fixed table of objects/types and their names (R is the type returned for names)
+    template <typename T, typename R = const char *, std::size_t N>
+    constexpr BloodSword::Table<T, R, N> Tabulate(const BloodSword::Named<T> (&entries)[N])
+    {
+        std::array<BloodSword::Named<T>, N> list = {};
+
+        for (std::size_t entry = 0; entry < N; entry++)
+        {
+            list[entry] = entries[entry];
+        }
+
+        return BloodSword::Table<T, R, N>(list);
     }
 
-    // search for a constant string key in a map
+    // maps object/type to an integer
     template <typename T>
-    T Find(BloodSword::ConstStrings<T> &unordered_map, const char *key)
+    using IntegerMap = BloodSword::UnorderedMap<T, int>;
+
+    // search for key (using its value), return default value if not found
+    template <typename T, typename R>
+    T Find(BloodSword::UnorderedMap<T, R> &unordered_map, R key, T default_value)
     {
-        auto result = T::NONE;
+        auto result = default_value;
 
         for (auto &keys : unordered_map)
         {
-            if (std::strcmp(keys.second, key) == 0)
+            if (keys.second == key)
             {
                 result = keys.first;
 
@@ -70,11 +571,18 @@ namespace BloodSword
         return result;
     }
 
-    // search for a string key in a map
-    template <typename T>
-    T Find(BloodSword::StringMap<T> &unordered_map, std::string key)
+    // search for a name in a registry, return default value if not found
+    template <typename T, typename R>
+    T Find(BloodSword::Registry<T, R> &registry, const typename BloodSword::Registry<T, R>::Key &key, T default_value)
     {
-        return BloodSword::Find(unordered_map, key, T::NONE);
+        return registry.Find(key, default_value);
+    }
+
+    // search for a name in a registry
+    template <typename T, typename R>
+    T Find(BloodSword::Registry<T, R> &registry, const typename BloodSword::Registry<T, R>::Key &key)
+    {
+        return registry.Find(key, T::NONE);
     }
 
     // search for a key in a vector of type/objects
@@ -127,6 +635,34 @@ namespace BloodSword
         return (unordered_map.find(key) != unordered_map.end());
     }
 
+    // search for a name in a fixed table, return default value if not found
+    template <typename T, typename R, std::size_t N>
+    constexpr T Find(const BloodSword::Table<T, R, N> &table, std::string_view key, T default_value)
+    {
+        return table.Find(key, default_value);
+    }
+
+    // search for a name in a fixed table
+    template <typename T, typename R, std::size_t N>
+    constexpr T Find(const BloodSword::Table<T, R, N> &table, std::string_view key)
+    {
+        return table.Find(key, T::NONE);
+    }
+
+    // check if the fixed table contains the object/type
+    template <typename T, typename R, std::size_t N>
+    constexpr bool Has(const BloodSword::Table<T, R, N> &table, T key)
+    {
+        return table.count(key) > 0;
+    }
+
+    // check if the registry contains the object/type
+    template <typename T, typename R>
+    bool Has(BloodSword::Registry<T, R> &registry, const T &key)
+    {
+        return registry.count(key) > 0;
+    }
+
     // search for a key in an unordered map
     template <typename T, typename R>
     R Find(BloodSword::UnorderedMap<T, R> &unordered_map, T &key)
@@ -0,0 +1,311 @@
+#ifndef __TEXT_LAYOUT_HPP__
+#define __TEXT_LAYOUT_HPP__
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#ifndef SDL_MAIN_HANDLED
+#define SDL_MAIN_HANDLED
+#endif
+
+#include <SDL.h>
+#include <SDL_ttf.h>
+
+#include "Primitives.hpp"
+#include "Templates.hpp"
+
+// measuring and line breaking of text (without rendering it)
+namespace BloodSword::TextLayout
+{
+    // text broken into lines
+    class Lines
+    {
+    public:
+        // contents of each line
+        std::vector<std::string> Text = {};
+
+        // width of the widest line
+        int Width = 0;
+
+        // distance between the tops of two lines
+        int Skip = 0;
+
+        // number of lines
+        int Count()
+        {
+            return SafeCast(this->Text.size());
+        }
+
+        // height of all the lines
+        int Height()
+        {
+            return this->Count() * this->Skip;
+        }
+    };
+
+    // maximum number of line breaks kept
+    const int Limit = 64;
+
+    // maximum number of word widths kept
+    const int WordLimit = 4096;
+
+    // widths of words measured so far (per font and style)
+    BloodSword::UnorderedMap<std::string, int> Widths = {};
+
+    // line breaks computed so far (per font, style and width)
+    BloodSword::UnorderedMap<std::string, TextLayout::Lines> Breaks = {};
+
+    // forget all measurements (e.g. fonts were reloaded)
+    void Clear()
+    {
+        TextLayout::Widths.clear();
+
+        TextLayout::Breaks.clear();
+    }
+
+    // prefix identifying the font, style and width of a measurement
+    std::string Key(TTF_Font *font, int style, int width)
+    {
+        auto pointer = reinterpret_cast<uintptr_t>(font);
+
+        auto key = std::string(reinterpret_cast<const char *>(&pointer), sizeof(pointer));
+
+        key.append(reinterpret_cast<const char *>(&style), sizeof(style));
+
+        key.append(reinterpret_cast<const char *>(&width), sizeof(width));
+
+        return key;
+    }
+
+    // set font style (changing it discards the font's glyph cache, so only do it when needed)
+    void Style(TTF_Font *font, int style)
+    {
+        if (TTF_GetFontStyle(font) != style)
+        {
+            TTF_SetFontStyle(font, style);
+        }
+    }
+
+    // width of text in pixels
+    int Size(TTF_Font *font, const std::string &text)
+    {
+        auto width = 0;
+
+        if (!text.empty())
+        {
+            TTF_SizeUTF8(font, text.c_str(), &width, nullptr);
+        }
+
+        return width;
+    }
+
+    // width of a word in pixels (measured once per font and style)
+    int Measure(TTF_Font *font, int style, const std::string &word)
+    {
+        auto key = TextLayout::Key(font, style, 0) + word;
+
+        auto search = TextLayout::Widths.find(key);
+
+        if (search != TextLayout::Widths.end())
+        {
+            return search->second;
+        }
+
+        TextLayout::Style(font, style);
+
+        auto width = TextLayout::Size(font, word);
+
+        if (SafeCast(TextLayout::Widths.size()) >= TextLayout::WordLimit)
+        {
+            TextLayout::Widths.clear();
+        }
+
+        TextLayout::Widths[key] = width;
+
+        return width;
+    }
+
+    // width of the widest line (lines are separated by line breaks)
+    int Widest(TTF_Font *font, int style, const char *text)
+    {
+        auto widest = 0;
+
+        if (font && text)
+        {
+            TextLayout::Style(font, style);
+
+            auto start = text;
+
+            while (true)
+            {
+                auto end = std::strchr(start, '\n');
+
+                auto line = end ? std::string(start, end - start) : std::string(start);
+
+                widest = std::max(widest, TextLayout::Size(font, line));
+
+                if (!end)
+                {
+                    break;
+                }
+
+                start = end + 1;
+            }
+        }
+
+        return widest;
+    }
+
+    // split text at each delimiter (empty parts are kept)
+    std::vector<std::string> Split(const std::string &text, char delimiter)
+    {
+        auto parts = std::vector<std::string>();
+
+        auto start = size_t(0);
+
+        auto end = text.find(delimiter);
+
+        while (end != std::string::npos)
+        {
+            parts.push_back(text.substr(start, end - start));
+
+            start = end + 1;
+
+            end = text.find(delimiter, start);
+        }
+
+        parts.push_back(text.substr(start));
+
+        return parts;
+    }
+
+    // move the parts of a word that do not fit on a line to lines of their own (at character boundaries)
+    void Fit(TTF_Font *font, std::string &word, int width, std::vector<std::string> &lines)
+    {
+        while (SafeCast(word.size()) > 1 && TextLayout::Size(font, word) > width)
+        {
+            auto fit = 0;
+
+            auto next = 0;
+
+            while (next < SafeCast(word.size()))
+            {
+                // skip UTF-8 continuation bytes
+                auto end = next + 1;
+
+                while (end < SafeCast(word.size()) && (word[end] & 0xC0) == 0x80)
+                {
+                    end++;
+                }
+
+                if (fit > 0 && TextLayout::Size(font, word.substr(0, end)) > width)
+                {
+                    break;
+                }
+
+                fit = end;
+
+                next = end;
+            }
+
+            if (fit >= SafeCast(word.size()))
+            {
+                break;
+            }
+
+            lines.push_back(word.substr(0, fit));
+
+            word = word.substr(fit);
+        }
+    }
+
+    // break text into lines no wider than width (line breaks in the text are kept)
+    TextLayout::Lines Break(TTF_Font *font, int style, const std::string &text, int width)
+    {
+        auto key = TextLayout::Key(font, style, width) + text;
+
+        auto search = TextLayout::Breaks.find(key);
+
+        if (search != TextLayout::Breaks.end())
+        {
+            return search->second;
+        }
+
+        auto lines = TextLayout::Lines();
+
+        if (!font)
+        {
+            return lines;
+        }
+
+        lines.Skip = TTF_FontLineSkip(font);
+
+        auto space = TextLayout::Measure(font, style, " ");
+
+        auto paragraphs = TextLayout::Split(text, '\n');
+
+        for (auto &paragraph : paragraphs)
+        {
+            auto line = std::string();
+
+            auto line_w = 0;
+
+            auto first = true;
+
+            for (auto &word : TextLayout::Split(paragraph, ' '))
+            {
+                auto word_w = TextLayout::Measure(font, style, word);
+
+                if (first)
+                {
+                    line = word;
+
+                    line_w = word_w;
+
+                    first = false;
+                }
+                else if (width <= 0 || line_w + space + word_w <= width)
+                {
+                    line += ' ' + word;
+
+                    line_w += space + word_w;
+                }
+                else
+                {
+                    lines.Text.push_back(line);
+
+                    lines.Width = std::max(lines.Width, line_w);
+
+                    line = word;
+
+                    line_w = word_w;
+                }
+
+                if (width > 0 && line_w > width)
+                {
+                    TextLayout::Style(font, style);
+
+                    TextLayout::Fit(font, line, width, lines.Text);
+
+                    line_w = TextLayout::Size(font, line);
+                }
+            }
+
+            lines.Text.push_back(line);
+
+            lines.Width = std::max(lines.Width, line_w);
+        }
+
+        if (SafeCast(TextLayout::Breaks.size()) >= TextLayout::Limit)
+        {
+            TextLayout::Breaks.clear();
+        }
+
+        TextLayout::Breaks[key] = lines;
+
+        return lines;
+    }
+}
+
+#endif
@@ -0,0 +1,327 @@
+#ifndef __VARIABLES_HPP__
+#define __VARIABLES_HPP__
+
+#include <algorithm>
+#include <cctype>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "Primitives.hpp"
+#include "Templates.hpp"
+
+// interned, typed storage for story variables
+namespace BloodSword::Variables
+{
+    // variable name (interned)
+    typedef int Symbol;
+
+    // symbol missing or invalid
+    const int NONE = -1;
+
+    // mapping of variable names to symbols
+    BloodSword::UnorderedMap<std::string, Variables::Symbol> Symbols = {};
+
+    // mapping of symbols to variable names
+    std::vector<std::string> Names = {};
+
+    // guards the symbol tables (sections may be parsed on worker threads)
+    std::mutex Lock;
+
+    // get symbol of a variable name (register it if not yet seen)
+    Variables::Symbol Intern(const std::string &name)
+    {
+        auto symbol = Variables::NONE;
+
+        if (!name.empty())
+        {
+            std::lock_guard<std::mutex> guard(Variables::Lock);
+
+            auto search = Variables::Symbols.find(name);
+
+            if (search != Variables::Symbols.end())
+            {
+                symbol = search->second;
+            }
+            else
+            {
+                symbol = SafeCast(Variables::Names.size());
+
+                Variables::Names.push_back(name);
+
+                Variables::Symbols[name] = symbol;
+            }
+        }
+
+        return symbol;
+    }
+
+    // get variable name of a symbol
+    std::string Name(Variables::Symbol symbol)
+    {
+        return (symbol >= 0 && symbol < SafeCast(Variables::Names.size())) ? Variables::Names[symbol] : std::string();
+    }
+
+    // reserved: number of characters in the party (read-only)
+    Variables::Symbol PartySize = Variables::Intern("PARTY");
+
+    // reserved: chosen number
+    Variables::Symbol ChosenNumber = Variables::Intern("CHOSEN");
+
+    // reserved: name of the chosen player
+    Variables::Symbol ChosenPlayer = Variables::Intern("PLAYER");
+
+    // check if string is a (signed) integer
+    bool IsNumber(const std::string &text)
+    {
+        // check if first character is a sign (-/+)
+        auto offset = (SafeCast(text.size()) > 1 && (text[0] == '-' || text[0] == '+') ? 1 : 0);
+
+        // SEE: https://stackoverflow.com/questions/4654636/how-to-determine-if-a-string-is-a-number-with-c
+        return !text.empty() && std::find_if(text.begin() + offset, text.end(), [](unsigned char c)
+                                             { return !std::isdigit(c); }) == text.end();
+    }
+
+    // logical and math operators
+    enum class Operator
+    {
+        NONE = -1,
+        EQUAL,
+        NOT_EQUAL,
+        LESS,
+        LESS_EQUAL,
+        GREATER,
+        GREATER_EQUAL,
+        ADD,
+        SUBTRACT,
+        MULTIPLY
+    };
+
+    // operator to string mapping
+    constexpr auto OperatorMapping = BloodSword::Tabulate<Variables::Operator, std::string>({
+        {Variables::Operator::NONE, "NONE"},
+        {Variables::Operator::EQUAL, "="},
+        {Variables::Operator::NOT_EQUAL, "!="},
+        {Variables::Operator::LESS, "<"},
+        {Variables::Operator::LESS_EQUAL, "<="},
+        {Variables::Operator::GREATER, ">"},
+        {Variables::Operator::GREATER_EQUAL, ">="},
+        {Variables::Operator::ADD, "+"},
+        {Variables::Operator::SUBTRACT, "-"},
+        {Variables::Operator::MULTIPLY, "*"}});
+
+    // map string to operator
+    Variables::Operator MapOperator(const std::string &operation)
+    {
+        // alternate spelling of "not equal"
+        return operation == "<>" ? Variables::Operator::NOT_EQUAL : BloodSword::Find(Variables::OperatorMapping, operation);
+    }
+
+    // check if operator is a logical operator
+    bool IsLogical(Variables::Operator operation)
+    {
+        return (operation >= Variables::Operator::EQUAL && operation <= Variables::Operator::GREATER_EQUAL);
+    }
+
+    // check if operator is a math operator
+    bool IsMath(Variables::Operator operation)
+    {
+        return (operation >= Variables::Operator::ADD && operation <= Variables::Operator::MULTIPLY);
+    }
+
+    // variable value (string and its numeric interpretation)
+    class Value
+    {
+    public:
+        // value is set
+        bool Defined = false;
+
+        // value is a number
+        bool Numeric = false;
+
+        // numeric value
+        int Number = 0;
+
+        // value as it appears in the save game
+        std::string Text = std::string();
+
+        Value() {}
+
+        Value(std::string text)
+        {
+            this->Set(text);
+        }
+
+        Value(int number)
+        {
+            this->Set(number);
+        }
+
+        // set string value
+        void Set(std::string text)
+        {
+            this->Defined = true;
+
+            this->Numeric = Variables::IsNumber(text);
+
+            this->Number = this->Numeric ? std::stoi(text, nullptr, 10) : 0;
+
+            this->Text = text;
+        }
+
+        // set numeric value
+        void Set(int number)
+        {
+            this->Defined = true;
+
+            this->Numeric = true;
+
+            this->Number = number;
+
+            this->Text = std::to_string(number);
+        }
+    };
+
+    // pre-resolved variable or literal (e.g. from a condition)
+    class Operand
+    {
+    public:
+        // original text
+        std::string Text = std::string();
+
+        // symbol of the variable this text may refer to
+        Variables::Symbol Id = Variables::NONE;
+
+        // text is a numeric literal
+        bool Numeric = false;
+
+        // value of the numeric literal
+        int Number = 0;
+
+        // text is an operator
+        Variables::Operator Operation = Variables::Operator::NONE;
+
+        // text contains tokens that must be replaced before use (e.g. CHOSEN)
+        bool Tokens = false;
+
+        Operand() {}
+
+        Operand(std::string text) : Text(text)
+        {
+            this->Numeric = Variables::IsNumber(text);
+
+            if (this->Numeric)
+            {
+                this->Number = std::stoi(text, nullptr, 10);
+            }
+            else
+            {
+                this->Id = Variables::Intern(text);
+
+                this->Operation = Variables::MapOperator(text);
+            }
+
+            // see Engine::MapToken
+            this->Tokens = (text.find(" CHOSEN") != std::string::npos || text.find("CHOSEN ") != std::string::npos || text.find(" chosen") != std::string::npos || text.find("chosen ") != std::string::npos);
+        }
+
+        // check if operand is blank
+        bool IsEmpty()
+        {
+            return this->Text.empty();
+        }
+    };
+
+    // list of operands
+    typedef std::vector<Variables::Operand> Operands;
+
+    // resolve list of strings into operands
+    Variables::Operands Resolve(std::vector<std::string> &variables)
+    {
+        auto operands = Variables::Operands();
+
+        for (auto &variable : variables)
+        {
+            operands.push_back(Variables::Operand(variable));
+        }
+
+        return operands;
+    }
+
+    // variable store (indexed by symbol)
+    class Store
+    {
+    private:
+        std::vector<Variables::Value> Values = {};
+
+        int Defined = 0;
+
+    public:
+        Store() {}
+
+        // check if variable is set
+        bool Has(Variables::Symbol symbol)
+        {
+            return (symbol >= 0 && symbol < SafeCast(this->Values.size()) && this->Values[symbol].Defined);
+        }
+
+        // get variable (must be checked with Has)
+        Variables::Value &operator[](Variables::Symbol symbol)
+        {
+            return this->Values[symbol];
+        }
+
+        // set variable
+        template <typename T>
+        void Set(Variables::Symbol symbol, T value)
+        {
+            if (symbol >= 0)
+            {
+                if (symbol >= SafeCast(this->Values.size()))
+                {
+                    this->Values.resize(symbol + 1);
+                }
+
+                if (!this->Values[symbol].Defined)
+                {
+                    this->Defined++;
+                }
+
+                this->Values[symbol].Set(value);
+            }
+        }
+
+        // erase variable
+        void Remove(Variables::Symbol symbol)
+        {
+            if (this->Has(symbol))
+            {
+                this->Values[symbol] = Variables::Value();
+
+                this->Defined--;
+            }
+        }
+
+        // erase all variables
+        void Clear()
+        {
+            this->Values.clear();
+
+            this->Defined = 0;
+        }
+
+        // number of variables set
+        int Count()
+        {
+            return this->Defined;
+        }
+
+        // upper bound of symbols in the store
+        int Size()
+        {
+            return SafeCast(this->Values.size());
+        }
+    };
+}
+
+#endif
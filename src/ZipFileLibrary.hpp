@@ -1,57 +1,478 @@
 #ifndef __ZIP_FILE_LIBRARY_HPP__
 #define __ZIP_FILE_LIBRARY_HPP__
 
+#include <algorithm>
+#include <cctype>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include "Zipper.hpp"
 
 namespace BloodSword::ZipFile
 {
-    // open zip archive
-    zipper::UnZip Open(const char *zip_file)
+    // read-only memory map of an entire file
+    class Mapping
     {
-        auto zip = zipper::UnZip(zip_file);
+    private:
+#if defined(_WIN32)
+        HANDLE File = INVALID_HANDLE_VALUE;
 
-        return zip;
-    }
+        HANDLE Map = nullptr;
+#endif
+
+    public:
+        // start of mapped bytes (nullptr if not mapped)
+        const char *Data = nullptr;
+
+        // number of mapped bytes
+        uint64_t Size = 0;
+
+        Mapping(const char *filename)
+        {
+#if defined(_WIN32)
+            this->File = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+            if (this->File != INVALID_HANDLE_VALUE)
+            {
+                LARGE_INTEGER size;
+
+                if (GetFileSizeEx(this->File, &size) && size.QuadPart > 0)
+                {
+                    this->Map = CreateFileMappingA(this->File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+                    if (this->Map != nullptr)
+                    {
+                        this->Data = static_cast<const char *>(MapViewOfFile(this->Map, FILE_MAP_READ, 0, 0, 0));
+
+                        this->Size = this->Data != nullptr ? static_cast<uint64_t>(size.QuadPart) : 0;
+                    }
+                }
+            }
+#else
+            auto file = open(filename, O_RDONLY);
+
+            if (file >= 0)
+            {
+                struct stat info;
+
+                if (fstat(file, &info) == 0 && info.st_size > 0)
+                {
+                    auto data = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+
+                    if (data != MAP_FAILED)
+                    {
+                        this->Data = static_cast<const char *>(data);
+
+                        this->Size = static_cast<uint64_t>(info.st_size);
+                    }
+                }
+
+                // the mapping stays valid after the descriptor is closed
+                close(file);
+            }
+#endif
+        }
+
+        ~Mapping()
+        {
+#if defined(_WIN32)
+            if (this->Data != nullptr)
+            {
+                UnmapViewOfFile(this->Data);
+            }
+
+            if (this->Map != nullptr)
+            {
+                CloseHandle(this->Map);
+            }
+
+            if (this->File != INVALID_HANDLE_VALUE)
+            {
+                CloseHandle(this->File);
+            }
+#else
+            if (this->Data != nullptr)
+            {
+                munmap((void *)this->Data, this->Size);
+            }
+#endif
+        }
+
+        Mapping(const Mapping &) = delete;
+
+        Mapping &operator=(const Mapping &) = delete;
+    };
 
-    // close zip archive
-    void Close(zipper::UnZip &zip)
+    // name used to look up an entry (minizip's default matching: case-insensitive on Windows, case-sensitive elsewhere)
+    std::string Key(const char *filename)
     {
-        zip.close();
+        auto key = std::string(filename);
+
+#if defined(_WIN32)
+        std::transform(key.begin(), key.end(), key.begin(), [](unsigned char c)
+                       { return std::tolower(c); });
+#endif
+
+        return key;
     }
 
-    // read filename from open zip archive
-    std::string Read(zipper::UnZip &zip, const char *zip_file, const char *filename)
+    // archive entry
+    class Entry
     {
-        auto buffer = std::string();
+    public:
+        // location in the central directory
+        unz64_file_pos Position;
+
+        // entry is stored (not compressed, not encrypted)
+        bool Stored = false;
+
+        // offset of a stored entry's bytes in the archive
+        uint64_t Offset = 0;
+
+        // uncompressed size
+        uint64_t Size = 0;
+    };
+
+    // zip archive kept open, with an index of its central directory
+    class Archive
+    {
+    private:
+        // minizip handle
+        unzFile Handle = nullptr;
+
+        // the handle has a single "current file", so reads are serialized
+        std::mutex Lock;
+
+    public:
+        // archive file name
+        std::string Filename = std::string();
+
+        // location of each entry in the central directory
+        std::unordered_map<std::string, ZipFile::Entry> Entries = {};
+
+        // archive mapped into memory (stored entries are served from here)
+        std::unique_ptr<ZipFile::Mapping> Mapped = nullptr;
+
+        Archive(const char *zip_file) : Filename(zip_file)
+        {
+            this->Handle = unzOpen64(zip_file);
+
+            if (this->Handle != nullptr)
+            {
+                this->Mapped = std::make_unique<ZipFile::Mapping>(zip_file);
+
+                this->Index();
+            }
+        }
+
+        ~Archive()
+        {
+            this->Close();
+        }
+
+        Archive(const Archive &) = delete;
+
+        Archive &operator=(const Archive &) = delete;
+
+        // check if archive was opened
+        bool IsOpen()
+        {
+            return this->Handle != nullptr;
+        }
+
+        // close archive
+        void Close()
+        {
+            if (this->Handle != nullptr)
+            {
+                unzClose(this->Handle);
+
+                this->Handle = nullptr;
+            }
+
+            this->Entries.clear();
+
+            this->Mapped = nullptr;
+        }
+
+        // walk the central directory once and record where each entry is
+        void Index()
+        {
+            this->Entries.clear();
+
+            char name[ZIPPER_MAX_NAMELEN];
+
+            unz_file_info64 info;
+
+            auto result = unzGoToFirstFile(this->Handle);
+
+            auto mapped = (this->Mapped && this->Mapped->Data != nullptr);
+
+            while (result == UNZ_OK)
+            {
+                auto entry = ZipFile::Entry();
+
+                if (unzGetCurrentFileInfo64(this->Handle, &info, name, sizeof(name), nullptr, 0, nullptr, 0) == UNZ_OK && unzGetFilePos64(this->Handle, &entry.Position) == UNZ_OK)
+                {
+                    entry.Size = info.uncompressed_size;
+
+                    // stored entries can be served directly from the memory map
+                    if (mapped && info.compression_method == 0 && (info.flag & 1) == 0 && unzOpenCurrentFile(this->Handle) == UNZ_OK)
+                    {
+                        auto offset = unzGetCurrentFileZStreamPos64(this->Handle);
+
+                        unzCloseCurrentFile(this->Handle);
+
+                        if (offset > 0 && static_cast<uint64_t>(offset) + entry.Size <= this->Mapped->Size)
+                        {
+                            entry.Stored = true;
+
+                            entry.Offset = static_cast<uint64_t>(offset);
+                        }
+                    }
+
+                    this->Entries[ZipFile::Key(name)] = entry;
+                }
+
+                result = unzGoToNextFile(this->Handle);
+            }
+        }
 
-        try
+        // check if archive contains the file
+        bool Has(const char *filename)
         {
-            // read the specified file into a string
-            if (zip.next(filename))
+            return this->Entries.count(ZipFile::Key(filename)) > 0;
+        }
+
+        // read entire file from archive (empty if not found)
+        std::string Read(const char *filename)
+        {
+            auto buffer = std::string();
+
+            auto entry = this->Entries.find(ZipFile::Key(filename));
+
+            if (entry != this->Entries.end() && entry->second.Stored && this->Mapped)
+            {
+                // stored entry: copy straight from the memory map
+                buffer.assign(this->Mapped->Data + entry->second.Offset, entry->second.Size);
+            }
+            else if (this->Handle != nullptr && entry != this->Entries.end())
+            {
+                std::lock_guard<std::mutex> guard(this->Lock);
+
+                if (unzGoToFilePos64(this->Handle, &entry->second.Position) != UNZ_OK || unzOpenCurrentFile(this->Handle) != UNZ_OK)
+                {
+                    std::string error = "Unable to load [" + std::string(filename) + "] from [" + this->Filename + "]";
+
+                    throw std::invalid_argument(error.c_str());
+                }
+
+                buffer.reserve(entry->second.Size);
+
+                char data[ZIPPER_BUF_SIZE];
+
+                auto read = 0;
+
+                while ((read = unzReadCurrentFile(this->Handle, data, sizeof(data))) > 0)
+                {
+                    buffer.append(data, read);
+                }
+
+                unzCloseCurrentFile(this->Handle);
+
+                if (read < 0)
+                {
+                    std::string error = "Unable to load [" + std::string(filename) + "] from [" + this->Filename + "] : error " + std::to_string(read);
+
+                    throw std::invalid_argument(error.c_str());
+                }
+            }
+
+            return buffer;
+        }
+
+        // read the first few bytes of a file (e.g. image headers)
+        std::string Peek(const char *filename, int size)
+        {
+            auto buffer = std::string();
+
+            auto entry = this->Entries.find(ZipFile::Key(filename));
+
+            if (entry != this->Entries.end() && entry->second.Stored && this->Mapped)
             {
-                zip.read(buffer);
+                buffer.assign(this->Mapped->Data + entry->second.Offset, std::min(entry->second.Size, static_cast<uint64_t>(size)));
             }
+            else if (this->Handle != nullptr && entry != this->Entries.end() && size > 0)
+            {
+                std::lock_guard<std::mutex> guard(this->Lock);
+
+                if (unzGoToFilePos64(this->Handle, &entry->second.Position) == UNZ_OK && unzOpenCurrentFile(this->Handle) == UNZ_OK)
+                {
+                    buffer.resize(size);
+
+                    auto read = unzReadCurrentFile(this->Handle, buffer.data(), size);
+
+                    buffer.resize(read > 0 ? read : 0);
+
+                    unzCloseCurrentFile(this->Handle);
+                }
+            }
+
+            return buffer;
         }
-        catch (std::exception &e)
+
+        // view of a stored entry in the memory map (empty if not stored or not found)
+        std::string_view View(const char *filename)
         {
-            std::string error = "Unable to load [" + std::string(filename) + "] from [" + std::string(zip_file) + "] : " + e.what();
+            auto view = std::string_view();
+
+            auto entry = this->Entries.find(ZipFile::Key(filename));
 
-            throw std::invalid_argument(error.c_str());
+            if (entry != this->Entries.end() && entry->second.Stored && this->Mapped)
+            {
+                view = std::string_view(this->Mapped->Data + entry->second.Offset, entry->second.Size);
+            }
+
+            return view;
         }
+    };
+
+    // contents of a file in an archive: a view into the memory map or a copy
+    class Source
+    {
+    public:
+        // keeps the memory map alive while the view is in use
+        std::shared_ptr<ZipFile::Archive> Archive = nullptr;
+
+        // view into the memory map (stored entries)
+        std::string_view Mapped = std::string_view();
 
-        return buffer;
+        // decompressed copy (other entries)
+        std::string Buffer = std::string();
+
+        // file contents
+        std::string_view View()
+        {
+            return !this->Mapped.empty() ? this->Mapped : std::string_view(this->Buffer);
+        }
+
+        // check if there is nothing to read
+        bool IsEmpty()
+        {
+            return this->Mapped.empty() && this->Buffer.empty();
+        }
+
+        // release contents
+        void Clear()
+        {
+            this->Mapped = std::string_view();
+
+            this->Buffer.clear();
+
+            this->Archive = nullptr;
+        }
+    };
+
+    // archives opened so far (kept open for the lifetime of the module)
+    std::unordered_map<std::string, std::shared_ptr<ZipFile::Archive>> Archives = {};
+
+    // guards the registry (files may be read from worker threads)
+    std::mutex RegistryLock;
+
+    // get open archive (open and index it on first use)
+    std::shared_ptr<ZipFile::Archive> Get(const char *zip_file)
+    {
+        std::lock_guard<std::mutex> guard(ZipFile::RegistryLock);
+
+        auto search = ZipFile::Archives.find(zip_file);
+
+        if (search != ZipFile::Archives.end())
+        {
+            return search->second;
+        }
+
+        auto archive = std::make_shared<ZipFile::Archive>(zip_file);
+
+        // archives that failed to open are tried again the next time
+        if (archive->IsOpen())
+        {
+            ZipFile::Archives[zip_file] = archive;
+        }
+
+        return archive;
+    }
+
+    // close all archives except the one in use (empty to close everything)
+    void Retain(std::string zip_file)
+    {
+        std::lock_guard<std::mutex> guard(ZipFile::RegistryLock);
+
+        for (auto archive = ZipFile::Archives.begin(); archive != ZipFile::Archives.end();)
+        {
+            if (archive->first != zip_file)
+            {
+                archive = ZipFile::Archives.erase(archive);
+            }
+            else
+            {
+                archive++;
+            }
+        }
+    }
+
+    // close all archives
+    void CloseAll()
+    {
+        ZipFile::Retain(std::string());
     }
 
     // read entire file from zip archive
     std::string Read(const char *zip_file, const char *filename)
     {
-        auto zip = zipper::UnZip(zip_file);
+        auto archive = ZipFile::Get(zip_file);
 
-        auto buffer = ZipFile::Read(zip, zip_file, filename);
+        return archive->Read(filename);
+    }
 
-        zip.close();
+    // get contents of file in zip archive without copying (when stored)
+    ZipFile::Source Open(const char *zip_file, const char *filename)
+    {
+        auto source = ZipFile::Source();
+
+        source.Archive = ZipFile::Get(zip_file);
+
+        source.Mapped = source.Archive->View(filename);
+
+        if (source.Mapped.empty())
+        {
+            source.Buffer = source.Archive->Read(filename);
+        }
+
+        return source;
+    }
+
+    // read the first few bytes of a file in a zip archive
+    std::string Peek(const char *zip_file, const char *filename, int size)
+    {
+        auto archive = ZipFile::Get(zip_file);
 
-        return buffer;
+        return archive->Peek(filename, size);
     }
 
     // read entire file from zip archive
@@ -61,4 +482,4 @@ namespace BloodSword::ZipFile
     }
 }
 
-#endif
\ No newline at end of file
+#endif